@@ -0,0 +1,3426 @@
+/*
+ * Modern-Text-Tokenizer-Unicode.hpp
+ * -------------------------------------
+ * Unicode property tables for Modern-Text-Tokenizer.hpp: token boundary
+ * classes, simple case folding and normalization (NFC, NFD, NFKC).
+ *
+ * Generated by tools/gen_unicode_tables.py from Unicode 14.0.0.
+ * Do not edit by hand; rerun the script instead.
+ * ---------------------------------------------------------------------------
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace MecanikDev
+{
+	namespace UnicodeTables
+	{
+		inline constexpr char unicode_version[] = "14.0.0";
+
+		// Token boundary class of a non-ASCII code point: White_Space, or
+		// any punctuation category (Pc, Pd, Ps, Pe, Pi, Pf, Po)
+		enum CharClass : uint8_t { other = 0, whitespace = 1, punctuation = 2 };
+
+		inline constexpr uint32_t class_limit = 0x1E980;
+
+		// Mask index of each block of 64 code points below class_limit
+		inline constexpr uint8_t class_blocks[1958] = {
+			0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x09, 0x0A, 0x00, 0x00, 0x0B,
+			0x0C, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x12, 0x13, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x16, 0x00, 0x17, 0x18,
+			0x00, 0x19, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00,
+			0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1E, 0x1F, 0x20, 0x00, 0x00, 0x21,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x24, 0x00, 0x25, 0x00, 0x00, 0x26, 0x00, 0x27,
+			0x28, 0x29, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x2B, 0x2C, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x30,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x33, 0x00, 0x11, 0x00, 0x00, 0x34, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x36, 0x00, 0x37, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x38, 0x39, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x3B, 0x00, 0x3C, 0x3D, 0x3E, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x43, 0x44, 0x00, 0x00, 0x45, 0x46, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x48,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x4A, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x4D, 0x4E, 0x00, 0x4F, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x51, 0x52, 0x00,
+			0x00, 0x53, 0x54, 0x55, 0x00, 0x56, 0x00, 0x57, 0x58, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5A, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x5D, 0x5E, 0x00, 0x5F, 0x00, 0x00, 0x00,
+			0x1A, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x61, 0x62, 0x63, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x62,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x69, 0x6A, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x61,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+		};
+
+		// Whitespace code points of a block, bit per code point
+		inline constexpr uint64_t whitespace_masks[109] = {
+			0x0000000000000000, 0x0000000100000020, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00008300000007FF,
+			0x0000000080000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000,
+		};
+
+		// Punctuation code points of a block, bit per code point
+		inline constexpr uint64_t punctuation_masks[109] = {
+			0x0000000000000000, 0x88C0088200000000, 0x4000000000000000, 0x0000000000000080,
+			0x00000000FC000000, 0x4000000000000600, 0x0018000000000049, 0x00000000E8003600,
+			0x00003C0000000000, 0x0000000000100000, 0x0000000000003FFF, 0x0380000000000000,
+			0x7FFF000000000000, 0x0000000040000000, 0x0001003000000000, 0x2000000000000000,
+			0x0040000000000000, 0x0001000000000000, 0x0080000000000000, 0x0000000000000010,
+			0x0010000000000000, 0x000000000C008000, 0x3C0000000017FFF0, 0x0000000000000020,
+			0x00000000061F0000, 0x000000000000FC00, 0x0800000000000000, 0x000001FF00000000,
+			0x0000000000000001, 0x0000400000000000, 0x0000000018000000, 0x0000380000000000,
+			0x0060000000000000, 0x0000000007700000, 0x00000000000007FF, 0x0000000000000030,
+			0x00000000C0000000, 0x00003F7F00000000, 0x60000001FC000000, 0xF000000000000000,
+			0xF800000000000000, 0xC000000000000000, 0x00000000000800FF, 0xFFFF00FFFFFF0000,
+			0x600000007FFBFFEF, 0x0000000000006000, 0x0000060000000F00, 0x003FFF0000000000,
+			0x0000FFC000000060, 0x0000000001FFFFF8, 0x300000000F000000, 0xDE00000000000000,
+			0xFFFF7FFFFFFFFFFF, 0x000000003FFCFFFF, 0x20010000FFF3FF0E, 0x0000000100000000,
+			0x000000000000E000, 0x4008000000000000, 0x00FC000000000000, 0x00F0000000000000,
+			0x170000000000C000, 0x0000C00000000000, 0x0000000080000000, 0x00000000C0003FFE,
+			0x00000000F0000000, 0x00030000C0000000, 0x0000080000000000, 0xFFFF000003FF0000,
+			0x00000D0BFFF7FFFF, 0xB80000018C00F7EE, 0x0000003FA8000000, 0x0000000000000007,
+			0x0000000000010000, 0x0000800000000000, 0x0000000000800000, 0x8000000080000000,
+			0x8000000001FF0000, 0x007F000000000000, 0xFE00000000000000, 0x000000001E000000,
+			0x0000200000000000, 0x0000000003E00000, 0x00000000000003C0, 0x0000000000003F80,
+			0xD800000000000000, 0x0000000000000003, 0x003000000000000F, 0x00000000E80021E0,
+			0x3F00000000000000, 0x0000020000000000, 0x000000002C00F800, 0x0000000000000040,
+			0x0000000000FFFFFE, 0x00001FFF0000000E, 0x0200000000000000, 0x7000000000000000,
+			0x0000000000000070, 0x0000000400000000, 0x8000000000000000, 0x000000000000007F,
+			0x00000007DC000000, 0x000300000000003E, 0x0180000000000000, 0x001F000000000000,
+			0x0006000000000000, 0x0020000000000000, 0x0F80000000000000, 0x0000000007800000,
+			0x0000000000000F80,
+		};
+
+		// Mask index of the block of 64 code points holding cp >> 6 == block
+		inline uint8_t block_index(uint32_t block) {
+			return block < (class_limit >> 6) ? class_blocks[block] : 0;
+		}
+
+		inline CharClass char_class(char32_t cp) {
+			uint8_t index = block_index(cp >> 6);
+			uint64_t bit = uint64_t(1) << (cp & 63);
+			if (whitespace_masks[index] & bit) return whitespace;
+			if (punctuation_masks[index] & bit) return punctuation;
+			return other;
+		}
+
+		inline constexpr uint32_t fold_direct_limit = 0x580;
+
+		// Simple case folding of U+0080 up to fold_direct_limit
+		inline constexpr uint16_t fold_direct[1280] = {
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+			0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+			0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x03BC, 0x00B6, 0x00B7,
+			0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+			0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+			0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+			0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00D7,
+			0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00DF,
+			0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+			0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+			0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+			0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF,
+			0x0101, 0x0101, 0x0103, 0x0103, 0x0105, 0x0105, 0x0107, 0x0107,
+			0x0109, 0x0109, 0x010B, 0x010B, 0x010D, 0x010D, 0x010F, 0x010F,
+			0x0111, 0x0111, 0x0113, 0x0113, 0x0115, 0x0115, 0x0117, 0x0117,
+			0x0119, 0x0119, 0x011B, 0x011B, 0x011D, 0x011D, 0x011F, 0x011F,
+			0x0121, 0x0121, 0x0123, 0x0123, 0x0125, 0x0125, 0x0127, 0x0127,
+			0x0129, 0x0129, 0x012B, 0x012B, 0x012D, 0x012D, 0x012F, 0x012F,
+			0x0130, 0x0131, 0x0133, 0x0133, 0x0135, 0x0135, 0x0137, 0x0137,
+			0x0138, 0x013A, 0x013A, 0x013C, 0x013C, 0x013E, 0x013E, 0x0140,
+			0x0140, 0x0142, 0x0142, 0x0144, 0x0144, 0x0146, 0x0146, 0x0148,
+			0x0148, 0x0149, 0x014B, 0x014B, 0x014D, 0x014D, 0x014F, 0x014F,
+			0x0151, 0x0151, 0x0153, 0x0153, 0x0155, 0x0155, 0x0157, 0x0157,
+			0x0159, 0x0159, 0x015B, 0x015B, 0x015D, 0x015D, 0x015F, 0x015F,
+			0x0161, 0x0161, 0x0163, 0x0163, 0x0165, 0x0165, 0x0167, 0x0167,
+			0x0169, 0x0169, 0x016B, 0x016B, 0x016D, 0x016D, 0x016F, 0x016F,
+			0x0171, 0x0171, 0x0173, 0x0173, 0x0175, 0x0175, 0x0177, 0x0177,
+			0x00FF, 0x017A, 0x017A, 0x017C, 0x017C, 0x017E, 0x017E, 0x0073,
+			0x0180, 0x0253, 0x0183, 0x0183, 0x0185, 0x0185, 0x0254, 0x0188,
+			0x0188, 0x0256, 0x0257, 0x018C, 0x018C, 0x018D, 0x01DD, 0x0259,
+			0x025B, 0x0192, 0x0192, 0x0260, 0x0263, 0x0195, 0x0269, 0x0268,
+			0x0199, 0x0199, 0x019A, 0x019B, 0x026F, 0x0272, 0x019E, 0x0275,
+			0x01A1, 0x01A1, 0x01A3, 0x01A3, 0x01A5, 0x01A5, 0x0280, 0x01A8,
+			0x01A8, 0x0283, 0x01AA, 0x01AB, 0x01AD, 0x01AD, 0x0288, 0x01B0,
+			0x01B0, 0x028A, 0x028B, 0x01B4, 0x01B4, 0x01B6, 0x01B6, 0x0292,
+			0x01B9, 0x01B9, 0x01BA, 0x01BB, 0x01BD, 0x01BD, 0x01BE, 0x01BF,
+			0x01C0, 0x01C1, 0x01C2, 0x01C3, 0x01C6, 0x01C6, 0x01C6, 0x01C9,
+			0x01C9, 0x01C9, 0x01CC, 0x01CC, 0x01CC, 0x01CE, 0x01CE, 0x01D0,
+			0x01D0, 0x01D2, 0x01D2, 0x01D4, 0x01D4, 0x01D6, 0x01D6, 0x01D8,
+			0x01D8, 0x01DA, 0x01DA, 0x01DC, 0x01DC, 0x01DD, 0x01DF, 0x01DF,
+			0x01E1, 0x01E1, 0x01E3, 0x01E3, 0x01E5, 0x01E5, 0x01E7, 0x01E7,
+			0x01E9, 0x01E9, 0x01EB, 0x01EB, 0x01ED, 0x01ED, 0x01EF, 0x01EF,
+			0x01F0, 0x01F3, 0x01F3, 0x01F3, 0x01F5, 0x01F5, 0x0195, 0x01BF,
+			0x01F9, 0x01F9, 0x01FB, 0x01FB, 0x01FD, 0x01FD, 0x01FF, 0x01FF,
+			0x0201, 0x0201, 0x0203, 0x0203, 0x0205, 0x0205, 0x0207, 0x0207,
+			0x0209, 0x0209, 0x020B, 0x020B, 0x020D, 0x020D, 0x020F, 0x020F,
+			0x0211, 0x0211, 0x0213, 0x0213, 0x0215, 0x0215, 0x0217, 0x0217,
+			0x0219, 0x0219, 0x021B, 0x021B, 0x021D, 0x021D, 0x021F, 0x021F,
+			0x019E, 0x0221, 0x0223, 0x0223, 0x0225, 0x0225, 0x0227, 0x0227,
+			0x0229, 0x0229, 0x022B, 0x022B, 0x022D, 0x022D, 0x022F, 0x022F,
+			0x0231, 0x0231, 0x0233, 0x0233, 0x0234, 0x0235, 0x0236, 0x0237,
+			0x0238, 0x0239, 0x2C65, 0x023C, 0x023C, 0x019A, 0x2C66, 0x023F,
+			0x0240, 0x0242, 0x0242, 0x0180, 0x0289, 0x028C, 0x0247, 0x0247,
+			0x0249, 0x0249, 0x024B, 0x024B, 0x024D, 0x024D, 0x024F, 0x024F,
+			0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257,
+			0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F,
+			0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267,
+			0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F,
+			0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277,
+			0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F,
+			0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286, 0x0287,
+			0x0288, 0x0289, 0x028A, 0x028B, 0x028C, 0x028D, 0x028E, 0x028F,
+			0x0290, 0x0291, 0x0292, 0x0293, 0x0294, 0x0295, 0x0296, 0x0297,
+			0x0298, 0x0299, 0x029A, 0x029B, 0x029C, 0x029D, 0x029E, 0x029F,
+			0x02A0, 0x02A1, 0x02A2, 0x02A3, 0x02A4, 0x02A5, 0x02A6, 0x02A7,
+			0x02A8, 0x02A9, 0x02AA, 0x02AB, 0x02AC, 0x02AD, 0x02AE, 0x02AF,
+			0x02B0, 0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7,
+			0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF,
+			0x02C0, 0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7,
+			0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF,
+			0x02D0, 0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7,
+			0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF,
+			0x02E0, 0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7,
+			0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF,
+			0x02F0, 0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7,
+			0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF,
+			0x0300, 0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307,
+			0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F,
+			0x0310, 0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0x0316, 0x0317,
+			0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
+			0x0320, 0x0321, 0x0322, 0x0323, 0x0324, 0x0325, 0x0326, 0x0327,
+			0x0328, 0x0329, 0x032A, 0x032B, 0x032C, 0x032D, 0x032E, 0x032F,
+			0x0330, 0x0331, 0x0332, 0x0333, 0x0334, 0x0335, 0x0336, 0x0337,
+			0x0338, 0x0339, 0x033A, 0x033B, 0x033C, 0x033D, 0x033E, 0x033F,
+			0x0340, 0x0341, 0x0342, 0x0343, 0x0344, 0x03B9, 0x0346, 0x0347,
+			0x0348, 0x0349, 0x034A, 0x034B, 0x034C, 0x034D, 0x034E, 0x034F,
+			0x0350, 0x0351, 0x0352, 0x0353, 0x0354, 0x0355, 0x0356, 0x0357,
+			0x0358, 0x0359, 0x035A, 0x035B, 0x035C, 0x035D, 0x035E, 0x035F,
+			0x0360, 0x0361, 0x0362, 0x0363, 0x0364, 0x0365, 0x0366, 0x0367,
+			0x0368, 0x0369, 0x036A, 0x036B, 0x036C, 0x036D, 0x036E, 0x036F,
+			0x0371, 0x0371, 0x0373, 0x0373, 0x0374, 0x0375, 0x0377, 0x0377,
+			0x0378, 0x0379, 0x037A, 0x037B, 0x037C, 0x037D, 0x037E, 0x03F3,
+			0x0380, 0x0381, 0x0382, 0x0383, 0x0384, 0x0385, 0x03AC, 0x0387,
+			0x03AD, 0x03AE, 0x03AF, 0x038B, 0x03CC, 0x038D, 0x03CD, 0x03CE,
+			0x0390, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7,
+			0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+			0x03C0, 0x03C1, 0x03A2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7,
+			0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03AC, 0x03AD, 0x03AE, 0x03AF,
+			0x03B0, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7,
+			0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+			0x03C0, 0x03C1, 0x03C3, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7,
+			0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x03D7,
+			0x03B2, 0x03B8, 0x03D2, 0x03D3, 0x03D4, 0x03C6, 0x03C0, 0x03D7,
+			0x03D9, 0x03D9, 0x03DB, 0x03DB, 0x03DD, 0x03DD, 0x03DF, 0x03DF,
+			0x03E1, 0x03E1, 0x03E3, 0x03E3, 0x03E5, 0x03E5, 0x03E7, 0x03E7,
+			0x03E9, 0x03E9, 0x03EB, 0x03EB, 0x03ED, 0x03ED, 0x03EF, 0x03EF,
+			0x03BA, 0x03C1, 0x03F2, 0x03F3, 0x03B8, 0x03B5, 0x03F6, 0x03F8,
+			0x03F8, 0x03F2, 0x03FB, 0x03FB, 0x03FC, 0x037B, 0x037C, 0x037D,
+			0x0450, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457,
+			0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x045D, 0x045E, 0x045F,
+			0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+			0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+			0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+			0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+			0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+			0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+			0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+			0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+			0x0450, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457,
+			0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x045D, 0x045E, 0x045F,
+			0x0461, 0x0461, 0x0463, 0x0463, 0x0465, 0x0465, 0x0467, 0x0467,
+			0x0469, 0x0469, 0x046B, 0x046B, 0x046D, 0x046D, 0x046F, 0x046F,
+			0x0471, 0x0471, 0x0473, 0x0473, 0x0475, 0x0475, 0x0477, 0x0477,
+			0x0479, 0x0479, 0x047B, 0x047B, 0x047D, 0x047D, 0x047F, 0x047F,
+			0x0481, 0x0481, 0x0482, 0x0483, 0x0484, 0x0485, 0x0486, 0x0487,
+			0x0488, 0x0489, 0x048B, 0x048B, 0x048D, 0x048D, 0x048F, 0x048F,
+			0x0491, 0x0491, 0x0493, 0x0493, 0x0495, 0x0495, 0x0497, 0x0497,
+			0x0499, 0x0499, 0x049B, 0x049B, 0x049D, 0x049D, 0x049F, 0x049F,
+			0x04A1, 0x04A1, 0x04A3, 0x04A3, 0x04A5, 0x04A5, 0x04A7, 0x04A7,
+			0x04A9, 0x04A9, 0x04AB, 0x04AB, 0x04AD, 0x04AD, 0x04AF, 0x04AF,
+			0x04B1, 0x04B1, 0x04B3, 0x04B3, 0x04B5, 0x04B5, 0x04B7, 0x04B7,
+			0x04B9, 0x04B9, 0x04BB, 0x04BB, 0x04BD, 0x04BD, 0x04BF, 0x04BF,
+			0x04CF, 0x04C2, 0x04C2, 0x04C4, 0x04C4, 0x04C6, 0x04C6, 0x04C8,
+			0x04C8, 0x04CA, 0x04CA, 0x04CC, 0x04CC, 0x04CE, 0x04CE, 0x04CF,
+			0x04D1, 0x04D1, 0x04D3, 0x04D3, 0x04D5, 0x04D5, 0x04D7, 0x04D7,
+			0x04D9, 0x04D9, 0x04DB, 0x04DB, 0x04DD, 0x04DD, 0x04DF, 0x04DF,
+			0x04E1, 0x04E1, 0x04E3, 0x04E3, 0x04E5, 0x04E5, 0x04E7, 0x04E7,
+			0x04E9, 0x04E9, 0x04EB, 0x04EB, 0x04ED, 0x04ED, 0x04EF, 0x04EF,
+			0x04F1, 0x04F1, 0x04F3, 0x04F3, 0x04F5, 0x04F5, 0x04F7, 0x04F7,
+			0x04F9, 0x04F9, 0x04FB, 0x04FB, 0x04FD, 0x04FD, 0x04FF, 0x04FF,
+			0x0501, 0x0501, 0x0503, 0x0503, 0x0505, 0x0505, 0x0507, 0x0507,
+			0x0509, 0x0509, 0x050B, 0x050B, 0x050D, 0x050D, 0x050F, 0x050F,
+			0x0511, 0x0511, 0x0513, 0x0513, 0x0515, 0x0515, 0x0517, 0x0517,
+			0x0519, 0x0519, 0x051B, 0x051B, 0x051D, 0x051D, 0x051F, 0x051F,
+			0x0521, 0x0521, 0x0523, 0x0523, 0x0525, 0x0525, 0x0527, 0x0527,
+			0x0529, 0x0529, 0x052B, 0x052B, 0x052D, 0x052D, 0x052F, 0x052F,
+			0x0530, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567,
+			0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F,
+			0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577,
+			0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F,
+			0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0557,
+			0x0558, 0x0559, 0x055A, 0x055B, 0x055C, 0x055D, 0x055E, 0x055F,
+			0x0560, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567,
+			0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F,
+			0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577,
+			0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F,
+		};
+
+		inline constexpr uint32_t fold_block_count = 1957;
+
+		// Bit per block of 64 code points holding a fold_ranges entry
+		inline constexpr uint64_t fold_blocks[31] = {
+			0x0000000000000000, 0xFF0400000000800C, 0x000F0000000C0070, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x00006000F6000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x1000000000000000,
+			0x00040000006D0000, 0x0000000400000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0200000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+			0x0000000000000000, 0x0000000000000000, 0x0000001000000000,
+		};
+
+		// Code points first..last (every stride-th) fold to cp + delta
+		struct FoldRange { uint32_t first; uint32_t last; int32_t delta; uint32_t stride; };
+		inline constexpr FoldRange fold_ranges[105] = {
+			{ 0x010A0, 0x010C5, 7264, 1 },
+			{ 0x010C7, 0x010C7, 7264, 1 },
+			{ 0x010CD, 0x010CD, 7264, 1 },
+			{ 0x013F8, 0x013FD, -8, 1 },
+			{ 0x01C80, 0x01C80, -6222, 1 },
+			{ 0x01C81, 0x01C81, -6221, 1 },
+			{ 0x01C82, 0x01C82, -6212, 1 },
+			{ 0x01C83, 0x01C84, -6210, 1 },
+			{ 0x01C85, 0x01C85, -6211, 1 },
+			{ 0x01C86, 0x01C86, -6204, 1 },
+			{ 0x01C87, 0x01C87, -6180, 1 },
+			{ 0x01C88, 0x01C88, 35267, 1 },
+			{ 0x01C90, 0x01CBA, -3008, 1 },
+			{ 0x01CBD, 0x01CBF, -3008, 1 },
+			{ 0x01E00, 0x01E94, 1, 2 },
+			{ 0x01E9B, 0x01E9B, -58, 1 },
+			{ 0x01E9E, 0x01E9E, -7615, 1 },
+			{ 0x01EA0, 0x01EFE, 1, 2 },
+			{ 0x01F08, 0x01F0F, -8, 1 },
+			{ 0x01F18, 0x01F1D, -8, 1 },
+			{ 0x01F28, 0x01F2F, -8, 1 },
+			{ 0x01F38, 0x01F3F, -8, 1 },
+			{ 0x01F48, 0x01F4D, -8, 1 },
+			{ 0x01F59, 0x01F5F, -8, 2 },
+			{ 0x01F68, 0x01F6F, -8, 1 },
+			{ 0x01F88, 0x01F8F, -8, 1 },
+			{ 0x01F98, 0x01F9F, -8, 1 },
+			{ 0x01FA8, 0x01FAF, -8, 1 },
+			{ 0x01FB8, 0x01FB9, -8, 1 },
+			{ 0x01FBA, 0x01FBB, -74, 1 },
+			{ 0x01FBC, 0x01FBC, -9, 1 },
+			{ 0x01FBE, 0x01FBE, -7173, 1 },
+			{ 0x01FC8, 0x01FCB, -86, 1 },
+			{ 0x01FCC, 0x01FCC, -9, 1 },
+			{ 0x01FD8, 0x01FD9, -8, 1 },
+			{ 0x01FDA, 0x01FDB, -100, 1 },
+			{ 0x01FE8, 0x01FE9, -8, 1 },
+			{ 0x01FEA, 0x01FEB, -112, 1 },
+			{ 0x01FEC, 0x01FEC, -7, 1 },
+			{ 0x01FF8, 0x01FF9, -128, 1 },
+			{ 0x01FFA, 0x01FFB, -126, 1 },
+			{ 0x01FFC, 0x01FFC, -9, 1 },
+			{ 0x02126, 0x02126, -7517, 1 },
+			{ 0x0212A, 0x0212A, -8383, 1 },
+			{ 0x0212B, 0x0212B, -8262, 1 },
+			{ 0x02132, 0x02132, 28, 1 },
+			{ 0x02160, 0x0216F, 16, 1 },
+			{ 0x02183, 0x02183, 1, 1 },
+			{ 0x024B6, 0x024CF, 26, 1 },
+			{ 0x02C00, 0x02C2F, 48, 1 },
+			{ 0x02C60, 0x02C60, 1, 1 },
+			{ 0x02C62, 0x02C62, -10743, 1 },
+			{ 0x02C63, 0x02C63, -3814, 1 },
+			{ 0x02C64, 0x02C64, -10727, 1 },
+			{ 0x02C67, 0x02C6B, 1, 2 },
+			{ 0x02C6D, 0x02C6D, -10780, 1 },
+			{ 0x02C6E, 0x02C6E, -10749, 1 },
+			{ 0x02C6F, 0x02C6F, -10783, 1 },
+			{ 0x02C70, 0x02C70, -10782, 1 },
+			{ 0x02C72, 0x02C72, 1, 1 },
+			{ 0x02C75, 0x02C75, 1, 1 },
+			{ 0x02C7E, 0x02C7F, -10815, 1 },
+			{ 0x02C80, 0x02CE2, 1, 2 },
+			{ 0x02CEB, 0x02CED, 1, 2 },
+			{ 0x02CF2, 0x02CF2, 1, 1 },
+			{ 0x0A640, 0x0A66C, 1, 2 },
+			{ 0x0A680, 0x0A69A, 1, 2 },
+			{ 0x0A722, 0x0A72E, 1, 2 },
+			{ 0x0A732, 0x0A76E, 1, 2 },
+			{ 0x0A779, 0x0A77B, 1, 2 },
+			{ 0x0A77D, 0x0A77D, -35332, 1 },
+			{ 0x0A77E, 0x0A786, 1, 2 },
+			{ 0x0A78B, 0x0A78B, 1, 1 },
+			{ 0x0A78D, 0x0A78D, -42280, 1 },
+			{ 0x0A790, 0x0A792, 1, 2 },
+			{ 0x0A796, 0x0A7A8, 1, 2 },
+			{ 0x0A7AA, 0x0A7AA, -42308, 1 },
+			{ 0x0A7AB, 0x0A7AB, -42319, 1 },
+			{ 0x0A7AC, 0x0A7AC, -42315, 1 },
+			{ 0x0A7AD, 0x0A7AD, -42305, 1 },
+			{ 0x0A7AE, 0x0A7AE, -42308, 1 },
+			{ 0x0A7B0, 0x0A7B0, -42258, 1 },
+			{ 0x0A7B1, 0x0A7B1, -42282, 1 },
+			{ 0x0A7B2, 0x0A7B2, -42261, 1 },
+			{ 0x0A7B3, 0x0A7B3, 928, 1 },
+			{ 0x0A7B4, 0x0A7C2, 1, 2 },
+			{ 0x0A7C4, 0x0A7C4, -48, 1 },
+			{ 0x0A7C5, 0x0A7C5, -42307, 1 },
+			{ 0x0A7C6, 0x0A7C6, -35384, 1 },
+			{ 0x0A7C7, 0x0A7C9, 1, 2 },
+			{ 0x0A7D0, 0x0A7D0, 1, 1 },
+			{ 0x0A7D6, 0x0A7D8, 1, 2 },
+			{ 0x0A7F5, 0x0A7F5, 1, 1 },
+			{ 0x0AB70, 0x0ABBF, -38864, 1 },
+			{ 0x0FF21, 0x0FF3A, 32, 1 },
+			{ 0x10400, 0x10427, 40, 1 },
+			{ 0x104B0, 0x104D3, 40, 1 },
+			{ 0x10570, 0x1057A, 39, 1 },
+			{ 0x1057C, 0x1058A, 39, 1 },
+			{ 0x1058C, 0x10592, 39, 1 },
+			{ 0x10594, 0x10595, 39, 1 },
+			{ 0x10C80, 0x10CB2, 64, 1 },
+			{ 0x118A0, 0x118BF, 32, 1 },
+			{ 0x16E40, 0x16E5F, 32, 1 },
+			{ 0x1E900, 0x1E921, 34, 1 },
+		};
+
+		// Simple case folding (CaseFolding.txt status C and S) of cp
+		inline char32_t simple_fold(char32_t cp) {
+			if (cp < 0x80) return cp >= 'A' && cp <= 'Z' ? cp + 32 : cp;
+			if (cp < fold_direct_limit) return fold_direct[cp - 0x80];
+
+			uint32_t block = cp >> 6;
+			if (block >= fold_block_count || ((fold_blocks[block >> 6] >> (block & 63)) & 1) == 0) return cp;
+
+			// Last range starting at or before cp
+			size_t low = 0, high = sizeof(fold_ranges) / sizeof(fold_ranges[0]);
+			while (high - low > 1) {
+				size_t mid = (low + high) / 2;
+				if (fold_ranges[mid].first <= cp) low = mid;
+				else high = mid;
+			}
+			const FoldRange& range = fold_ranges[low];
+			if (cp < range.first || cp > range.last || (cp - range.first) % range.stride != 0) return cp;
+			return static_cast<char32_t>(static_cast<int32_t>(cp) + range.delta);
+		}
+
+		// Normalization quick-check properties (UAX #15): the character is not
+		// allowed (No) or may not be allowed (Maybe) in the form
+		enum NormalizationFlag : uint8_t {
+			nfd_no = 1, nfkd_no = 2, nfc_no = 4, nfc_maybe = 8, nfkc_no = 16, nfkc_maybe = 32
+		};
+
+		inline constexpr unsigned char nfd_safe_byte = 0xC3;
+
+		inline constexpr unsigned char nfc_safe_byte = 0xCC;
+
+		inline constexpr unsigned char nfkc_safe_byte = 0xC2;
+
+		// Canonical combining class | NormalizationFlag << 8
+		inline constexpr uint16_t normalization_properties[69] = {
+			0x0000, 0x0001, 0x0006, 0x0007, 0x0009, 0x000A, 0x000B, 0x000C,
+			0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+			0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C,
+			0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+			0x0054, 0x0067, 0x006B, 0x0076, 0x007A, 0x0081, 0x0082, 0x0084,
+			0x00CA, 0x00D6, 0x00D8, 0x00DA, 0x00DC, 0x00DE, 0x00E0, 0x00E2,
+			0x00E4, 0x00E6, 0x00E8, 0x00E9, 0x00EA, 0x0300, 0x1200, 0x1300,
+			0x1700, 0x17E6, 0x2800, 0x2801, 0x2807, 0x2808, 0x2809, 0x285B,
+			0x28CA, 0x28D8, 0x28DC, 0x28E6, 0x28F0,
+		};
+
+		inline constexpr uint32_t normalization_limit = 0x2FA40;
+
+		// Block of normalization_indexes for each 64 code points below normalization_limit
+		inline constexpr uint8_t normalization_blocks[3049] = {
+			0, 0, 1, 2, 3, 4, 5, 6, 7, 0, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 0, 0, 18, 19,
+			20, 21, 0, 22, 23, 24, 0, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 32, 38, 39, 40,
+			36, 41, 36, 42, 43, 40, 0, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 0, 54, 55, 0, 56, 57, 58,
+			0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 61,
+			0, 0, 62, 0, 63, 0, 0, 0, 64, 65, 66, 67, 68, 69, 70, 71, 72, 0, 0, 73, 74, 75, 76, 77,
+			78, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0, 0, 0,
+			0, 98, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			101, 102, 0, 103, 0, 0, 0, 0, 0, 104, 0, 105, 0, 106, 0, 107, 0, 0, 108, 109, 99, 99, 99, 110,
+			111, 112, 113, 114, 115, 99, 116, 0, 117, 118, 99, 99, 99, 99, 99, 99, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 120, 121, 0, 122, 0, 123,
+			124, 0, 0, 125, 126, 127, 128, 129, 0, 0, 130, 131, 0, 132, 0, 133, 78, 78, 78, 78, 78, 78, 78, 78,
+			78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+			78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+			78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+			78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+			78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+			78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+			78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 134, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135, 135, 135, 135, 136, 137, 135, 138, 139, 140, 141, 142,
+			99, 99, 99, 99, 143, 144, 145, 146, 147, 148, 99, 149, 150, 99, 151, 152, 0, 0, 0, 0, 0, 0, 0, 153,
+			0, 0, 0, 154, 0, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 157, 0, 0, 158, 0, 0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0,
+			0, 0, 160, 0, 0, 161, 162, 0, 0, 163, 164, 0, 165, 128, 0, 166, 167, 0, 0, 168, 169, 170, 0, 0,
+			0, 171, 172, 173, 0, 0, 174, 175, 176, 0, 177, 0, 178, 0, 0, 0, 179, 0, 0, 0, 180, 181, 0, 182,
+			183, 184, 185, 0, 0, 0, 0, 0, 176, 0, 0, 0, 0, 186, 187, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 188, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 192, 193, 194, 0, 195, 0, 0, 0, 0, 0, 0,
+			99, 196, 197, 198, 199, 200, 99, 99, 99, 99, 201, 99, 99, 99, 99, 202, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			203, 0, 0, 0, 189, 0, 0, 0, 0, 0, 204, 205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 206, 0, 207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 208, 209, 210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 211, 212, 213, 0,
+			214, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 216, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135, 135, 135, 135, 135, 135, 135, 135,
+			217,
+		};
+
+		// normalization_properties index per code point, 64 per block
+		inline constexpr uint8_t normalization_indexes[13952] = {
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			54, 0, 0, 0, 0, 0, 0, 0, 54, 0, 54, 0, 0, 0, 0, 54, 0, 0, 54, 54, 54, 54, 0, 0,
+			54, 54, 54, 0, 54, 54, 54, 0, 53, 53, 53, 53, 53, 53, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			0, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 0, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 0, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 0, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 0, 54, 54, 53, 53, 53, 53, 0, 53, 53, 53, 53, 53, 53, 54, 54, 0, 0, 53, 53, 53, 53, 53,
+			53, 54, 0, 0, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 0, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 54, 54, 54, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53,
+			0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			54, 54, 54, 54, 54, 54, 0, 0, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 67, 67, 67, 49, 67, 67,
+			67, 67, 67, 67, 67, 49, 49, 67, 49, 67, 49, 67, 67, 50, 44, 44, 44, 44, 50, 65, 44, 44, 44, 44,
+			44, 40, 40, 66, 66, 66, 66, 64, 64, 44, 44, 44, 44, 66, 66, 44, 66, 66, 44, 44, 1, 1, 1, 1,
+			59, 44, 44, 44, 44, 49, 49, 49, 57, 57, 67, 57, 57, 68, 49, 44, 44, 44, 49, 49, 49, 44, 44, 0,
+			49, 49, 49, 44, 44, 44, 44, 49, 50, 44, 44, 49, 51, 52, 52, 51, 52, 52, 51, 49, 49, 49, 49, 49,
+			49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 54, 0, 0, 0, 56, 0,
+			0, 0, 0, 0, 54, 55, 53, 56, 53, 53, 53, 0, 53, 0, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53,
+			53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 53, 53, 53, 53, 53, 0, 54, 54, 54, 55, 55, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 0, 54, 54, 0, 0,
+			0, 54, 0, 0, 0, 0, 0, 0, 53, 53, 0, 53, 0, 0, 0, 53, 0, 0, 0, 0, 53, 53, 53, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 0, 53, 0, 0, 0, 53,
+			0, 0, 0, 0, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			53, 53, 53, 53, 0, 0, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53,
+			0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 49, 49, 49, 49, 44, 49,
+			49, 49, 45, 44, 49, 49, 49, 49, 49, 49, 44, 44, 44, 44, 44, 44, 49, 49, 44, 49, 49, 45, 48, 49,
+			5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 14, 15, 16, 17, 0, 18, 0, 19, 20, 0, 49, 44, 0, 13,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			49, 49, 49, 49, 49, 49, 49, 49, 25, 26, 27, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 23, 24, 25, 26, 27, 28, 29, 67, 67, 66, 44, 49,
+			49, 49, 49, 49, 44, 49, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			30, 0, 0, 0, 0, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 53, 0, 53, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 49, 49, 49, 49, 49, 49, 49, 0, 0, 49,
+			49, 49, 49, 44, 49, 0, 0, 49, 49, 0, 44, 49, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 49, 49, 44, 49, 49, 44, 44, 44, 49, 44, 44, 49, 44, 49,
+			49, 49, 44, 49, 44, 49, 44, 49, 44, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 44, 49, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 49, 49, 49,
+			0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 44, 44, 49, 49, 49, 49,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 44,
+			44, 44, 44, 44, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 44, 49, 49, 44, 49,
+			49, 44, 49, 49, 49, 44, 44, 44, 22, 23, 24, 49, 49, 49, 44, 49, 49, 44, 44, 49, 49, 49, 49, 49,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0,
+			0, 53, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 4, 0, 0, 0, 49, 44, 49, 49, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 58, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58,
+			0, 0, 0, 0, 56, 56, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 56, 0,
+			0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 53, 53, 4, 0, 0,
+			0, 0, 0, 0, 0, 0, 58, 58, 0, 0, 0, 0, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 53, 53, 53, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 4, 0, 0,
+			0, 0, 0, 0, 0, 32, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			53, 0, 58, 0, 0, 0, 0, 53, 53, 0, 53, 53, 0, 4, 0, 0, 0, 0, 0, 0, 0, 58, 58, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 4, 4, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 58,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 53, 53, 53, 58, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 54, 0, 0, 0, 0, 33, 33, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 35, 35, 4, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 36, 36, 36, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 44,
+			0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0,
+			0, 0, 56, 0, 0, 0, 0, 56, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 56, 0, 0, 0, 0, 0, 0, 0, 37, 38, 56, 39, 56, 56, 54, 56, 54, 38, 38, 38, 38, 0, 0,
+			38, 56, 49, 49, 4, 0, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 56, 0, 0, 0, 0, 56, 0, 0, 0, 0, 56, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0,
+			0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 4, 4, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 58, 58, 58, 58,
+			58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 58, 58, 58, 58, 58,
+			58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 44,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			49, 49, 49, 49, 49, 44, 44, 44, 44, 44, 44, 49, 49, 44, 0, 44, 44, 49, 49, 44, 44, 49, 49, 49,
+			49, 49, 44, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0,
+			0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 58, 0, 0, 0, 0, 0, 53, 0, 53, 0, 0,
+			53, 53, 0, 53, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 49, 49, 49,
+			49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 0, 1, 44, 44, 44, 44, 44, 49, 49, 44, 44, 44, 44,
+			49, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+			49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 49, 49, 44, 49, 49, 49, 49, 49, 49, 49, 44, 49, 49, 52, 41, 44,
+			40, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+			49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 50, 48, 48, 44, 43, 49, 51, 44, 49, 44,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 54, 55, 0, 0, 0, 0,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0,
+			53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0,
+			53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 56, 53, 56, 53, 56, 53, 56,
+			53, 56, 53, 56, 53, 56, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 53, 53, 53, 53, 53, 56, 53, 54, 56, 54,
+			54, 55, 53, 53, 53, 0, 53, 53, 53, 56, 53, 56, 53, 55, 55, 55, 53, 53, 53, 56, 0, 0, 53, 53,
+			53, 53, 53, 56, 0, 55, 55, 55, 53, 53, 53, 56, 53, 53, 53, 53, 53, 53, 53, 56, 53, 55, 56, 56,
+			0, 0, 53, 53, 53, 0, 53, 53, 53, 56, 53, 56, 53, 56, 54, 0, 56, 56, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 54, 54, 0, 54, 54,
+			0, 0, 0, 0, 54, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 1, 1, 49, 49, 49, 49, 1, 1, 1, 49, 49, 0, 0, 0,
+			0, 49, 0, 0, 0, 1, 1, 49, 44, 49, 1, 1, 44, 44, 44, 44, 49, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 0, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 0, 54, 54, 0, 0, 54, 54, 54, 54, 54, 0, 0, 54, 54, 54, 0, 54, 0, 56, 0,
+			54, 0, 56, 56, 54, 54, 0, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54,
+			54, 0, 0, 0, 0, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 53, 0, 0, 0, 0, 53, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 53, 0, 0, 0, 0, 0, 54, 54, 0, 54,
+			54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 53, 0, 0, 53,
+			0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			53, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 0, 0, 53, 53, 0, 0,
+			53, 53, 0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 53, 53, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49,
+			49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+			49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 48, 50, 45, 46, 46,
+			0, 0, 0, 0, 0, 0, 54, 0, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0,
+			53, 0, 53, 0, 0, 53, 0, 53, 0, 53, 0, 0, 0, 0, 0, 0, 53, 53, 0, 53, 53, 0, 53, 53,
+			0, 53, 53, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 53, 0, 0, 0, 0, 61, 61, 54, 54, 0, 53, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0,
+			53, 0, 53, 0, 0, 53, 0, 53, 0, 53, 0, 0, 0, 0, 0, 0, 53, 53, 0, 53, 53, 0, 53, 53,
+			0, 53, 53, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 53, 0, 0, 53, 53, 53, 53, 0, 0, 0, 53, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+			0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 54, 54, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 54, 54, 54, 0, 0, 0, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+			49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 49, 49, 44, 0, 0, 49,
+			49, 0, 0, 0, 0, 0, 49, 49, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+			56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+			56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+			56, 56, 56, 56, 56, 56, 0, 0, 56, 0, 56, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0,
+			56, 0, 56, 0, 0, 56, 56, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+			56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+			56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+			56, 56, 56, 56, 56, 56, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+			56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+			56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 56, 21, 56,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0,
+			56, 56, 56, 56, 56, 0, 56, 0, 56, 56, 0, 56, 56, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 44, 44, 44, 44, 44, 44, 44, 49, 49,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 0, 0, 0, 0, 54, 54, 54, 0, 54, 0, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0,
+			0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 54, 54, 54, 54, 54, 54, 0, 0, 54, 54, 54, 54, 54, 54,
+			0, 0, 54, 54, 54, 54, 54, 54, 0, 0, 54, 54, 54, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 0,
+			54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0,
+			0, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 44, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			49, 1, 44, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 49, 49, 49, 44, 49, 44, 44, 44,
+			44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 49, 44, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 60, 0, 0, 0, 0, 0,
+			49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 53, 53,
+			0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 3, 3, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 4, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49,
+			49, 49, 49, 49, 49, 0, 0, 0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 4, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 58, 53, 53, 58, 53, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			58, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 3, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 3, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 42, 42, 1, 1, 1, 0, 0, 0, 47, 42, 42,
+			42, 42, 42, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 49, 49, 49,
+			49, 49, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 56, 56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 0, 0, 54, 0, 0, 54, 54, 0,
+			0, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 0, 54, 54, 54,
+			54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54,
+			54, 54, 54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 0, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 0, 54, 0, 0, 0, 54, 54, 54, 54, 54, 54,
+			54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 49, 49, 49, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+			49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 49, 49, 49, 49, 49, 49, 49, 0, 49, 49, 0, 49, 49,
+			49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 0, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			0, 54, 54, 0, 54, 0, 0, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54,
+			0, 54, 0, 54, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 54, 0, 54, 0, 54, 0, 54, 54, 54,
+			0, 54, 54, 0, 54, 0, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 54, 0, 54, 0, 0, 54,
+			54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 0, 54, 54, 54, 54, 0, 54, 0,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 0, 0, 0, 0, 0, 54, 54, 54, 0, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+			54, 54, 54, 54, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0,
+			54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56,
+			56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0,
+		};
+
+		// Full canonical decompositions (NFD) except Hangul: code point << 32 | pool offset << 8 | length
+		inline constexpr uint64_t canonical_decompositions[2061] = {
+			0x000000C000000002, 0x000000C100000202, 0x000000C200000402, 0x000000C300000602,
+			0x000000C400000802, 0x000000C500000A02, 0x000000C700000C02, 0x000000C800000E02,
+			0x000000C900001002, 0x000000CA00001202, 0x000000CB00001402, 0x000000CC00001602,
+			0x000000CD00001802, 0x000000CE00001A02, 0x000000CF00001C02, 0x000000D100001E02,
+			0x000000D200002002, 0x000000D300002202, 0x000000D400002402, 0x000000D500002602,
+			0x000000D600002802, 0x000000D900002A02, 0x000000DA00002C02, 0x000000DB00002E02,
+			0x000000DC00003002, 0x000000DD00003202, 0x000000E000003402, 0x000000E100003602,
+			0x000000E200003802, 0x000000E300003A02, 0x000000E400003C02, 0x000000E500003E02,
+			0x000000E700004002, 0x000000E800004202, 0x000000E900004402, 0x000000EA00004602,
+			0x000000EB00004802, 0x000000EC00004A02, 0x000000ED00004C02, 0x000000EE00004E02,
+			0x000000EF00005002, 0x000000F100005202, 0x000000F200005402, 0x000000F300005602,
+			0x000000F400005802, 0x000000F500005A02, 0x000000F600005C02, 0x000000F900005E02,
+			0x000000FA00006002, 0x000000FB00006202, 0x000000FC00006402, 0x000000FD00006602,
+			0x000000FF00006802, 0x0000010000006A02, 0x0000010100006C02, 0x0000010200006E02,
+			0x0000010300007002, 0x0000010400007202, 0x0000010500007402, 0x0000010600007602,
+			0x0000010700007802, 0x0000010800007A02, 0x0000010900007C02, 0x0000010A00007E02,
+			0x0000010B00008002, 0x0000010C00008202, 0x0000010D00008402, 0x0000010E00008602,
+			0x0000010F00008802, 0x0000011200008A02, 0x0000011300008C02, 0x0000011400008E02,
+			0x0000011500009002, 0x0000011600009202, 0x0000011700009402, 0x0000011800009602,
+			0x0000011900009802, 0x0000011A00009A02, 0x0000011B00009C02, 0x0000011C00009E02,
+			0x0000011D0000A002, 0x0000011E0000A202, 0x0000011F0000A402, 0x000001200000A602,
+			0x000001210000A802, 0x000001220000AA02, 0x000001230000AC02, 0x000001240000AE02,
+			0x000001250000B002, 0x000001280000B202, 0x000001290000B402, 0x0000012A0000B602,
+			0x0000012B0000B802, 0x0000012C0000BA02, 0x0000012D0000BC02, 0x0000012E0000BE02,
+			0x0000012F0000C002, 0x000001300000C202, 0x000001340000C402, 0x000001350000C602,
+			0x000001360000C802, 0x000001370000CA02, 0x000001390000CC02, 0x0000013A0000CE02,
+			0x0000013B0000D002, 0x0000013C0000D202, 0x0000013D0000D402, 0x0000013E0000D602,
+			0x000001430000D802, 0x000001440000DA02, 0x000001450000DC02, 0x000001460000DE02,
+			0x000001470000E002, 0x000001480000E202, 0x0000014C0000E402, 0x0000014D0000E602,
+			0x0000014E0000E802, 0x0000014F0000EA02, 0x000001500000EC02, 0x000001510000EE02,
+			0x000001540000F002, 0x000001550000F202, 0x000001560000F402, 0x000001570000F602,
+			0x000001580000F802, 0x000001590000FA02, 0x0000015A0000FC02, 0x0000015B0000FE02,
+			0x0000015C00010002, 0x0000015D00010202, 0x0000015E00010402, 0x0000015F00010602,
+			0x0000016000010802, 0x0000016100010A02, 0x0000016200010C02, 0x0000016300010E02,
+			0x0000016400011002, 0x0000016500011202, 0x0000016800011402, 0x0000016900011602,
+			0x0000016A00011802, 0x0000016B00011A02, 0x0000016C00011C02, 0x0000016D00011E02,
+			0x0000016E00012002, 0x0000016F00012202, 0x0000017000012402, 0x0000017100012602,
+			0x0000017200012802, 0x0000017300012A02, 0x0000017400012C02, 0x0000017500012E02,
+			0x0000017600013002, 0x0000017700013202, 0x0000017800013402, 0x0000017900013602,
+			0x0000017A00013802, 0x0000017B00013A02, 0x0000017C00013C02, 0x0000017D00013E02,
+			0x0000017E00014002, 0x000001A000014202, 0x000001A100014402, 0x000001AF00014602,
+			0x000001B000014802, 0x000001CD00014A02, 0x000001CE00014C02, 0x000001CF00014E02,
+			0x000001D000015002, 0x000001D100015202, 0x000001D200015402, 0x000001D300015602,
+			0x000001D400015802, 0x000001D500015A03, 0x000001D600015D03, 0x000001D700016003,
+			0x000001D800016303, 0x000001D900016603, 0x000001DA00016903, 0x000001DB00016C03,
+			0x000001DC00016F03, 0x000001DE00017203, 0x000001DF00017503, 0x000001E000017803,
+			0x000001E100017B03, 0x000001E200017E02, 0x000001E300018002, 0x000001E600018202,
+			0x000001E700018402, 0x000001E800018602, 0x000001E900018802, 0x000001EA00018A02,
+			0x000001EB00018C02, 0x000001EC00018E03, 0x000001ED00019103, 0x000001EE00019402,
+			0x000001EF00019602, 0x000001F000019802, 0x000001F400019A02, 0x000001F500019C02,
+			0x000001F800019E02, 0x000001F90001A002, 0x000001FA0001A203, 0x000001FB0001A503,
+			0x000001FC0001A802, 0x000001FD0001AA02, 0x000001FE0001AC02, 0x000001FF0001AE02,
+			0x000002000001B002, 0x000002010001B202, 0x000002020001B402, 0x000002030001B602,
+			0x000002040001B802, 0x000002050001BA02, 0x000002060001BC02, 0x000002070001BE02,
+			0x000002080001C002, 0x000002090001C202, 0x0000020A0001C402, 0x0000020B0001C602,
+			0x0000020C0001C802, 0x0000020D0001CA02, 0x0000020E0001CC02, 0x0000020F0001CE02,
+			0x000002100001D002, 0x000002110001D202, 0x000002120001D402, 0x000002130001D602,
+			0x000002140001D802, 0x000002150001DA02, 0x000002160001DC02, 0x000002170001DE02,
+			0x000002180001E002, 0x000002190001E202, 0x0000021A0001E402, 0x0000021B0001E602,
+			0x0000021E0001E802, 0x0000021F0001EA02, 0x000002260001EC02, 0x000002270001EE02,
+			0x000002280001F002, 0x000002290001F202, 0x0000022A0001F403, 0x0000022B0001F703,
+			0x0000022C0001FA03, 0x0000022D0001FD03, 0x0000022E00020002, 0x0000022F00020202,
+			0x0000023000020403, 0x0000023100020703, 0x0000023200020A02, 0x0000023300020C02,
+			0x0000034000020E01, 0x0000034100020F01, 0x0000034300021001, 0x0000034400021102,
+			0x0000037400021301, 0x0000037E00021401, 0x0000038500021502, 0x0000038600021702,
+			0x0000038700021901, 0x0000038800021A02, 0x0000038900021C02, 0x0000038A00021E02,
+			0x0000038C00022002, 0x0000038E00022202, 0x0000038F00022402, 0x0000039000022603,
+			0x000003AA00022902, 0x000003AB00022B02, 0x000003AC00022D02, 0x000003AD00022F02,
+			0x000003AE00023102, 0x000003AF00023302, 0x000003B000023503, 0x000003CA00023802,
+			0x000003CB00023A02, 0x000003CC00023C02, 0x000003CD00023E02, 0x000003CE00024002,
+			0x000003D300024202, 0x000003D400024402, 0x0000040000024602, 0x0000040100024802,
+			0x0000040300024A02, 0x0000040700024C02, 0x0000040C00024E02, 0x0000040D00025002,
+			0x0000040E00025202, 0x0000041900025402, 0x0000043900025602, 0x0000045000025802,
+			0x0000045100025A02, 0x0000045300025C02, 0x0000045700025E02, 0x0000045C00026002,
+			0x0000045D00026202, 0x0000045E00026402, 0x0000047600026602, 0x0000047700026802,
+			0x000004C100026A02, 0x000004C200026C02, 0x000004D000026E02, 0x000004D100027002,
+			0x000004D200027202, 0x000004D300027402, 0x000004D600027602, 0x000004D700027802,
+			0x000004DA00027A02, 0x000004DB00027C02, 0x000004DC00027E02, 0x000004DD00028002,
+			0x000004DE00028202, 0x000004DF00028402, 0x000004E200028602, 0x000004E300028802,
+			0x000004E400028A02, 0x000004E500028C02, 0x000004E600028E02, 0x000004E700029002,
+			0x000004EA00029202, 0x000004EB00029402, 0x000004EC00029602, 0x000004ED00029802,
+			0x000004EE00029A02, 0x000004EF00029C02, 0x000004F000029E02, 0x000004F10002A002,
+			0x000004F20002A202, 0x000004F30002A402, 0x000004F40002A602, 0x000004F50002A802,
+			0x000004F80002AA02, 0x000004F90002AC02, 0x000006220002AE02, 0x000006230002B002,
+			0x000006240002B202, 0x000006250002B402, 0x000006260002B602, 0x000006C00002B802,
+			0x000006C20002BA02, 0x000006D30002BC02, 0x000009290002BE02, 0x000009310002C002,
+			0x000009340002C202, 0x000009580002C402, 0x000009590002C602, 0x0000095A0002C802,
+			0x0000095B0002CA02, 0x0000095C0002CC02, 0x0000095D0002CE02, 0x0000095E0002D002,
+			0x0000095F0002D202, 0x000009CB0002D402, 0x000009CC0002D602, 0x000009DC0002D802,
+			0x000009DD0002DA02, 0x000009DF0002DC02, 0x00000A330002DE02, 0x00000A360002E002,
+			0x00000A590002E202, 0x00000A5A0002E402, 0x00000A5B0002E602, 0x00000A5E0002E802,
+			0x00000B480002EA02, 0x00000B4B0002EC02, 0x00000B4C0002EE02, 0x00000B5C0002F002,
+			0x00000B5D0002F202, 0x00000B940002F402, 0x00000BCA0002F602, 0x00000BCB0002F802,
+			0x00000BCC0002FA02, 0x00000C480002FC02, 0x00000CC00002FE02, 0x00000CC700030002,
+			0x00000CC800030202, 0x00000CCA00030402, 0x00000CCB00030603, 0x00000D4A00030902,
+			0x00000D4B00030B02, 0x00000D4C00030D02, 0x00000DDA00030F02, 0x00000DDC00031102,
+			0x00000DDD00031303, 0x00000DDE00031602, 0x00000F4300031802, 0x00000F4D00031A02,
+			0x00000F5200031C02, 0x00000F5700031E02, 0x00000F5C00032002, 0x00000F6900032202,
+			0x00000F7300032402, 0x00000F7500032602, 0x00000F7600032802, 0x00000F7800032A02,
+			0x00000F8100032C02, 0x00000F9300032E02, 0x00000F9D00033002, 0x00000FA200033202,
+			0x00000FA700033402, 0x00000FAC00033602, 0x00000FB900033802, 0x0000102600033A02,
+			0x00001B0600033C02, 0x00001B0800033E02, 0x00001B0A00034002, 0x00001B0C00034202,
+			0x00001B0E00034402, 0x00001B1200034602, 0x00001B3B00034802, 0x00001B3D00034A02,
+			0x00001B4000034C02, 0x00001B4100034E02, 0x00001B4300035002, 0x00001E0000035202,
+			0x00001E0100035402, 0x00001E0200035602, 0x00001E0300035802, 0x00001E0400035A02,
+			0x00001E0500035C02, 0x00001E0600035E02, 0x00001E0700036002, 0x00001E0800036203,
+			0x00001E0900036503, 0x00001E0A00036802, 0x00001E0B00036A02, 0x00001E0C00036C02,
+			0x00001E0D00036E02, 0x00001E0E00037002, 0x00001E0F00037202, 0x00001E1000037402,
+			0x00001E1100037602, 0x00001E1200037802, 0x00001E1300037A02, 0x00001E1400037C03,
+			0x00001E1500037F03, 0x00001E1600038203, 0x00001E1700038503, 0x00001E1800038802,
+			0x00001E1900038A02, 0x00001E1A00038C02, 0x00001E1B00038E02, 0x00001E1C00039003,
+			0x00001E1D00039303, 0x00001E1E00039602, 0x00001E1F00039802, 0x00001E2000039A02,
+			0x00001E2100039C02, 0x00001E2200039E02, 0x00001E230003A002, 0x00001E240003A202,
+			0x00001E250003A402, 0x00001E260003A602, 0x00001E270003A802, 0x00001E280003AA02,
+			0x00001E290003AC02, 0x00001E2A0003AE02, 0x00001E2B0003B002, 0x00001E2C0003B202,
+			0x00001E2D0003B402, 0x00001E2E0003B603, 0x00001E2F0003B903, 0x00001E300003BC02,
+			0x00001E310003BE02, 0x00001E320003C002, 0x00001E330003C202, 0x00001E340003C402,
+			0x00001E350003C602, 0x00001E360003C802, 0x00001E370003CA02, 0x00001E380003CC03,
+			0x00001E390003CF03, 0x00001E3A0003D202, 0x00001E3B0003D402, 0x00001E3C0003D602,
+			0x00001E3D0003D802, 0x00001E3E0003DA02, 0x00001E3F0003DC02, 0x00001E400003DE02,
+			0x00001E410003E002, 0x00001E420003E202, 0x00001E430003E402, 0x00001E440003E602,
+			0x00001E450003E802, 0x00001E460003EA02, 0x00001E470003EC02, 0x00001E480003EE02,
+			0x00001E490003F002, 0x00001E4A0003F202, 0x00001E4B0003F402, 0x00001E4C0003F603,
+			0x00001E4D0003F903, 0x00001E4E0003FC03, 0x00001E4F0003FF03, 0x00001E5000040203,
+			0x00001E5100040503, 0x00001E5200040803, 0x00001E5300040B03, 0x00001E5400040E02,
+			0x00001E5500041002, 0x00001E5600041202, 0x00001E5700041402, 0x00001E5800041602,
+			0x00001E5900041802, 0x00001E5A00041A02, 0x00001E5B00041C02, 0x00001E5C00041E03,
+			0x00001E5D00042103, 0x00001E5E00042402, 0x00001E5F00042602, 0x00001E6000042802,
+			0x00001E6100042A02, 0x00001E6200042C02, 0x00001E6300042E02, 0x00001E6400043003,
+			0x00001E6500043303, 0x00001E6600043603, 0x00001E6700043903, 0x00001E6800043C03,
+			0x00001E6900043F03, 0x00001E6A00044202, 0x00001E6B00044402, 0x00001E6C00044602,
+			0x00001E6D00044802, 0x00001E6E00044A02, 0x00001E6F00044C02, 0x00001E7000044E02,
+			0x00001E7100045002, 0x00001E7200045202, 0x00001E7300045402, 0x00001E7400045602,
+			0x00001E7500045802, 0x00001E7600045A02, 0x00001E7700045C02, 0x00001E7800045E03,
+			0x00001E7900046103, 0x00001E7A00046403, 0x00001E7B00046703, 0x00001E7C00046A02,
+			0x00001E7D00046C02, 0x00001E7E00046E02, 0x00001E7F00047002, 0x00001E8000047202,
+			0x00001E8100047402, 0x00001E8200047602, 0x00001E8300047802, 0x00001E8400047A02,
+			0x00001E8500047C02, 0x00001E8600047E02, 0x00001E8700048002, 0x00001E8800048202,
+			0x00001E8900048402, 0x00001E8A00048602, 0x00001E8B00048802, 0x00001E8C00048A02,
+			0x00001E8D00048C02, 0x00001E8E00048E02, 0x00001E8F00049002, 0x00001E9000049202,
+			0x00001E9100049402, 0x00001E9200049602, 0x00001E9300049802, 0x00001E9400049A02,
+			0x00001E9500049C02, 0x00001E9600049E02, 0x00001E970004A002, 0x00001E980004A202,
+			0x00001E990004A402, 0x00001E9B0004A602, 0x00001EA00004A802, 0x00001EA10004AA02,
+			0x00001EA20004AC02, 0x00001EA30004AE02, 0x00001EA40004B003, 0x00001EA50004B303,
+			0x00001EA60004B603, 0x00001EA70004B903, 0x00001EA80004BC03, 0x00001EA90004BF03,
+			0x00001EAA0004C203, 0x00001EAB0004C503, 0x00001EAC0004C803, 0x00001EAD0004CB03,
+			0x00001EAE0004CE03, 0x00001EAF0004D103, 0x00001EB00004D403, 0x00001EB10004D703,
+			0x00001EB20004DA03, 0x00001EB30004DD03, 0x00001EB40004E003, 0x00001EB50004E303,
+			0x00001EB60004E603, 0x00001EB70004E903, 0x00001EB80004EC02, 0x00001EB90004EE02,
+			0x00001EBA0004F002, 0x00001EBB0004F202, 0x00001EBC0004F402, 0x00001EBD0004F602,
+			0x00001EBE0004F803, 0x00001EBF0004FB03, 0x00001EC00004FE03, 0x00001EC100050103,
+			0x00001EC200050403, 0x00001EC300050703, 0x00001EC400050A03, 0x00001EC500050D03,
+			0x00001EC600051003, 0x00001EC700051303, 0x00001EC800051602, 0x00001EC900051802,
+			0x00001ECA00051A02, 0x00001ECB00051C02, 0x00001ECC00051E02, 0x00001ECD00052002,
+			0x00001ECE00052202, 0x00001ECF00052402, 0x00001ED000052603, 0x00001ED100052903,
+			0x00001ED200052C03, 0x00001ED300052F03, 0x00001ED400053203, 0x00001ED500053503,
+			0x00001ED600053803, 0x00001ED700053B03, 0x00001ED800053E03, 0x00001ED900054103,
+			0x00001EDA00054403, 0x00001EDB00054703, 0x00001EDC00054A03, 0x00001EDD00054D03,
+			0x00001EDE00055003, 0x00001EDF00055303, 0x00001EE000055603, 0x00001EE100055903,
+			0x00001EE200055C03, 0x00001EE300055F03, 0x00001EE400056202, 0x00001EE500056402,
+			0x00001EE600056602, 0x00001EE700056802, 0x00001EE800056A03, 0x00001EE900056D03,
+			0x00001EEA00057003, 0x00001EEB00057303, 0x00001EEC00057603, 0x00001EED00057903,
+			0x00001EEE00057C03, 0x00001EEF00057F03, 0x00001EF000058203, 0x00001EF100058503,
+			0x00001EF200058802, 0x00001EF300058A02, 0x00001EF400058C02, 0x00001EF500058E02,
+			0x00001EF600059002, 0x00001EF700059202, 0x00001EF800059402, 0x00001EF900059602,
+			0x00001F0000059802, 0x00001F0100059A02, 0x00001F0200059C03, 0x00001F0300059F03,
+			0x00001F040005A203, 0x00001F050005A503, 0x00001F060005A803, 0x00001F070005AB03,
+			0x00001F080005AE02, 0x00001F090005B002, 0x00001F0A0005B203, 0x00001F0B0005B503,
+			0x00001F0C0005B803, 0x00001F0D0005BB03, 0x00001F0E0005BE03, 0x00001F0F0005C103,
+			0x00001F100005C402, 0x00001F110005C602, 0x00001F120005C803, 0x00001F130005CB03,
+			0x00001F140005CE03, 0x00001F150005D103, 0x00001F180005D402, 0x00001F190005D602,
+			0x00001F1A0005D803, 0x00001F1B0005DB03, 0x00001F1C0005DE03, 0x00001F1D0005E103,
+			0x00001F200005E402, 0x00001F210005E602, 0x00001F220005E803, 0x00001F230005EB03,
+			0x00001F240005EE03, 0x00001F250005F103, 0x00001F260005F403, 0x00001F270005F703,
+			0x00001F280005FA02, 0x00001F290005FC02, 0x00001F2A0005FE03, 0x00001F2B00060103,
+			0x00001F2C00060403, 0x00001F2D00060703, 0x00001F2E00060A03, 0x00001F2F00060D03,
+			0x00001F3000061002, 0x00001F3100061202, 0x00001F3200061403, 0x00001F3300061703,
+			0x00001F3400061A03, 0x00001F3500061D03, 0x00001F3600062003, 0x00001F3700062303,
+			0x00001F3800062602, 0x00001F3900062802, 0x00001F3A00062A03, 0x00001F3B00062D03,
+			0x00001F3C00063003, 0x00001F3D00063303, 0x00001F3E00063603, 0x00001F3F00063903,
+			0x00001F4000063C02, 0x00001F4100063E02, 0x00001F4200064003, 0x00001F4300064303,
+			0x00001F4400064603, 0x00001F4500064903, 0x00001F4800064C02, 0x00001F4900064E02,
+			0x00001F4A00065003, 0x00001F4B00065303, 0x00001F4C00065603, 0x00001F4D00065903,
+			0x00001F5000065C02, 0x00001F5100065E02, 0x00001F5200066003, 0x00001F5300066303,
+			0x00001F5400066603, 0x00001F5500066903, 0x00001F5600066C03, 0x00001F5700066F03,
+			0x00001F5900067202, 0x00001F5B00067403, 0x00001F5D00067703, 0x00001F5F00067A03,
+			0x00001F6000067D02, 0x00001F6100067F02, 0x00001F6200068103, 0x00001F6300068403,
+			0x00001F6400068703, 0x00001F6500068A03, 0x00001F6600068D03, 0x00001F6700069003,
+			0x00001F6800069302, 0x00001F6900069502, 0x00001F6A00069703, 0x00001F6B00069A03,
+			0x00001F6C00069D03, 0x00001F6D0006A003, 0x00001F6E0006A303, 0x00001F6F0006A603,
+			0x00001F700006A902, 0x00001F710006AB02, 0x00001F720006AD02, 0x00001F730006AF02,
+			0x00001F740006B102, 0x00001F750006B302, 0x00001F760006B502, 0x00001F770006B702,
+			0x00001F780006B902, 0x00001F790006BB02, 0x00001F7A0006BD02, 0x00001F7B0006BF02,
+			0x00001F7C0006C102, 0x00001F7D0006C302, 0x00001F800006C503, 0x00001F810006C803,
+			0x00001F820006CB04, 0x00001F830006CF04, 0x00001F840006D304, 0x00001F850006D704,
+			0x00001F860006DB04, 0x00001F870006DF04, 0x00001F880006E303, 0x00001F890006E603,
+			0x00001F8A0006E904, 0x00001F8B0006ED04, 0x00001F8C0006F104, 0x00001F8D0006F504,
+			0x00001F8E0006F904, 0x00001F8F0006FD04, 0x00001F9000070103, 0x00001F9100070403,
+			0x00001F9200070704, 0x00001F9300070B04, 0x00001F9400070F04, 0x00001F9500071304,
+			0x00001F9600071704, 0x00001F9700071B04, 0x00001F9800071F03, 0x00001F9900072203,
+			0x00001F9A00072504, 0x00001F9B00072904, 0x00001F9C00072D04, 0x00001F9D00073104,
+			0x00001F9E00073504, 0x00001F9F00073904, 0x00001FA000073D03, 0x00001FA100074003,
+			0x00001FA200074304, 0x00001FA300074704, 0x00001FA400074B04, 0x00001FA500074F04,
+			0x00001FA600075304, 0x00001FA700075704, 0x00001FA800075B03, 0x00001FA900075E03,
+			0x00001FAA00076104, 0x00001FAB00076504, 0x00001FAC00076904, 0x00001FAD00076D04,
+			0x00001FAE00077104, 0x00001FAF00077504, 0x00001FB000077902, 0x00001FB100077B02,
+			0x00001FB200077D03, 0x00001FB300078002, 0x00001FB400078203, 0x00001FB600078502,
+			0x00001FB700078703, 0x00001FB800078A02, 0x00001FB900078C02, 0x00001FBA00078E02,
+			0x00001FBB00079002, 0x00001FBC00079202, 0x00001FBE00079401, 0x00001FC100079502,
+			0x00001FC200079703, 0x00001FC300079A02, 0x00001FC400079C03, 0x00001FC600079F02,
+			0x00001FC70007A103, 0x00001FC80007A402, 0x00001FC90007A602, 0x00001FCA0007A802,
+			0x00001FCB0007AA02, 0x00001FCC0007AC02, 0x00001FCD0007AE02, 0x00001FCE0007B002,
+			0x00001FCF0007B202, 0x00001FD00007B402, 0x00001FD10007B602, 0x00001FD20007B803,
+			0x00001FD30007BB03, 0x00001FD60007BE02, 0x00001FD70007C003, 0x00001FD80007C302,
+			0x00001FD90007C502, 0x00001FDA0007C702, 0x00001FDB0007C902, 0x00001FDD0007CB02,
+			0x00001FDE0007CD02, 0x00001FDF0007CF02, 0x00001FE00007D102, 0x00001FE10007D302,
+			0x00001FE20007D503, 0x00001FE30007D803, 0x00001FE40007DB02, 0x00001FE50007DD02,
+			0x00001FE60007DF02, 0x00001FE70007E103, 0x00001FE80007E402, 0x00001FE90007E602,
+			0x00001FEA0007E802, 0x00001FEB0007EA02, 0x00001FEC0007EC02, 0x00001FED0007EE02,
+			0x00001FEE0007F002, 0x00001FEF0007F201, 0x00001FF20007F303, 0x00001FF30007F602,
+			0x00001FF40007F803, 0x00001FF60007FB02, 0x00001FF70007FD03, 0x00001FF800080002,
+			0x00001FF900080202, 0x00001FFA00080402, 0x00001FFB00080602, 0x00001FFC00080802,
+			0x00001FFD00080A01, 0x0000200000080B01, 0x0000200100080C01, 0x0000212600080D01,
+			0x0000212A00080E01, 0x0000212B00080F02, 0x0000219A00081102, 0x0000219B00081302,
+			0x000021AE00081502, 0x000021CD00081702, 0x000021CE00081902, 0x000021CF00081B02,
+			0x0000220400081D02, 0x0000220900081F02, 0x0000220C00082102, 0x0000222400082302,
+			0x0000222600082502, 0x0000224100082702, 0x0000224400082902, 0x0000224700082B02,
+			0x0000224900082D02, 0x0000226000082F02, 0x0000226200083102, 0x0000226D00083302,
+			0x0000226E00083502, 0x0000226F00083702, 0x0000227000083902, 0x0000227100083B02,
+			0x0000227400083D02, 0x0000227500083F02, 0x0000227800084102, 0x0000227900084302,
+			0x0000228000084502, 0x0000228100084702, 0x0000228400084902, 0x0000228500084B02,
+			0x0000228800084D02, 0x0000228900084F02, 0x000022AC00085102, 0x000022AD00085302,
+			0x000022AE00085502, 0x000022AF00085702, 0x000022E000085902, 0x000022E100085B02,
+			0x000022E200085D02, 0x000022E300085F02, 0x000022EA00086102, 0x000022EB00086302,
+			0x000022EC00086502, 0x000022ED00086702, 0x0000232900086901, 0x0000232A00086A01,
+			0x00002ADC00086B02, 0x0000304C00086D02, 0x0000304E00086F02, 0x0000305000087102,
+			0x0000305200087302, 0x0000305400087502, 0x0000305600087702, 0x0000305800087902,
+			0x0000305A00087B02, 0x0000305C00087D02, 0x0000305E00087F02, 0x0000306000088102,
+			0x0000306200088302, 0x0000306500088502, 0x0000306700088702, 0x0000306900088902,
+			0x0000307000088B02, 0x0000307100088D02, 0x0000307300088F02, 0x0000307400089102,
+			0x0000307600089302, 0x0000307700089502, 0x0000307900089702, 0x0000307A00089902,
+			0x0000307C00089B02, 0x0000307D00089D02, 0x0000309400089F02, 0x0000309E0008A102,
+			0x000030AC0008A302, 0x000030AE0008A502, 0x000030B00008A702, 0x000030B20008A902,
+			0x000030B40008AB02, 0x000030B60008AD02, 0x000030B80008AF02, 0x000030BA0008B102,
+			0x000030BC0008B302, 0x000030BE0008B502, 0x000030C00008B702, 0x000030C20008B902,
+			0x000030C50008BB02, 0x000030C70008BD02, 0x000030C90008BF02, 0x000030D00008C102,
+			0x000030D10008C302, 0x000030D30008C502, 0x000030D40008C702, 0x000030D60008C902,
+			0x000030D70008CB02, 0x000030D90008CD02, 0x000030DA0008CF02, 0x000030DC0008D102,
+			0x000030DD0008D302, 0x000030F40008D502, 0x000030F70008D702, 0x000030F80008D902,
+			0x000030F90008DB02, 0x000030FA0008DD02, 0x000030FE0008DF02, 0x0000F9000008E101,
+			0x0000F9010008E201, 0x0000F9020008E301, 0x0000F9030008E401, 0x0000F9040008E501,
+			0x0000F9050008E601, 0x0000F9060008E701, 0x0000F9070008E801, 0x0000F9080008E901,
+			0x0000F9090008EA01, 0x0000F90A0008EB01, 0x0000F90B0008EC01, 0x0000F90C0008ED01,
+			0x0000F90D0008EE01, 0x0000F90E0008EF01, 0x0000F90F0008F001, 0x0000F9100008F101,
+			0x0000F9110008F201, 0x0000F9120008F301, 0x0000F9130008F401, 0x0000F9140008F501,
+			0x0000F9150008F601, 0x0000F9160008F701, 0x0000F9170008F801, 0x0000F9180008F901,
+			0x0000F9190008FA01, 0x0000F91A0008FB01, 0x0000F91B0008FC01, 0x0000F91C0008FD01,
+			0x0000F91D0008FE01, 0x0000F91E0008FF01, 0x0000F91F00090001, 0x0000F92000090101,
+			0x0000F92100090201, 0x0000F92200090301, 0x0000F92300090401, 0x0000F92400090501,
+			0x0000F92500090601, 0x0000F92600090701, 0x0000F92700090801, 0x0000F92800090901,
+			0x0000F92900090A01, 0x0000F92A00090B01, 0x0000F92B00090C01, 0x0000F92C00090D01,
+			0x0000F92D00090E01, 0x0000F92E00090F01, 0x0000F92F00091001, 0x0000F93000091101,
+			0x0000F93100091201, 0x0000F93200091301, 0x0000F93300091401, 0x0000F93400091501,
+			0x0000F93500091601, 0x0000F93600091701, 0x0000F93700091801, 0x0000F93800091901,
+			0x0000F93900091A01, 0x0000F93A00091B01, 0x0000F93B00091C01, 0x0000F93C00091D01,
+			0x0000F93D00091E01, 0x0000F93E00091F01, 0x0000F93F00092001, 0x0000F94000092101,
+			0x0000F94100092201, 0x0000F94200092301, 0x0000F94300092401, 0x0000F94400092501,
+			0x0000F94500092601, 0x0000F94600092701, 0x0000F94700092801, 0x0000F94800092901,
+			0x0000F94900092A01, 0x0000F94A00092B01, 0x0000F94B00092C01, 0x0000F94C00092D01,
+			0x0000F94D00092E01, 0x0000F94E00092F01, 0x0000F94F00093001, 0x0000F95000093101,
+			0x0000F95100093201, 0x0000F95200093301, 0x0000F95300093401, 0x0000F95400093501,
+			0x0000F95500093601, 0x0000F95600093701, 0x0000F95700093801, 0x0000F95800093901,
+			0x0000F95900093A01, 0x0000F95A00093B01, 0x0000F95B00093C01, 0x0000F95C00093D01,
+			0x0000F95D00093E01, 0x0000F95E00093F01, 0x0000F95F00094001, 0x0000F96000094101,
+			0x0000F96100094201, 0x0000F96200094301, 0x0000F96300094401, 0x0000F96400094501,
+			0x0000F96500094601, 0x0000F96600094701, 0x0000F96700094801, 0x0000F96800094901,
+			0x0000F96900094A01, 0x0000F96A00094B01, 0x0000F96B00094C01, 0x0000F96C00094D01,
+			0x0000F96D00094E01, 0x0000F96E00094F01, 0x0000F96F00095001, 0x0000F97000095101,
+			0x0000F97100095201, 0x0000F97200095301, 0x0000F97300095401, 0x0000F97400095501,
+			0x0000F97500095601, 0x0000F97600095701, 0x0000F97700095801, 0x0000F97800095901,
+			0x0000F97900095A01, 0x0000F97A00095B01, 0x0000F97B00095C01, 0x0000F97C00095D01,
+			0x0000F97D00095E01, 0x0000F97E00095F01, 0x0000F97F00096001, 0x0000F98000096101,
+			0x0000F98100096201, 0x0000F98200096301, 0x0000F98300096401, 0x0000F98400096501,
+			0x0000F98500096601, 0x0000F98600096701, 0x0000F98700096801, 0x0000F98800096901,
+			0x0000F98900096A01, 0x0000F98A00096B01, 0x0000F98B00096C01, 0x0000F98C00096D01,
+			0x0000F98D00096E01, 0x0000F98E00096F01, 0x0000F98F00097001, 0x0000F99000097101,
+			0x0000F99100097201, 0x0000F99200097301, 0x0000F99300097401, 0x0000F99400097501,
+			0x0000F99500097601, 0x0000F99600097701, 0x0000F99700097801, 0x0000F99800097901,
+			0x0000F99900097A01, 0x0000F99A00097B01, 0x0000F99B00097C01, 0x0000F99C00097D01,
+			0x0000F99D00097E01, 0x0000F99E00097F01, 0x0000F99F00098001, 0x0000F9A000098101,
+			0x0000F9A100098201, 0x0000F9A200098301, 0x0000F9A300098401, 0x0000F9A400098501,
+			0x0000F9A500098601, 0x0000F9A600098701, 0x0000F9A700098801, 0x0000F9A800098901,
+			0x0000F9A900098A01, 0x0000F9AA00098B01, 0x0000F9AB00098C01, 0x0000F9AC00098D01,
+			0x0000F9AD00098E01, 0x0000F9AE00098F01, 0x0000F9AF00099001, 0x0000F9B000099101,
+			0x0000F9B100099201, 0x0000F9B200099301, 0x0000F9B300099401, 0x0000F9B400099501,
+			0x0000F9B500099601, 0x0000F9B600099701, 0x0000F9B700099801, 0x0000F9B800099901,
+			0x0000F9B900099A01, 0x0000F9BA00099B01, 0x0000F9BB00099C01, 0x0000F9BC00099D01,
+			0x0000F9BD00099E01, 0x0000F9BE00099F01, 0x0000F9BF0009A001, 0x0000F9C00009A101,
+			0x0000F9C10009A201, 0x0000F9C20009A301, 0x0000F9C30009A401, 0x0000F9C40009A501,
+			0x0000F9C50009A601, 0x0000F9C60009A701, 0x0000F9C70009A801, 0x0000F9C80009A901,
+			0x0000F9C90009AA01, 0x0000F9CA0009AB01, 0x0000F9CB0009AC01, 0x0000F9CC0009AD01,
+			0x0000F9CD0009AE01, 0x0000F9CE0009AF01, 0x0000F9CF0009B001, 0x0000F9D00009B101,
+			0x0000F9D10009B201, 0x0000F9D20009B301, 0x0000F9D30009B401, 0x0000F9D40009B501,
+			0x0000F9D50009B601, 0x0000F9D60009B701, 0x0000F9D70009B801, 0x0000F9D80009B901,
+			0x0000F9D90009BA01, 0x0000F9DA0009BB01, 0x0000F9DB0009BC01, 0x0000F9DC0009BD01,
+			0x0000F9DD0009BE01, 0x0000F9DE0009BF01, 0x0000F9DF0009C001, 0x0000F9E00009C101,
+			0x0000F9E10009C201, 0x0000F9E20009C301, 0x0000F9E30009C401, 0x0000F9E40009C501,
+			0x0000F9E50009C601, 0x0000F9E60009C701, 0x0000F9E70009C801, 0x0000F9E80009C901,
+			0x0000F9E90009CA01, 0x0000F9EA0009CB01, 0x0000F9EB0009CC01, 0x0000F9EC0009CD01,
+			0x0000F9ED0009CE01, 0x0000F9EE0009CF01, 0x0000F9EF0009D001, 0x0000F9F00009D101,
+			0x0000F9F10009D201, 0x0000F9F20009D301, 0x0000F9F30009D401, 0x0000F9F40009D501,
+			0x0000F9F50009D601, 0x0000F9F60009D701, 0x0000F9F70009D801, 0x0000F9F80009D901,
+			0x0000F9F90009DA01, 0x0000F9FA0009DB01, 0x0000F9FB0009DC01, 0x0000F9FC0009DD01,
+			0x0000F9FD0009DE01, 0x0000F9FE0009DF01, 0x0000F9FF0009E001, 0x0000FA000009E101,
+			0x0000FA010009E201, 0x0000FA020009E301, 0x0000FA030009E401, 0x0000FA040009E501,
+			0x0000FA050009E601, 0x0000FA060009E701, 0x0000FA070009E801, 0x0000FA080009E901,
+			0x0000FA090009EA01, 0x0000FA0A0009EB01, 0x0000FA0B0009EC01, 0x0000FA0C0009ED01,
+			0x0000FA0D0009EE01, 0x0000FA100009EF01, 0x0000FA120009F001, 0x0000FA150009F101,
+			0x0000FA160009F201, 0x0000FA170009F301, 0x0000FA180009F401, 0x0000FA190009F501,
+			0x0000FA1A0009F601, 0x0000FA1B0009F701, 0x0000FA1C0009F801, 0x0000FA1D0009F901,
+			0x0000FA1E0009FA01, 0x0000FA200009FB01, 0x0000FA220009FC01, 0x0000FA250009FD01,
+			0x0000FA260009FE01, 0x0000FA2A0009FF01, 0x0000FA2B000A0001, 0x0000FA2C000A0101,
+			0x0000FA2D000A0201, 0x0000FA2E000A0301, 0x0000FA2F000A0401, 0x0000FA30000A0501,
+			0x0000FA31000A0601, 0x0000FA32000A0701, 0x0000FA33000A0801, 0x0000FA34000A0901,
+			0x0000FA35000A0A01, 0x0000FA36000A0B01, 0x0000FA37000A0C01, 0x0000FA38000A0D01,
+			0x0000FA39000A0E01, 0x0000FA3A000A0F01, 0x0000FA3B000A1001, 0x0000FA3C000A1101,
+			0x0000FA3D000A1201, 0x0000FA3E000A1301, 0x0000FA3F000A1401, 0x0000FA40000A1501,
+			0x0000FA41000A1601, 0x0000FA42000A1701, 0x0000FA43000A1801, 0x0000FA44000A1901,
+			0x0000FA45000A1A01, 0x0000FA46000A1B01, 0x0000FA47000A1C01, 0x0000FA48000A1D01,
+			0x0000FA49000A1E01, 0x0000FA4A000A1F01, 0x0000FA4B000A2001, 0x0000FA4C000A2101,
+			0x0000FA4D000A2201, 0x0000FA4E000A2301, 0x0000FA4F000A2401, 0x0000FA50000A2501,
+			0x0000FA51000A2601, 0x0000FA52000A2701, 0x0000FA53000A2801, 0x0000FA54000A2901,
+			0x0000FA55000A2A01, 0x0000FA56000A2B01, 0x0000FA57000A2C01, 0x0000FA58000A2D01,
+			0x0000FA59000A2E01, 0x0000FA5A000A2F01, 0x0000FA5B000A3001, 0x0000FA5C000A3101,
+			0x0000FA5D000A3201, 0x0000FA5E000A3301, 0x0000FA5F000A3401, 0x0000FA60000A3501,
+			0x0000FA61000A3601, 0x0000FA62000A3701, 0x0000FA63000A3801, 0x0000FA64000A3901,
+			0x0000FA65000A3A01, 0x0000FA66000A3B01, 0x0000FA67000A3C01, 0x0000FA68000A3D01,
+			0x0000FA69000A3E01, 0x0000FA6A000A3F01, 0x0000FA6B000A4001, 0x0000FA6C000A4101,
+			0x0000FA6D000A4201, 0x0000FA70000A4301, 0x0000FA71000A4401, 0x0000FA72000A4501,
+			0x0000FA73000A4601, 0x0000FA74000A4701, 0x0000FA75000A4801, 0x0000FA76000A4901,
+			0x0000FA77000A4A01, 0x0000FA78000A4B01, 0x0000FA79000A4C01, 0x0000FA7A000A4D01,
+			0x0000FA7B000A4E01, 0x0000FA7C000A4F01, 0x0000FA7D000A5001, 0x0000FA7E000A5101,
+			0x0000FA7F000A5201, 0x0000FA80000A5301, 0x0000FA81000A5401, 0x0000FA82000A5501,
+			0x0000FA83000A5601, 0x0000FA84000A5701, 0x0000FA85000A5801, 0x0000FA86000A5901,
+			0x0000FA87000A5A01, 0x0000FA88000A5B01, 0x0000FA89000A5C01, 0x0000FA8A000A5D01,
+			0x0000FA8B000A5E01, 0x0000FA8C000A5F01, 0x0000FA8D000A6001, 0x0000FA8E000A6101,
+			0x0000FA8F000A6201, 0x0000FA90000A6301, 0x0000FA91000A6401, 0x0000FA92000A6501,
+			0x0000FA93000A6601, 0x0000FA94000A6701, 0x0000FA95000A6801, 0x0000FA96000A6901,
+			0x0000FA97000A6A01, 0x0000FA98000A6B01, 0x0000FA99000A6C01, 0x0000FA9A000A6D01,
+			0x0000FA9B000A6E01, 0x0000FA9C000A6F01, 0x0000FA9D000A7001, 0x0000FA9E000A7101,
+			0x0000FA9F000A7201, 0x0000FAA0000A7301, 0x0000FAA1000A7401, 0x0000FAA2000A7501,
+			0x0000FAA3000A7601, 0x0000FAA4000A7701, 0x0000FAA5000A7801, 0x0000FAA6000A7901,
+			0x0000FAA7000A7A01, 0x0000FAA8000A7B01, 0x0000FAA9000A7C01, 0x0000FAAA000A7D01,
+			0x0000FAAB000A7E01, 0x0000FAAC000A7F01, 0x0000FAAD000A8001, 0x0000FAAE000A8101,
+			0x0000FAAF000A8201, 0x0000FAB0000A8301, 0x0000FAB1000A8401, 0x0000FAB2000A8501,
+			0x0000FAB3000A8601, 0x0000FAB4000A8701, 0x0000FAB5000A8801, 0x0000FAB6000A8901,
+			0x0000FAB7000A8A01, 0x0000FAB8000A8B01, 0x0000FAB9000A8C01, 0x0000FABA000A8D01,
+			0x0000FABB000A8E01, 0x0000FABC000A8F01, 0x0000FABD000A9001, 0x0000FABE000A9101,
+			0x0000FABF000A9201, 0x0000FAC0000A9301, 0x0000FAC1000A9401, 0x0000FAC2000A9501,
+			0x0000FAC3000A9601, 0x0000FAC4000A9701, 0x0000FAC5000A9801, 0x0000FAC6000A9901,
+			0x0000FAC7000A9A01, 0x0000FAC8000A9B01, 0x0000FAC9000A9C01, 0x0000FACA000A9D01,
+			0x0000FACB000A9E01, 0x0000FACC000A9F01, 0x0000FACD000AA001, 0x0000FACE000AA101,
+			0x0000FACF000AA201, 0x0000FAD0000AA301, 0x0000FAD1000AA401, 0x0000FAD2000AA501,
+			0x0000FAD3000AA601, 0x0000FAD4000AA701, 0x0000FAD5000AA801, 0x0000FAD6000AA901,
+			0x0000FAD7000AAA01, 0x0000FAD8000AAB01, 0x0000FAD9000AAC01, 0x0000FB1D000AAD02,
+			0x0000FB1F000AAF02, 0x0000FB2A000AB102, 0x0000FB2B000AB302, 0x0000FB2C000AB503,
+			0x0000FB2D000AB803, 0x0000FB2E000ABB02, 0x0000FB2F000ABD02, 0x0000FB30000ABF02,
+			0x0000FB31000AC102, 0x0000FB32000AC302, 0x0000FB33000AC502, 0x0000FB34000AC702,
+			0x0000FB35000AC902, 0x0000FB36000ACB02, 0x0000FB38000ACD02, 0x0000FB39000ACF02,
+			0x0000FB3A000AD102, 0x0000FB3B000AD302, 0x0000FB3C000AD502, 0x0000FB3E000AD702,
+			0x0000FB40000AD902, 0x0000FB41000ADB02, 0x0000FB43000ADD02, 0x0000FB44000ADF02,
+			0x0000FB46000AE102, 0x0000FB47000AE302, 0x0000FB48000AE502, 0x0000FB49000AE702,
+			0x0000FB4A000AE902, 0x0000FB4B000AEB02, 0x0000FB4C000AED02, 0x0000FB4D000AEF02,
+			0x0000FB4E000AF102, 0x0001109A000AF302, 0x0001109C000AF502, 0x000110AB000AF702,
+			0x0001112E000AF902, 0x0001112F000AFB02, 0x0001134B000AFD02, 0x0001134C000AFF02,
+			0x000114BB000B0102, 0x000114BC000B0302, 0x000114BE000B0502, 0x000115BA000B0702,
+			0x000115BB000B0902, 0x00011938000B0B02, 0x0001D15E000B0D02, 0x0001D15F000B0F02,
+			0x0001D160000B1103, 0x0001D161000B1403, 0x0001D162000B1703, 0x0001D163000B1A03,
+			0x0001D164000B1D03, 0x0001D1BB000B2002, 0x0001D1BC000B2202, 0x0001D1BD000B2403,
+			0x0001D1BE000B2703, 0x0001D1BF000B2A03, 0x0001D1C0000B2D03, 0x0002F800000B3001,
+			0x0002F801000B3101, 0x0002F802000B3201, 0x0002F803000B3301, 0x0002F804000B3401,
+			0x0002F805000B3501, 0x0002F806000B3601, 0x0002F807000B3701, 0x0002F808000B3801,
+			0x0002F809000B3901, 0x0002F80A000B3A01, 0x0002F80B000B3B01, 0x0002F80C000B3C01,
+			0x0002F80D000B3D01, 0x0002F80E000B3E01, 0x0002F80F000B3F01, 0x0002F810000B4001,
+			0x0002F811000B4101, 0x0002F812000B4201, 0x0002F813000B4301, 0x0002F814000B4401,
+			0x0002F815000B4501, 0x0002F816000B4601, 0x0002F817000B4701, 0x0002F818000B4801,
+			0x0002F819000B4901, 0x0002F81A000B4A01, 0x0002F81B000B4B01, 0x0002F81C000B4C01,
+			0x0002F81D000B4D01, 0x0002F81E000B4E01, 0x0002F81F000B4F01, 0x0002F820000B5001,
+			0x0002F821000B5101, 0x0002F822000B5201, 0x0002F823000B5301, 0x0002F824000B5401,
+			0x0002F825000B5501, 0x0002F826000B5601, 0x0002F827000B5701, 0x0002F828000B5801,
+			0x0002F829000B5901, 0x0002F82A000B5A01, 0x0002F82B000B5B01, 0x0002F82C000B5C01,
+			0x0002F82D000B5D01, 0x0002F82E000B5E01, 0x0002F82F000B5F01, 0x0002F830000B6001,
+			0x0002F831000B6101, 0x0002F832000B6201, 0x0002F833000B6301, 0x0002F834000B6401,
+			0x0002F835000B6501, 0x0002F836000B6601, 0x0002F837000B6701, 0x0002F838000B6801,
+			0x0002F839000B6901, 0x0002F83A000B6A01, 0x0002F83B000B6B01, 0x0002F83C000B6C01,
+			0x0002F83D000B6D01, 0x0002F83E000B6E01, 0x0002F83F000B6F01, 0x0002F840000B7001,
+			0x0002F841000B7101, 0x0002F842000B7201, 0x0002F843000B7301, 0x0002F844000B7401,
+			0x0002F845000B7501, 0x0002F846000B7601, 0x0002F847000B7701, 0x0002F848000B7801,
+			0x0002F849000B7901, 0x0002F84A000B7A01, 0x0002F84B000B7B01, 0x0002F84C000B7C01,
+			0x0002F84D000B7D01, 0x0002F84E000B7E01, 0x0002F84F000B7F01, 0x0002F850000B8001,
+			0x0002F851000B8101, 0x0002F852000B8201, 0x0002F853000B8301, 0x0002F854000B8401,
+			0x0002F855000B8501, 0x0002F856000B8601, 0x0002F857000B8701, 0x0002F858000B8801,
+			0x0002F859000B8901, 0x0002F85A000B8A01, 0x0002F85B000B8B01, 0x0002F85C000B8C01,
+			0x0002F85D000B8D01, 0x0002F85E000B8E01, 0x0002F85F000B8F01, 0x0002F860000B9001,
+			0x0002F861000B9101, 0x0002F862000B9201, 0x0002F863000B9301, 0x0002F864000B9401,
+			0x0002F865000B9501, 0x0002F866000B9601, 0x0002F867000B9701, 0x0002F868000B9801,
+			0x0002F869000B9901, 0x0002F86A000B9A01, 0x0002F86B000B9B01, 0x0002F86C000B9C01,
+			0x0002F86D000B9D01, 0x0002F86E000B9E01, 0x0002F86F000B9F01, 0x0002F870000BA001,
+			0x0002F871000BA101, 0x0002F872000BA201, 0x0002F873000BA301, 0x0002F874000BA401,
+			0x0002F875000BA501, 0x0002F876000BA601, 0x0002F877000BA701, 0x0002F878000BA801,
+			0x0002F879000BA901, 0x0002F87A000BAA01, 0x0002F87B000BAB01, 0x0002F87C000BAC01,
+			0x0002F87D000BAD01, 0x0002F87E000BAE01, 0x0002F87F000BAF01, 0x0002F880000BB001,
+			0x0002F881000BB101, 0x0002F882000BB201, 0x0002F883000BB301, 0x0002F884000BB401,
+			0x0002F885000BB501, 0x0002F886000BB601, 0x0002F887000BB701, 0x0002F888000BB801,
+			0x0002F889000BB901, 0x0002F88A000BBA01, 0x0002F88B000BBB01, 0x0002F88C000BBC01,
+			0x0002F88D000BBD01, 0x0002F88E000BBE01, 0x0002F88F000BBF01, 0x0002F890000BC001,
+			0x0002F891000BC101, 0x0002F892000BC201, 0x0002F893000BC301, 0x0002F894000BC401,
+			0x0002F895000BC501, 0x0002F896000BC601, 0x0002F897000BC701, 0x0002F898000BC801,
+			0x0002F899000BC901, 0x0002F89A000BCA01, 0x0002F89B000BCB01, 0x0002F89C000BCC01,
+			0x0002F89D000BCD01, 0x0002F89E000BCE01, 0x0002F89F000BCF01, 0x0002F8A0000BD001,
+			0x0002F8A1000BD101, 0x0002F8A2000BD201, 0x0002F8A3000BD301, 0x0002F8A4000BD401,
+			0x0002F8A5000BD501, 0x0002F8A6000BD601, 0x0002F8A7000BD701, 0x0002F8A8000BD801,
+			0x0002F8A9000BD901, 0x0002F8AA000BDA01, 0x0002F8AB000BDB01, 0x0002F8AC000BDC01,
+			0x0002F8AD000BDD01, 0x0002F8AE000BDE01, 0x0002F8AF000BDF01, 0x0002F8B0000BE001,
+			0x0002F8B1000BE101, 0x0002F8B2000BE201, 0x0002F8B3000BE301, 0x0002F8B4000BE401,
+			0x0002F8B5000BE501, 0x0002F8B6000BE601, 0x0002F8B7000BE701, 0x0002F8B8000BE801,
+			0x0002F8B9000BE901, 0x0002F8BA000BEA01, 0x0002F8BB000BEB01, 0x0002F8BC000BEC01,
+			0x0002F8BD000BED01, 0x0002F8BE000BEE01, 0x0002F8BF000BEF01, 0x0002F8C0000BF001,
+			0x0002F8C1000BF101, 0x0002F8C2000BF201, 0x0002F8C3000BF301, 0x0002F8C4000BF401,
+			0x0002F8C5000BF501, 0x0002F8C6000BF601, 0x0002F8C7000BF701, 0x0002F8C8000BF801,
+			0x0002F8C9000BF901, 0x0002F8CA000BFA01, 0x0002F8CB000BFB01, 0x0002F8CC000BFC01,
+			0x0002F8CD000BFD01, 0x0002F8CE000BFE01, 0x0002F8CF000BFF01, 0x0002F8D0000C0001,
+			0x0002F8D1000C0101, 0x0002F8D2000C0201, 0x0002F8D3000C0301, 0x0002F8D4000C0401,
+			0x0002F8D5000C0501, 0x0002F8D6000C0601, 0x0002F8D7000C0701, 0x0002F8D8000C0801,
+			0x0002F8D9000C0901, 0x0002F8DA000C0A01, 0x0002F8DB000C0B01, 0x0002F8DC000C0C01,
+			0x0002F8DD000C0D01, 0x0002F8DE000C0E01, 0x0002F8DF000C0F01, 0x0002F8E0000C1001,
+			0x0002F8E1000C1101, 0x0002F8E2000C1201, 0x0002F8E3000C1301, 0x0002F8E4000C1401,
+			0x0002F8E5000C1501, 0x0002F8E6000C1601, 0x0002F8E7000C1701, 0x0002F8E8000C1801,
+			0x0002F8E9000C1901, 0x0002F8EA000C1A01, 0x0002F8EB000C1B01, 0x0002F8EC000C1C01,
+			0x0002F8ED000C1D01, 0x0002F8EE000C1E01, 0x0002F8EF000C1F01, 0x0002F8F0000C2001,
+			0x0002F8F1000C2101, 0x0002F8F2000C2201, 0x0002F8F3000C2301, 0x0002F8F4000C2401,
+			0x0002F8F5000C2501, 0x0002F8F6000C2601, 0x0002F8F7000C2701, 0x0002F8F8000C2801,
+			0x0002F8F9000C2901, 0x0002F8FA000C2A01, 0x0002F8FB000C2B01, 0x0002F8FC000C2C01,
+			0x0002F8FD000C2D01, 0x0002F8FE000C2E01, 0x0002F8FF000C2F01, 0x0002F900000C3001,
+			0x0002F901000C3101, 0x0002F902000C3201, 0x0002F903000C3301, 0x0002F904000C3401,
+			0x0002F905000C3501, 0x0002F906000C3601, 0x0002F907000C3701, 0x0002F908000C3801,
+			0x0002F909000C3901, 0x0002F90A000C3A01, 0x0002F90B000C3B01, 0x0002F90C000C3C01,
+			0x0002F90D000C3D01, 0x0002F90E000C3E01, 0x0002F90F000C3F01, 0x0002F910000C4001,
+			0x0002F911000C4101, 0x0002F912000C4201, 0x0002F913000C4301, 0x0002F914000C4401,
+			0x0002F915000C4501, 0x0002F916000C4601, 0x0002F917000C4701, 0x0002F918000C4801,
+			0x0002F919000C4901, 0x0002F91A000C4A01, 0x0002F91B000C4B01, 0x0002F91C000C4C01,
+			0x0002F91D000C4D01, 0x0002F91E000C4E01, 0x0002F91F000C4F01, 0x0002F920000C5001,
+			0x0002F921000C5101, 0x0002F922000C5201, 0x0002F923000C5301, 0x0002F924000C5401,
+			0x0002F925000C5501, 0x0002F926000C5601, 0x0002F927000C5701, 0x0002F928000C5801,
+			0x0002F929000C5901, 0x0002F92A000C5A01, 0x0002F92B000C5B01, 0x0002F92C000C5C01,
+			0x0002F92D000C5D01, 0x0002F92E000C5E01, 0x0002F92F000C5F01, 0x0002F930000C6001,
+			0x0002F931000C6101, 0x0002F932000C6201, 0x0002F933000C6301, 0x0002F934000C6401,
+			0x0002F935000C6501, 0x0002F936000C6601, 0x0002F937000C6701, 0x0002F938000C6801,
+			0x0002F939000C6901, 0x0002F93A000C6A01, 0x0002F93B000C6B01, 0x0002F93C000C6C01,
+			0x0002F93D000C6D01, 0x0002F93E000C6E01, 0x0002F93F000C6F01, 0x0002F940000C7001,
+			0x0002F941000C7101, 0x0002F942000C7201, 0x0002F943000C7301, 0x0002F944000C7401,
+			0x0002F945000C7501, 0x0002F946000C7601, 0x0002F947000C7701, 0x0002F948000C7801,
+			0x0002F949000C7901, 0x0002F94A000C7A01, 0x0002F94B000C7B01, 0x0002F94C000C7C01,
+			0x0002F94D000C7D01, 0x0002F94E000C7E01, 0x0002F94F000C7F01, 0x0002F950000C8001,
+			0x0002F951000C8101, 0x0002F952000C8201, 0x0002F953000C8301, 0x0002F954000C8401,
+			0x0002F955000C8501, 0x0002F956000C8601, 0x0002F957000C8701, 0x0002F958000C8801,
+			0x0002F959000C8901, 0x0002F95A000C8A01, 0x0002F95B000C8B01, 0x0002F95C000C8C01,
+			0x0002F95D000C8D01, 0x0002F95E000C8E01, 0x0002F95F000C8F01, 0x0002F960000C9001,
+			0x0002F961000C9101, 0x0002F962000C9201, 0x0002F963000C9301, 0x0002F964000C9401,
+			0x0002F965000C9501, 0x0002F966000C9601, 0x0002F967000C9701, 0x0002F968000C9801,
+			0x0002F969000C9901, 0x0002F96A000C9A01, 0x0002F96B000C9B01, 0x0002F96C000C9C01,
+			0x0002F96D000C9D01, 0x0002F96E000C9E01, 0x0002F96F000C9F01, 0x0002F970000CA001,
+			0x0002F971000CA101, 0x0002F972000CA201, 0x0002F973000CA301, 0x0002F974000CA401,
+			0x0002F975000CA501, 0x0002F976000CA601, 0x0002F977000CA701, 0x0002F978000CA801,
+			0x0002F979000CA901, 0x0002F97A000CAA01, 0x0002F97B000CAB01, 0x0002F97C000CAC01,
+			0x0002F97D000CAD01, 0x0002F97E000CAE01, 0x0002F97F000CAF01, 0x0002F980000CB001,
+			0x0002F981000CB101, 0x0002F982000CB201, 0x0002F983000CB301, 0x0002F984000CB401,
+			0x0002F985000CB501, 0x0002F986000CB601, 0x0002F987000CB701, 0x0002F988000CB801,
+			0x0002F989000CB901, 0x0002F98A000CBA01, 0x0002F98B000CBB01, 0x0002F98C000CBC01,
+			0x0002F98D000CBD01, 0x0002F98E000CBE01, 0x0002F98F000CBF01, 0x0002F990000CC001,
+			0x0002F991000CC101, 0x0002F992000CC201, 0x0002F993000CC301, 0x0002F994000CC401,
+			0x0002F995000CC501, 0x0002F996000CC601, 0x0002F997000CC701, 0x0002F998000CC801,
+			0x0002F999000CC901, 0x0002F99A000CCA01, 0x0002F99B000CCB01, 0x0002F99C000CCC01,
+			0x0002F99D000CCD01, 0x0002F99E000CCE01, 0x0002F99F000CCF01, 0x0002F9A0000CD001,
+			0x0002F9A1000CD101, 0x0002F9A2000CD201, 0x0002F9A3000CD301, 0x0002F9A4000CD401,
+			0x0002F9A5000CD501, 0x0002F9A6000CD601, 0x0002F9A7000CD701, 0x0002F9A8000CD801,
+			0x0002F9A9000CD901, 0x0002F9AA000CDA01, 0x0002F9AB000CDB01, 0x0002F9AC000CDC01,
+			0x0002F9AD000CDD01, 0x0002F9AE000CDE01, 0x0002F9AF000CDF01, 0x0002F9B0000CE001,
+			0x0002F9B1000CE101, 0x0002F9B2000CE201, 0x0002F9B3000CE301, 0x0002F9B4000CE401,
+			0x0002F9B5000CE501, 0x0002F9B6000CE601, 0x0002F9B7000CE701, 0x0002F9B8000CE801,
+			0x0002F9B9000CE901, 0x0002F9BA000CEA01, 0x0002F9BB000CEB01, 0x0002F9BC000CEC01,
+			0x0002F9BD000CED01, 0x0002F9BE000CEE01, 0x0002F9BF000CEF01, 0x0002F9C0000CF001,
+			0x0002F9C1000CF101, 0x0002F9C2000CF201, 0x0002F9C3000CF301, 0x0002F9C4000CF401,
+			0x0002F9C5000CF501, 0x0002F9C6000CF601, 0x0002F9C7000CF701, 0x0002F9C8000CF801,
+			0x0002F9C9000CF901, 0x0002F9CA000CFA01, 0x0002F9CB000CFB01, 0x0002F9CC000CFC01,
+			0x0002F9CD000CFD01, 0x0002F9CE000CFE01, 0x0002F9CF000CFF01, 0x0002F9D0000D0001,
+			0x0002F9D1000D0101, 0x0002F9D2000D0201, 0x0002F9D3000D0301, 0x0002F9D4000D0401,
+			0x0002F9D5000D0501, 0x0002F9D6000D0601, 0x0002F9D7000D0701, 0x0002F9D8000D0801,
+			0x0002F9D9000D0901, 0x0002F9DA000D0A01, 0x0002F9DB000D0B01, 0x0002F9DC000D0C01,
+			0x0002F9DD000D0D01, 0x0002F9DE000D0E01, 0x0002F9DF000D0F01, 0x0002F9E0000D1001,
+			0x0002F9E1000D1101, 0x0002F9E2000D1201, 0x0002F9E3000D1301, 0x0002F9E4000D1401,
+			0x0002F9E5000D1501, 0x0002F9E6000D1601, 0x0002F9E7000D1701, 0x0002F9E8000D1801,
+			0x0002F9E9000D1901, 0x0002F9EA000D1A01, 0x0002F9EB000D1B01, 0x0002F9EC000D1C01,
+			0x0002F9ED000D1D01, 0x0002F9EE000D1E01, 0x0002F9EF000D1F01, 0x0002F9F0000D2001,
+			0x0002F9F1000D2101, 0x0002F9F2000D2201, 0x0002F9F3000D2301, 0x0002F9F4000D2401,
+			0x0002F9F5000D2501, 0x0002F9F6000D2601, 0x0002F9F7000D2701, 0x0002F9F8000D2801,
+			0x0002F9F9000D2901, 0x0002F9FA000D2A01, 0x0002F9FB000D2B01, 0x0002F9FC000D2C01,
+			0x0002F9FD000D2D01, 0x0002F9FE000D2E01, 0x0002F9FF000D2F01, 0x0002FA00000D3001,
+			0x0002FA01000D3101, 0x0002FA02000D3201, 0x0002FA03000D3301, 0x0002FA04000D3401,
+			0x0002FA05000D3501, 0x0002FA06000D3601, 0x0002FA07000D3701, 0x0002FA08000D3801,
+			0x0002FA09000D3901, 0x0002FA0A000D3A01, 0x0002FA0B000D3B01, 0x0002FA0C000D3C01,
+			0x0002FA0D000D3D01, 0x0002FA0E000D3E01, 0x0002FA0F000D3F01, 0x0002FA10000D4001,
+			0x0002FA11000D4101, 0x0002FA12000D4201, 0x0002FA13000D4301, 0x0002FA14000D4401,
+			0x0002FA15000D4501, 0x0002FA16000D4601, 0x0002FA17000D4701, 0x0002FA18000D4801,
+			0x0002FA19000D4901, 0x0002FA1A000D4A01, 0x0002FA1B000D4B01, 0x0002FA1C000D4C01,
+			0x0002FA1D000D4D01,
+		};
+
+		// Code points of the canonical decompositions
+		inline constexpr char32_t canonical_pool[3406] = {
+			65, 768, 65, 769, 65, 770, 65, 771, 65, 776, 65, 778, 67, 807, 69, 768, 69, 769, 69, 770, 69, 776, 73, 768,
+			73, 769, 73, 770, 73, 776, 78, 771, 79, 768, 79, 769, 79, 770, 79, 771, 79, 776, 85, 768, 85, 769, 85, 770,
+			85, 776, 89, 769, 97, 768, 97, 769, 97, 770, 97, 771, 97, 776, 97, 778, 99, 807, 101, 768, 101, 769, 101, 770,
+			101, 776, 105, 768, 105, 769, 105, 770, 105, 776, 110, 771, 111, 768, 111, 769, 111, 770, 111, 771, 111, 776, 117, 768,
+			117, 769, 117, 770, 117, 776, 121, 769, 121, 776, 65, 772, 97, 772, 65, 774, 97, 774, 65, 808, 97, 808, 67, 769,
+			99, 769, 67, 770, 99, 770, 67, 775, 99, 775, 67, 780, 99, 780, 68, 780, 100, 780, 69, 772, 101, 772, 69, 774,
+			101, 774, 69, 775, 101, 775, 69, 808, 101, 808, 69, 780, 101, 780, 71, 770, 103, 770, 71, 774, 103, 774, 71, 775,
+			103, 775, 71, 807, 103, 807, 72, 770, 104, 770, 73, 771, 105, 771, 73, 772, 105, 772, 73, 774, 105, 774, 73, 808,
+			105, 808, 73, 775, 74, 770, 106, 770, 75, 807, 107, 807, 76, 769, 108, 769, 76, 807, 108, 807, 76, 780, 108, 780,
+			78, 769, 110, 769, 78, 807, 110, 807, 78, 780, 110, 780, 79, 772, 111, 772, 79, 774, 111, 774, 79, 779, 111, 779,
+			82, 769, 114, 769, 82, 807, 114, 807, 82, 780, 114, 780, 83, 769, 115, 769, 83, 770, 115, 770, 83, 807, 115, 807,
+			83, 780, 115, 780, 84, 807, 116, 807, 84, 780, 116, 780, 85, 771, 117, 771, 85, 772, 117, 772, 85, 774, 117, 774,
+			85, 778, 117, 778, 85, 779, 117, 779, 85, 808, 117, 808, 87, 770, 119, 770, 89, 770, 121, 770, 89, 776, 90, 769,
+			122, 769, 90, 775, 122, 775, 90, 780, 122, 780, 79, 795, 111, 795, 85, 795, 117, 795, 65, 780, 97, 780, 73, 780,
+			105, 780, 79, 780, 111, 780, 85, 780, 117, 780, 85, 776, 772, 117, 776, 772, 85, 776, 769, 117, 776, 769, 85, 776,
+			780, 117, 776, 780, 85, 776, 768, 117, 776, 768, 65, 776, 772, 97, 776, 772, 65, 775, 772, 97, 775, 772, 198, 772,
+			230, 772, 71, 780, 103, 780, 75, 780, 107, 780, 79, 808, 111, 808, 79, 808, 772, 111, 808, 772, 439, 780, 658, 780,
+			106, 780, 71, 769, 103, 769, 78, 768, 110, 768, 65, 778, 769, 97, 778, 769, 198, 769, 230, 769, 216, 769, 248, 769,
+			65, 783, 97, 783, 65, 785, 97, 785, 69, 783, 101, 783, 69, 785, 101, 785, 73, 783, 105, 783, 73, 785, 105, 785,
+			79, 783, 111, 783, 79, 785, 111, 785, 82, 783, 114, 783, 82, 785, 114, 785, 85, 783, 117, 783, 85, 785, 117, 785,
+			83, 806, 115, 806, 84, 806, 116, 806, 72, 780, 104, 780, 65, 775, 97, 775, 69, 807, 101, 807, 79, 776, 772, 111,
+			776, 772, 79, 771, 772, 111, 771, 772, 79, 775, 111, 775, 79, 775, 772, 111, 775, 772, 89, 772, 121, 772, 768, 769,
+			787, 776, 769, 697, 59, 168, 769, 913, 769, 183, 917, 769, 919, 769, 921, 769, 927, 769, 933, 769, 937, 769, 953, 776,
+			769, 921, 776, 933, 776, 945, 769, 949, 769, 951, 769, 953, 769, 965, 776, 769, 953, 776, 965, 776, 959, 769, 965, 769,
+			969, 769, 978, 769, 978, 776, 1045, 768, 1045, 776, 1043, 769, 1030, 776, 1050, 769, 1048, 768, 1059, 774, 1048, 774, 1080, 774,
+			1077, 768, 1077, 776, 1075, 769, 1110, 776, 1082, 769, 1080, 768, 1091, 774, 1140, 783, 1141, 783, 1046, 774, 1078, 774, 1040, 774,
+			1072, 774, 1040, 776, 1072, 776, 1045, 774, 1077, 774, 1240, 776, 1241, 776, 1046, 776, 1078, 776, 1047, 776, 1079, 776, 1048, 772,
+			1080, 772, 1048, 776, 1080, 776, 1054, 776, 1086, 776, 1256, 776, 1257, 776, 1069, 776, 1101, 776, 1059, 772, 1091, 772, 1059, 776,
+			1091, 776, 1059, 779, 1091, 779, 1063, 776, 1095, 776, 1067, 776, 1099, 776, 1575, 1619, 1575, 1620, 1608, 1620, 1575, 1621, 1610, 1620,
+			1749, 1620, 1729, 1620, 1746, 1620, 2344, 2364, 2352, 2364, 2355, 2364, 2325, 2364, 2326, 2364, 2327, 2364, 2332, 2364, 2337, 2364, 2338, 2364,
+			2347, 2364, 2351, 2364, 2503, 2494, 2503, 2519, 2465, 2492, 2466, 2492, 2479, 2492, 2610, 2620, 2616, 2620, 2582, 2620, 2583, 2620, 2588, 2620,
+			2603, 2620, 2887, 2902, 2887, 2878, 2887, 2903, 2849, 2876, 2850, 2876, 2962, 3031, 3014, 3006, 3015, 3006, 3014, 3031, 3142, 3158, 3263, 3285,
+			3270, 3285, 3270, 3286, 3270, 3266, 3270, 3266, 3285, 3398, 3390, 3399, 3390, 3398, 3415, 3545, 3530, 3545, 3535, 3545, 3535, 3530, 3545, 3551,
+			3906, 4023, 3916, 4023, 3921, 4023, 3926, 4023, 3931, 4023, 3904, 4021, 3953, 3954, 3953, 3956, 4018, 3968, 4019, 3968, 3953, 3968, 3986, 4023,
+			3996, 4023, 4001, 4023, 4006, 4023, 4011, 4023, 3984, 4021, 4133, 4142, 6917, 6965, 6919, 6965, 6921, 6965, 6923, 6965, 6925, 6965, 6929, 6965,
+			6970, 6965, 6972, 6965, 6974, 6965, 6975, 6965, 6978, 6965, 65, 805, 97, 805, 66, 775, 98, 775, 66, 803, 98, 803, 66, 817,
+			98, 817, 67, 807, 769, 99, 807, 769, 68, 775, 100, 775, 68, 803, 100, 803, 68, 817, 100, 817, 68, 807, 100, 807,
+			68, 813, 100, 813, 69, 772, 768, 101, 772, 768, 69, 772, 769, 101, 772, 769, 69, 813, 101, 813, 69, 816, 101, 816,
+			69, 807, 774, 101, 807, 774, 70, 775, 102, 775, 71, 772, 103, 772, 72, 775, 104, 775, 72, 803, 104, 803, 72, 776,
+			104, 776, 72, 807, 104, 807, 72, 814, 104, 814, 73, 816, 105, 816, 73, 776, 769, 105, 776, 769, 75, 769, 107, 769,
+			75, 803, 107, 803, 75, 817, 107, 817, 76, 803, 108, 803, 76, 803, 772, 108, 803, 772, 76, 817, 108, 817, 76, 813,
+			108, 813, 77, 769, 109, 769, 77, 775, 109, 775, 77, 803, 109, 803, 78, 775, 110, 775, 78, 803, 110, 803, 78, 817,
+			110, 817, 78, 813, 110, 813, 79, 771, 769, 111, 771, 769, 79, 771, 776, 111, 771, 776, 79, 772, 768, 111, 772, 768,
+			79, 772, 769, 111, 772, 769, 80, 769, 112, 769, 80, 775, 112, 775, 82, 775, 114, 775, 82, 803, 114, 803, 82, 803,
+			772, 114, 803, 772, 82, 817, 114, 817, 83, 775, 115, 775, 83, 803, 115, 803, 83, 769, 775, 115, 769, 775, 83, 780,
+			775, 115, 780, 775, 83, 803, 775, 115, 803, 775, 84, 775, 116, 775, 84, 803, 116, 803, 84, 817, 116, 817, 84, 813,
+			116, 813, 85, 804, 117, 804, 85, 816, 117, 816, 85, 813, 117, 813, 85, 771, 769, 117, 771, 769, 85, 772, 776, 117,
+			772, 776, 86, 771, 118, 771, 86, 803, 118, 803, 87, 768, 119, 768, 87, 769, 119, 769, 87, 776, 119, 776, 87, 775,
+			119, 775, 87, 803, 119, 803, 88, 775, 120, 775, 88, 776, 120, 776, 89, 775, 121, 775, 90, 770, 122, 770, 90, 803,
+			122, 803, 90, 817, 122, 817, 104, 817, 116, 776, 119, 778, 121, 778, 383, 775, 65, 803, 97, 803, 65, 777, 97, 777,
+			65, 770, 769, 97, 770, 769, 65, 770, 768, 97, 770, 768, 65, 770, 777, 97, 770, 777, 65, 770, 771, 97, 770, 771,
+			65, 803, 770, 97, 803, 770, 65, 774, 769, 97, 774, 769, 65, 774, 768, 97, 774, 768, 65, 774, 777, 97, 774, 777,
+			65, 774, 771, 97, 774, 771, 65, 803, 774, 97, 803, 774, 69, 803, 101, 803, 69, 777, 101, 777, 69, 771, 101, 771,
+			69, 770, 769, 101, 770, 769, 69, 770, 768, 101, 770, 768, 69, 770, 777, 101, 770, 777, 69, 770, 771, 101, 770, 771,
+			69, 803, 770, 101, 803, 770, 73, 777, 105, 777, 73, 803, 105, 803, 79, 803, 111, 803, 79, 777, 111, 777, 79, 770,
+			769, 111, 770, 769, 79, 770, 768, 111, 770, 768, 79, 770, 777, 111, 770, 777, 79, 770, 771, 111, 770, 771, 79, 803,
+			770, 111, 803, 770, 79, 795, 769, 111, 795, 769, 79, 795, 768, 111, 795, 768, 79, 795, 777, 111, 795, 777, 79, 795,
+			771, 111, 795, 771, 79, 795, 803, 111, 795, 803, 85, 803, 117, 803, 85, 777, 117, 777, 85, 795, 769, 117, 795, 769,
+			85, 795, 768, 117, 795, 768, 85, 795, 777, 117, 795, 777, 85, 795, 771, 117, 795, 771, 85, 795, 803, 117, 795, 803,
+			89, 768, 121, 768, 89, 803, 121, 803, 89, 777, 121, 777, 89, 771, 121, 771, 945, 787, 945, 788, 945, 787, 768, 945,
+			788, 768, 945, 787, 769, 945, 788, 769, 945, 787, 834, 945, 788, 834, 913, 787, 913, 788, 913, 787, 768, 913, 788, 768,
+			913, 787, 769, 913, 788, 769, 913, 787, 834, 913, 788, 834, 949, 787, 949, 788, 949, 787, 768, 949, 788, 768, 949, 787,
+			769, 949, 788, 769, 917, 787, 917, 788, 917, 787, 768, 917, 788, 768, 917, 787, 769, 917, 788, 769, 951, 787, 951, 788,
+			951, 787, 768, 951, 788, 768, 951, 787, 769, 951, 788, 769, 951, 787, 834, 951, 788, 834, 919, 787, 919, 788, 919, 787,
+			768, 919, 788, 768, 919, 787, 769, 919, 788, 769, 919, 787, 834, 919, 788, 834, 953, 787, 953, 788, 953, 787, 768, 953,
+			788, 768, 953, 787, 769, 953, 788, 769, 953, 787, 834, 953, 788, 834, 921, 787, 921, 788, 921, 787, 768, 921, 788, 768,
+			921, 787, 769, 921, 788, 769, 921, 787, 834, 921, 788, 834, 959, 787, 959, 788, 959, 787, 768, 959, 788, 768, 959, 787,
+			769, 959, 788, 769, 927, 787, 927, 788, 927, 787, 768, 927, 788, 768, 927, 787, 769, 927, 788, 769, 965, 787, 965, 788,
+			965, 787, 768, 965, 788, 768, 965, 787, 769, 965, 788, 769, 965, 787, 834, 965, 788, 834, 933, 788, 933, 788, 768, 933,
+			788, 769, 933, 788, 834, 969, 787, 969, 788, 969, 787, 768, 969, 788, 768, 969, 787, 769, 969, 788, 769, 969, 787, 834,
+			969, 788, 834, 937, 787, 937, 788, 937, 787, 768, 937, 788, 768, 937, 787, 769, 937, 788, 769, 937, 787, 834, 937, 788,
+			834, 945, 768, 945, 769, 949, 768, 949, 769, 951, 768, 951, 769, 953, 768, 953, 769, 959, 768, 959, 769, 965, 768, 965,
+			769, 969, 768, 969, 769, 945, 787, 837, 945, 788, 837, 945, 787, 768, 837, 945, 788, 768, 837, 945, 787, 769, 837, 945,
+			788, 769, 837, 945, 787, 834, 837, 945, 788, 834, 837, 913, 787, 837, 913, 788, 837, 913, 787, 768, 837, 913, 788, 768,
+			837, 913, 787, 769, 837, 913, 788, 769, 837, 913, 787, 834, 837, 913, 788, 834, 837, 951, 787, 837, 951, 788, 837, 951,
+			787, 768, 837, 951, 788, 768, 837, 951, 787, 769, 837, 951, 788, 769, 837, 951, 787, 834, 837, 951, 788, 834, 837, 919,
+			787, 837, 919, 788, 837, 919, 787, 768, 837, 919, 788, 768, 837, 919, 787, 769, 837, 919, 788, 769, 837, 919, 787, 834,
+			837, 919, 788, 834, 837, 969, 787, 837, 969, 788, 837, 969, 787, 768, 837, 969, 788, 768, 837, 969, 787, 769, 837, 969,
+			788, 769, 837, 969, 787, 834, 837, 969, 788, 834, 837, 937, 787, 837, 937, 788, 837, 937, 787, 768, 837, 937, 788, 768,
+			837, 937, 787, 769, 837, 937, 788, 769, 837, 937, 787, 834, 837, 937, 788, 834, 837, 945, 774, 945, 772, 945, 768, 837,
+			945, 837, 945, 769, 837, 945, 834, 945, 834, 837, 913, 774, 913, 772, 913, 768, 913, 769, 913, 837, 953, 168, 834, 951,
+			768, 837, 951, 837, 951, 769, 837, 951, 834, 951, 834, 837, 917, 768, 917, 769, 919, 768, 919, 769, 919, 837, 8127, 768,
+			8127, 769, 8127, 834, 953, 774, 953, 772, 953, 776, 768, 953, 776, 769, 953, 834, 953, 776, 834, 921, 774, 921, 772, 921,
+			768, 921, 769, 8190, 768, 8190, 769, 8190, 834, 965, 774, 965, 772, 965, 776, 768, 965, 776, 769, 961, 787, 961, 788, 965,
+			834, 965, 776, 834, 933, 774, 933, 772, 933, 768, 933, 769, 929, 788, 168, 768, 168, 769, 96, 969, 768, 837, 969, 837,
+			969, 769, 837, 969, 834, 969, 834, 837, 927, 768, 927, 769, 937, 768, 937, 769, 937, 837, 180, 8194, 8195, 937, 75, 65,
+			778, 8592, 824, 8594, 824, 8596, 824, 8656, 824, 8660, 824, 8658, 824, 8707, 824, 8712, 824, 8715, 824, 8739, 824, 8741, 824, 8764,
+			824, 8771, 824, 8773, 824, 8776, 824, 61, 824, 8801, 824, 8781, 824, 60, 824, 62, 824, 8804, 824, 8805, 824, 8818, 824, 8819,
+			824, 8822, 824, 8823, 824, 8826, 824, 8827, 824, 8834, 824, 8835, 824, 8838, 824, 8839, 824, 8866, 824, 8872, 824, 8873, 824, 8875,
+			824, 8828, 824, 8829, 824, 8849, 824, 8850, 824, 8882, 824, 8883, 824, 8884, 824, 8885, 824, 12296, 12297, 10973, 824, 12363, 12441, 12365,
+			12441, 12367, 12441, 12369, 12441, 12371, 12441, 12373, 12441, 12375, 12441, 12377, 12441, 12379, 12441, 12381, 12441, 12383, 12441, 12385, 12441, 12388, 12441, 12390,
+			12441, 12392, 12441, 12399, 12441, 12399, 12442, 12402, 12441, 12402, 12442, 12405, 12441, 12405, 12442, 12408, 12441, 12408, 12442, 12411, 12441, 12411, 12442, 12358,
+			12441, 12445, 12441, 12459, 12441, 12461, 12441, 12463, 12441, 12465, 12441, 12467, 12441, 12469, 12441, 12471, 12441, 12473, 12441, 12475, 12441, 12477, 12441, 12479,
+			12441, 12481, 12441, 12484, 12441, 12486, 12441, 12488, 12441, 12495, 12441, 12495, 12442, 12498, 12441, 12498, 12442, 12501, 12441, 12501, 12442, 12504, 12441, 12504,
+			12442, 12507, 12441, 12507, 12442, 12454, 12441, 12527, 12441, 12528, 12441, 12529, 12441, 12530, 12441, 12541, 12441, 35912, 26356, 36554, 36040, 28369, 20018, 21477,
+			40860, 40860, 22865, 37329, 21895, 22856, 25078, 30313, 32645, 34367, 34746, 35064, 37007, 27138, 27931, 28889, 29662, 33853, 37226, 39409, 20098, 21365, 27396, 29211,
+			34349, 40478, 23888, 28651, 34253, 35172, 25289, 33240, 34847, 24266, 26391, 28010, 29436, 37070, 20358, 20919, 21214, 25796, 27347, 29200, 30439, 32769, 34310, 34396,
+			36335, 38706, 39791, 40442, 30860, 31103, 32160, 33737, 37636, 40575, 35542, 22751, 24324, 31840, 32894, 29282, 30922, 36034, 38647, 22744, 23650, 27155, 28122, 28431,
+			32047, 32311, 38475, 21202, 32907, 20956, 20940, 31260, 32190, 33777, 38517, 35712, 25295, 27138, 35582, 20025, 23527, 24594, 29575, 30064, 21271, 30971, 20415, 24489,
+			19981, 27852, 25976, 32034, 21443, 22622, 30465, 33865, 35498, 27578, 36784, 27784, 25342, 33509, 25504, 30053, 20142, 20841, 20937, 26753, 31975, 33391, 35538, 37327,
+			21237, 21570, 22899, 24300, 26053, 28670, 31018, 38317, 39530, 40599, 40654, 21147, 26310, 27511, 36706, 24180, 24976, 25088, 25754, 28451, 29001, 29833, 31178, 32244,
+			32879, 36646, 34030, 36899, 37706, 21015, 21155, 21693, 28872, 35010, 35498, 24265, 24565, 25467, 27566, 31806, 29557, 20196, 22265, 23527, 23994, 24604, 29618, 29801,
+			32666, 32838, 37428, 38646, 38728, 38936, 20363, 31150, 37300, 38584, 24801, 20102, 20698, 23534, 23615, 26009, 27138, 29134, 30274, 34044, 36988, 40845, 26248, 38446,
+			21129, 26491, 26611, 27969, 28316, 29705, 30041, 30827, 32016, 39006, 20845, 25134, 38520, 20523, 23833, 28138, 36650, 24459, 24900, 26647, 29575, 38534, 21033, 21519,
+			23653, 26131, 26446, 26792, 27877, 29702, 30178, 32633, 35023, 35041, 37324, 38626, 21311, 28346, 21533, 29136, 29848, 34298, 38563, 40023, 40607, 26519, 28107, 33256,
+			31435, 31520, 31890, 29376, 28825, 35672, 20160, 33590, 21050, 20999, 24230, 25299, 31958, 23429, 27934, 26292, 36667, 34892, 38477, 35211, 24275, 20800, 21952, 22618,
+			26228, 20958, 29482, 30410, 31036, 31070, 31077, 31119, 38742, 31934, 32701, 34322, 35576, 36920, 37117, 39151, 39164, 39208, 40372, 37086, 38583, 20398, 20711, 20813,
+			21193, 21220, 21329, 21917, 22022, 22120, 22592, 22696, 23652, 23662, 24724, 24936, 24974, 25074, 25935, 26082, 26257, 26757, 28023, 28186, 28450, 29038, 29227, 29730,
+			30865, 31038, 31049, 31048, 31056, 31062, 31069, 31117, 31118, 31296, 31361, 31680, 32244, 32265, 32321, 32626, 32773, 33261, 33401, 33401, 33879, 35088, 35222, 35585,
+			35641, 36051, 36104, 36790, 36920, 38627, 38911, 38971, 24693, 148206, 33304, 20006, 20917, 20840, 20352, 20805, 20864, 21191, 21242, 21917, 21845, 21913, 21986, 22618,
+			22707, 22852, 22868, 23138, 23336, 24274, 24281, 24425, 24493, 24792, 24910, 24840, 24974, 24928, 25074, 25140, 25540, 25628, 25682, 25942, 26228, 26391, 26395, 26454,
+			27513, 27578, 27969, 28379, 28363, 28450, 28702, 29038, 30631, 29237, 29359, 29482, 29809, 29958, 30011, 30237, 30239, 30410, 30427, 30452, 30538, 30528, 30924, 31409,
+			31680, 31867, 32091, 32244, 32574, 32773, 33618, 33775, 34681, 35137, 35206, 35222, 35519, 35576, 35531, 35585, 35582, 35565, 35641, 35722, 36104, 36664, 36978, 37273,
+			37494, 38524, 38627, 38742, 38875, 38911, 38923, 38971, 39698, 40860, 141386, 141380, 144341, 15261, 16408, 16441, 152137, 154832, 163539, 40771, 40846, 1497, 1460, 1522,
+			1463, 1513, 1473, 1513, 1474, 1513, 1468, 1473, 1513, 1468, 1474, 1488, 1463, 1488, 1464, 1488, 1468, 1489, 1468, 1490, 1468, 1491, 1468, 1492,
+			1468, 1493, 1468, 1494, 1468, 1496, 1468, 1497, 1468, 1498, 1468, 1499, 1468, 1500, 1468, 1502, 1468, 1504, 1468, 1505, 1468, 1507, 1468, 1508,
+			1468, 1510, 1468, 1511, 1468, 1512, 1468, 1513, 1468, 1514, 1468, 1493, 1465, 1489, 1471, 1499, 1471, 1508, 1471, 69785, 69818, 69787, 69818, 69797,
+			69818, 69937, 69927, 69938, 69927, 70471, 70462, 70471, 70487, 70841, 70842, 70841, 70832, 70841, 70845, 71096, 71087, 71097, 71087, 71989, 71984, 119127, 119141, 119128,
+			119141, 119128, 119141, 119150, 119128, 119141, 119151, 119128, 119141, 119152, 119128, 119141, 119153, 119128, 119141, 119154, 119225, 119141, 119226, 119141, 119225, 119141, 119150, 119226,
+			119141, 119150, 119225, 119141, 119151, 119226, 119141, 119151, 20029, 20024, 20033, 131362, 20320, 20398, 20411, 20482, 20602, 20633, 20711, 20687, 13470, 132666, 20813, 20820,
+			20836, 20855, 132380, 13497, 20839, 20877, 132427, 20887, 20900, 20172, 20908, 20917, 168415, 20981, 20995, 13535, 21051, 21062, 21106, 21111, 13589, 21191, 21193, 21220,
+			21242, 21253, 21254, 21271, 21321, 21329, 21338, 21363, 21373, 21375, 21375, 21375, 133676, 28784, 21450, 21471, 133987, 21483, 21489, 21510, 21662, 21560, 21576, 21608,
+			21666, 21750, 21776, 21843, 21859, 21892, 21892, 21913, 21931, 21939, 21954, 22294, 22022, 22295, 22097, 22132, 20999, 22766, 22478, 22516, 22541, 22411, 22578, 22577,
+			22700, 136420, 22770, 22775, 22790, 22810, 22818, 22882, 136872, 136938, 23020, 23067, 23079, 23000, 23142, 14062, 14076, 23304, 23358, 23358, 137672, 23491, 23512, 23527,
+			23539, 138008, 23551, 23558, 24403, 23586, 14209, 23648, 23662, 23744, 23693, 138724, 23875, 138726, 23918, 23915, 23932, 24033, 24034, 14383, 24061, 24104, 24125, 24169,
+			14434, 139651, 14460, 24240, 24243, 24246, 24266, 172946, 24318, 140081, 140081, 33281, 24354, 24354, 14535, 144056, 156122, 24418, 24427, 14563, 24474, 24525, 24535, 24569,
+			24705, 14650, 14620, 24724, 141012, 24775, 24904, 24908, 24910, 24908, 24954, 24974, 25010, 24996, 25007, 25054, 25074, 25078, 25104, 25115, 25181, 25265, 25300, 25424,
+			142092, 25405, 25340, 25448, 25475, 25572, 142321, 25634, 25541, 25513, 14894, 25705, 25726, 25757, 25719, 14956, 25935, 25964, 143370, 26083, 26360, 26185, 15129, 26257,
+			15112, 15076, 20882, 20885, 26368, 26268, 32941, 17369, 26391, 26395, 26401, 26462, 26451, 144323, 15177, 26618, 26501, 26706, 26757, 144493, 26766, 26655, 26900, 15261,
+			26946, 27043, 27114, 27304, 145059, 27355, 15384, 27425, 145575, 27476, 15438, 27506, 27551, 27578, 27579, 146061, 138507, 146170, 27726, 146620, 27839, 27853, 27751, 27926,
+			27966, 28023, 27969, 28009, 28024, 28037, 146718, 27956, 28207, 28270, 15667, 28363, 28359, 147153, 28153, 28526, 147294, 147342, 28614, 28729, 28702, 28699, 15766, 28746,
+			28797, 28791, 28845, 132389, 28997, 148067, 29084, 148395, 29224, 29237, 29264, 149000, 29312, 29333, 149301, 149524, 29562, 29579, 16044, 29605, 16056, 16056, 29767, 29788,
+			29809, 29829, 29898, 16155, 29988, 150582, 30014, 150674, 30064, 139679, 30224, 151457, 151480, 151620, 16380, 16392, 30452, 151795, 151794, 151833, 151859, 30494, 30495, 30495,
+			30538, 16441, 30603, 16454, 16534, 152605, 30798, 30860, 30924, 16611, 153126, 31062, 153242, 153285, 31119, 31211, 16687, 31296, 31306, 31311, 153980, 154279, 154279, 31470,
+			16898, 154539, 31686, 31689, 16935, 154752, 31954, 17056, 31976, 31971, 32000, 155526, 32099, 17153, 32199, 32258, 32325, 17204, 156200, 156231, 17241, 156377, 32634, 156478,
+			32661, 32762, 32773, 156890, 156963, 32864, 157096, 32880, 144223, 17365, 32946, 33027, 17419, 33086, 23221, 157607, 157621, 144275, 144284, 33281, 33284, 36766, 17515, 33425,
+			33419, 33437, 21171, 33457, 33459, 33469, 33510, 158524, 33509, 33565, 33635, 33709, 33571, 33725, 33767, 33879, 33619, 33738, 33740, 33756, 158774, 159083, 158933, 17707,
+			34033, 34035, 34070, 160714, 34148, 159532, 17757, 17761, 159665, 159954, 17771, 34384, 34396, 34407, 34409, 34473, 34440, 34574, 34530, 34681, 34600, 34667, 34694, 17879,
+			34785, 34817, 17913, 34912, 34915, 161383, 35031, 35038, 17973, 35066, 13499, 161966, 162150, 18110, 18119, 35488, 35565, 35722, 35925, 162984, 36011, 36033, 36123, 36215,
+			163631, 133124, 36299, 36284, 36336, 133342, 36564, 36664, 165330, 165357, 37012, 37105, 37137, 165678, 37147, 37432, 37591, 37592, 37500, 37881, 37909, 166906, 38283, 18837,
+			38327, 167287, 18918, 38595, 23986, 38691, 168261, 168474, 19054, 19062, 38880, 168970, 19122, 169110, 38923, 38923, 38953, 169398, 39138, 19251, 39209, 39335, 39362, 39422,
+			19406, 170800, 39698, 40000, 40189, 19662, 19693, 40295, 172238, 19704, 172293, 172558, 172689, 40635, 19798, 40697, 40702, 40709, 40719, 40726, 40763, 173568,
+		};
+
+		// Full compatibility decompositions (NFKD) where they differ from NFD: code point << 32 | pool offset << 8 | length
+		inline constexpr uint64_t compatibility_decompositions[3750] = {
+			0x000000A000000001, 0x000000A800000102, 0x000000AA00000301, 0x000000AF00000402,
+			0x000000B200000601, 0x000000B300000701, 0x000000B400000802, 0x000000B500000A01,
+			0x000000B800000B02, 0x000000B900000D01, 0x000000BA00000E01, 0x000000BC00000F03,
+			0x000000BD00001203, 0x000000BE00001503, 0x0000013200001802, 0x0000013300001A02,
+			0x0000013F00001C02, 0x0000014000001E02, 0x0000014900002002, 0x0000017F00002201,
+			0x000001C400002303, 0x000001C500002603, 0x000001C600002903, 0x000001C700002C02,
+			0x000001C800002E02, 0x000001C900003002, 0x000001CA00003202, 0x000001CB00003402,
+			0x000001CC00003602, 0x000001F100003802, 0x000001F200003A02, 0x000001F300003C02,
+			0x000002B000003E01, 0x000002B100003F01, 0x000002B200004001, 0x000002B300004101,
+			0x000002B400004201, 0x000002B500004301, 0x000002B600004401, 0x000002B700004501,
+			0x000002B800004601, 0x000002D800004702, 0x000002D900004902, 0x000002DA00004B02,
+			0x000002DB00004D02, 0x000002DC00004F02, 0x000002DD00005102, 0x000002E000005301,
+			0x000002E100005401, 0x000002E200005501, 0x000002E300005601, 0x000002E400005701,
+			0x0000037A00005802, 0x0000038400005A02, 0x0000038500005C03, 0x000003D000005F01,
+			0x000003D100006001, 0x000003D200006101, 0x000003D300006202, 0x000003D400006402,
+			0x000003D500006601, 0x000003D600006701, 0x000003F000006801, 0x000003F100006901,
+			0x000003F200006A01, 0x000003F400006B01, 0x000003F500006C01, 0x000003F900006D01,
+			0x0000058700006E02, 0x0000067500007002, 0x0000067600007202, 0x0000067700007402,
+			0x0000067800007602, 0x00000E3300007802, 0x00000EB300007A02, 0x00000EDC00007C02,
+			0x00000EDD00007E02, 0x00000F0C00008001, 0x00000F7700008103, 0x00000F7900008403,
+			0x000010FC00008701, 0x00001D2C00008801, 0x00001D2D00008901, 0x00001D2E00008A01,
+			0x00001D3000008B01, 0x00001D3100008C01, 0x00001D3200008D01, 0x00001D3300008E01,
+			0x00001D3400008F01, 0x00001D3500009001, 0x00001D3600009101, 0x00001D3700009201,
+			0x00001D3800009301, 0x00001D3900009401, 0x00001D3A00009501, 0x00001D3C00009601,
+			0x00001D3D00009701, 0x00001D3E00009801, 0x00001D3F00009901, 0x00001D4000009A01,
+			0x00001D4100009B01, 0x00001D4200009C01, 0x00001D4300009D01, 0x00001D4400009E01,
+			0x00001D4500009F01, 0x00001D460000A001, 0x00001D470000A101, 0x00001D480000A201,
+			0x00001D490000A301, 0x00001D4A0000A401, 0x00001D4B0000A501, 0x00001D4C0000A601,
+			0x00001D4D0000A701, 0x00001D4F0000A801, 0x00001D500000A901, 0x00001D510000AA01,
+			0x00001D520000AB01, 0x00001D530000AC01, 0x00001D540000AD01, 0x00001D550000AE01,
+			0x00001D560000AF01, 0x00001D570000B001, 0x00001D580000B101, 0x00001D590000B201,
+			0x00001D5A0000B301, 0x00001D5B0000B401, 0x00001D5C0000B501, 0x00001D5D0000B601,
+			0x00001D5E0000B701, 0x00001D5F0000B801, 0x00001D600000B901, 0x00001D610000BA01,
+			0x00001D620000BB01, 0x00001D630000BC01, 0x00001D640000BD01, 0x00001D650000BE01,
+			0x00001D660000BF01, 0x00001D670000C001, 0x00001D680000C101, 0x00001D690000C201,
+			0x00001D6A0000C301, 0x00001D780000C401, 0x00001D9B0000C501, 0x00001D9C0000C601,
+			0x00001D9D0000C701, 0x00001D9E0000C801, 0x00001D9F0000C901, 0x00001DA00000CA01,
+			0x00001DA10000CB01, 0x00001DA20000CC01, 0x00001DA30000CD01, 0x00001DA40000CE01,
+			0x00001DA50000CF01, 0x00001DA60000D001, 0x00001DA70000D101, 0x00001DA80000D201,
+			0x00001DA90000D301, 0x00001DAA0000D401, 0x00001DAB0000D501, 0x00001DAC0000D601,
+			0x00001DAD0000D701, 0x00001DAE0000D801, 0x00001DAF0000D901, 0x00001DB00000DA01,
+			0x00001DB10000DB01, 0x00001DB20000DC01, 0x00001DB30000DD01, 0x00001DB40000DE01,
+			0x00001DB50000DF01, 0x00001DB60000E001, 0x00001DB70000E101, 0x00001DB80000E201,
+			0x00001DB90000E301, 0x00001DBA0000E401, 0x00001DBB0000E501, 0x00001DBC0000E601,
+			0x00001DBD0000E701, 0x00001DBE0000E801, 0x00001DBF0000E901, 0x00001E9A0000EA02,
+			0x00001E9B0000EC02, 0x00001FBD0000EE02, 0x00001FBF0000F002, 0x00001FC00000F202,
+			0x00001FC10000F403, 0x00001FCD0000F703, 0x00001FCE0000FA03, 0x00001FCF0000FD03,
+			0x00001FDD00010003, 0x00001FDE00010303, 0x00001FDF00010603, 0x00001FED00010903,
+			0x00001FEE00010C03, 0x00001FFD00010F02, 0x00001FFE00011102, 0x0000200000011301,
+			0x0000200100011401, 0x0000200200011501, 0x0000200300011601, 0x0000200400011701,
+			0x0000200500011801, 0x0000200600011901, 0x0000200700011A01, 0x0000200800011B01,
+			0x0000200900011C01, 0x0000200A00011D01, 0x0000201100011E01, 0x0000201700011F02,
+			0x0000202400012101, 0x0000202500012202, 0x0000202600012403, 0x0000202F00012701,
+			0x0000203300012802, 0x0000203400012A03, 0x0000203600012D02, 0x0000203700012F03,
+			0x0000203C00013202, 0x0000203E00013402, 0x0000204700013602, 0x0000204800013802,
+			0x0000204900013A02, 0x0000205700013C04, 0x0000205F00014001, 0x0000207000014101,
+			0x0000207100014201, 0x0000207400014301, 0x0000207500014401, 0x0000207600014501,
+			0x0000207700014601, 0x0000207800014701, 0x0000207900014801, 0x0000207A00014901,
+			0x0000207B00014A01, 0x0000207C00014B01, 0x0000207D00014C01, 0x0000207E00014D01,
+			0x0000207F00014E01, 0x0000208000014F01, 0x0000208100015001, 0x0000208200015101,
+			0x0000208300015201, 0x0000208400015301, 0x0000208500015401, 0x0000208600015501,
+			0x0000208700015601, 0x0000208800015701, 0x0000208900015801, 0x0000208A00015901,
+			0x0000208B00015A01, 0x0000208C00015B01, 0x0000208D00015C01, 0x0000208E00015D01,
+			0x0000209000015E01, 0x0000209100015F01, 0x0000209200016001, 0x0000209300016101,
+			0x0000209400016201, 0x0000209500016301, 0x0000209600016401, 0x0000209700016501,
+			0x0000209800016601, 0x0000209900016701, 0x0000209A00016801, 0x0000209B00016901,
+			0x0000209C00016A01, 0x000020A800016B02, 0x0000210000016D03, 0x0000210100017003,
+			0x0000210200017301, 0x0000210300017402, 0x0000210500017603, 0x0000210600017903,
+			0x0000210700017C01, 0x0000210900017D02, 0x0000210A00017F01, 0x0000210B00018001,
+			0x0000210C00018101, 0x0000210D00018201, 0x0000210E00018301, 0x0000210F00018401,
+			0x0000211000018501, 0x0000211100018601, 0x0000211200018701, 0x0000211300018801,
+			0x0000211500018901, 0x0000211600018A02, 0x0000211900018C01, 0x0000211A00018D01,
+			0x0000211B00018E01, 0x0000211C00018F01, 0x0000211D00019001, 0x0000212000019102,
+			0x0000212100019303, 0x0000212200019602, 0x0000212400019801, 0x0000212800019901,
+			0x0000212C00019A01, 0x0000212D00019B01, 0x0000212F00019C01, 0x0000213000019D01,
+			0x0000213100019E01, 0x0000213300019F01, 0x000021340001A001, 0x000021350001A101,
+			0x000021360001A201, 0x000021370001A301, 0x000021380001A401, 0x000021390001A501,
+			0x0000213B0001A603, 0x0000213C0001A901, 0x0000213D0001AA01, 0x0000213E0001AB01,
+			0x0000213F0001AC01, 0x000021400001AD01, 0x000021450001AE01, 0x000021460001AF01,
+			0x000021470001B001, 0x000021480001B101, 0x000021490001B201, 0x000021500001B303,
+			0x000021510001B603, 0x000021520001B904, 0x000021530001BD03, 0x000021540001C003,
+			0x000021550001C303, 0x000021560001C603, 0x000021570001C903, 0x000021580001CC03,
+			0x000021590001CF03, 0x0000215A0001D203, 0x0000215B0001D503, 0x0000215C0001D803,
+			0x0000215D0001DB03, 0x0000215E0001DE03, 0x0000215F0001E102, 0x000021600001E301,
+			0x000021610001E402, 0x000021620001E603, 0x000021630001E902, 0x000021640001EB01,
+			0x000021650001EC02, 0x000021660001EE03, 0x000021670001F104, 0x000021680001F502,
+			0x000021690001F701, 0x0000216A0001F802, 0x0000216B0001FA03, 0x0000216C0001FD01,
+			0x0000216D0001FE01, 0x0000216E0001FF01, 0x0000216F00020001, 0x0000217000020101,
+			0x0000217100020202, 0x0000217200020403, 0x0000217300020702, 0x0000217400020901,
+			0x0000217500020A02, 0x0000217600020C03, 0x0000217700020F04, 0x0000217800021302,
+			0x0000217900021501, 0x0000217A00021602, 0x0000217B00021803, 0x0000217C00021B01,
+			0x0000217D00021C01, 0x0000217E00021D01, 0x0000217F00021E01, 0x0000218900021F03,
+			0x0000222C00022202, 0x0000222D00022403, 0x0000222F00022702, 0x0000223000022903,
+			0x0000246000022C01, 0x0000246100022D01, 0x0000246200022E01, 0x0000246300022F01,
+			0x0000246400023001, 0x0000246500023101, 0x0000246600023201, 0x0000246700023301,
+			0x0000246800023401, 0x0000246900023502, 0x0000246A00023702, 0x0000246B00023902,
+			0x0000246C00023B02, 0x0000246D00023D02, 0x0000246E00023F02, 0x0000246F00024102,
+			0x0000247000024302, 0x0000247100024502, 0x0000247200024702, 0x0000247300024902,
+			0x0000247400024B03, 0x0000247500024E03, 0x0000247600025103, 0x0000247700025403,
+			0x0000247800025703, 0x0000247900025A03, 0x0000247A00025D03, 0x0000247B00026003,
+			0x0000247C00026303, 0x0000247D00026604, 0x0000247E00026A04, 0x0000247F00026E04,
+			0x0000248000027204, 0x0000248100027604, 0x0000248200027A04, 0x0000248300027E04,
+			0x0000248400028204, 0x0000248500028604, 0x0000248600028A04, 0x0000248700028E04,
+			0x0000248800029202, 0x0000248900029402, 0x0000248A00029602, 0x0000248B00029802,
+			0x0000248C00029A02, 0x0000248D00029C02, 0x0000248E00029E02, 0x0000248F0002A002,
+			0x000024900002A202, 0x000024910002A403, 0x000024920002A703, 0x000024930002AA03,
+			0x000024940002AD03, 0x000024950002B003, 0x000024960002B303, 0x000024970002B603,
+			0x000024980002B903, 0x000024990002BC03, 0x0000249A0002BF03, 0x0000249B0002C203,
+			0x0000249C0002C503, 0x0000249D0002C803, 0x0000249E0002CB03, 0x0000249F0002CE03,
+			0x000024A00002D103, 0x000024A10002D403, 0x000024A20002D703, 0x000024A30002DA03,
+			0x000024A40002DD03, 0x000024A50002E003, 0x000024A60002E303, 0x000024A70002E603,
+			0x000024A80002E903, 0x000024A90002EC03, 0x000024AA0002EF03, 0x000024AB0002F203,
+			0x000024AC0002F503, 0x000024AD0002F803, 0x000024AE0002FB03, 0x000024AF0002FE03,
+			0x000024B000030103, 0x000024B100030403, 0x000024B200030703, 0x000024B300030A03,
+			0x000024B400030D03, 0x000024B500031003, 0x000024B600031301, 0x000024B700031401,
+			0x000024B800031501, 0x000024B900031601, 0x000024BA00031701, 0x000024BB00031801,
+			0x000024BC00031901, 0x000024BD00031A01, 0x000024BE00031B01, 0x000024BF00031C01,
+			0x000024C000031D01, 0x000024C100031E01, 0x000024C200031F01, 0x000024C300032001,
+			0x000024C400032101, 0x000024C500032201, 0x000024C600032301, 0x000024C700032401,
+			0x000024C800032501, 0x000024C900032601, 0x000024CA00032701, 0x000024CB00032801,
+			0x000024CC00032901, 0x000024CD00032A01, 0x000024CE00032B01, 0x000024CF00032C01,
+			0x000024D000032D01, 0x000024D100032E01, 0x000024D200032F01, 0x000024D300033001,
+			0x000024D400033101, 0x000024D500033201, 0x000024D600033301, 0x000024D700033401,
+			0x000024D800033501, 0x000024D900033601, 0x000024DA00033701, 0x000024DB00033801,
+			0x000024DC00033901, 0x000024DD00033A01, 0x000024DE00033B01, 0x000024DF00033C01,
+			0x000024E000033D01, 0x000024E100033E01, 0x000024E200033F01, 0x000024E300034001,
+			0x000024E400034101, 0x000024E500034201, 0x000024E600034301, 0x000024E700034401,
+			0x000024E800034501, 0x000024E900034601, 0x000024EA00034701, 0x00002A0C00034804,
+			0x00002A7400034C03, 0x00002A7500034F02, 0x00002A7600035103, 0x00002C7C00035401,
+			0x00002C7D00035501, 0x00002D6F00035601, 0x00002E9F00035701, 0x00002EF300035801,
+			0x00002F0000035901, 0x00002F0100035A01, 0x00002F0200035B01, 0x00002F0300035C01,
+			0x00002F0400035D01, 0x00002F0500035E01, 0x00002F0600035F01, 0x00002F0700036001,
+			0x00002F0800036101, 0x00002F0900036201, 0x00002F0A00036301, 0x00002F0B00036401,
+			0x00002F0C00036501, 0x00002F0D00036601, 0x00002F0E00036701, 0x00002F0F00036801,
+			0x00002F1000036901, 0x00002F1100036A01, 0x00002F1200036B01, 0x00002F1300036C01,
+			0x00002F1400036D01, 0x00002F1500036E01, 0x00002F1600036F01, 0x00002F1700037001,
+			0x00002F1800037101, 0x00002F1900037201, 0x00002F1A00037301, 0x00002F1B00037401,
+			0x00002F1C00037501, 0x00002F1D00037601, 0x00002F1E00037701, 0x00002F1F00037801,
+			0x00002F2000037901, 0x00002F2100037A01, 0x00002F2200037B01, 0x00002F2300037C01,
+			0x00002F2400037D01, 0x00002F2500037E01, 0x00002F2600037F01, 0x00002F2700038001,
+			0x00002F2800038101, 0x00002F2900038201, 0x00002F2A00038301, 0x00002F2B00038401,
+			0x00002F2C00038501, 0x00002F2D00038601, 0x00002F2E00038701, 0x00002F2F00038801,
+			0x00002F3000038901, 0x00002F3100038A01, 0x00002F3200038B01, 0x00002F3300038C01,
+			0x00002F3400038D01, 0x00002F3500038E01, 0x00002F3600038F01, 0x00002F3700039001,
+			0x00002F3800039101, 0x00002F3900039201, 0x00002F3A00039301, 0x00002F3B00039401,
+			0x00002F3C00039501, 0x00002F3D00039601, 0x00002F3E00039701, 0x00002F3F00039801,
+			0x00002F4000039901, 0x00002F4100039A01, 0x00002F4200039B01, 0x00002F4300039C01,
+			0x00002F4400039D01, 0x00002F4500039E01, 0x00002F4600039F01, 0x00002F470003A001,
+			0x00002F480003A101, 0x00002F490003A201, 0x00002F4A0003A301, 0x00002F4B0003A401,
+			0x00002F4C0003A501, 0x00002F4D0003A601, 0x00002F4E0003A701, 0x00002F4F0003A801,
+			0x00002F500003A901, 0x00002F510003AA01, 0x00002F520003AB01, 0x00002F530003AC01,
+			0x00002F540003AD01, 0x00002F550003AE01, 0x00002F560003AF01, 0x00002F570003B001,
+			0x00002F580003B101, 0x00002F590003B201, 0x00002F5A0003B301, 0x00002F5B0003B401,
+			0x00002F5C0003B501, 0x00002F5D0003B601, 0x00002F5E0003B701, 0x00002F5F0003B801,
+			0x00002F600003B901, 0x00002F610003BA01, 0x00002F620003BB01, 0x00002F630003BC01,
+			0x00002F640003BD01, 0x00002F650003BE01, 0x00002F660003BF01, 0x00002F670003C001,
+			0x00002F680003C101, 0x00002F690003C201, 0x00002F6A0003C301, 0x00002F6B0003C401,
+			0x00002F6C0003C501, 0x00002F6D0003C601, 0x00002F6E0003C701, 0x00002F6F0003C801,
+			0x00002F700003C901, 0x00002F710003CA01, 0x00002F720003CB01, 0x00002F730003CC01,
+			0x00002F740003CD01, 0x00002F750003CE01, 0x00002F760003CF01, 0x00002F770003D001,
+			0x00002F780003D101, 0x00002F790003D201, 0x00002F7A0003D301, 0x00002F7B0003D401,
+			0x00002F7C0003D501, 0x00002F7D0003D601, 0x00002F7E0003D701, 0x00002F7F0003D801,
+			0x00002F800003D901, 0x00002F810003DA01, 0x00002F820003DB01, 0x00002F830003DC01,
+			0x00002F840003DD01, 0x00002F850003DE01, 0x00002F860003DF01, 0x00002F870003E001,
+			0x00002F880003E101, 0x00002F890003E201, 0x00002F8A0003E301, 0x00002F8B0003E401,
+			0x00002F8C0003E501, 0x00002F8D0003E601, 0x00002F8E0003E701, 0x00002F8F0003E801,
+			0x00002F900003E901, 0x00002F910003EA01, 0x00002F920003EB01, 0x00002F930003EC01,
+			0x00002F940003ED01, 0x00002F950003EE01, 0x00002F960003EF01, 0x00002F970003F001,
+			0x00002F980003F101, 0x00002F990003F201, 0x00002F9A0003F301, 0x00002F9B0003F401,
+			0x00002F9C0003F501, 0x00002F9D0003F601, 0x00002F9E0003F701, 0x00002F9F0003F801,
+			0x00002FA00003F901, 0x00002FA10003FA01, 0x00002FA20003FB01, 0x00002FA30003FC01,
+			0x00002FA40003FD01, 0x00002FA50003FE01, 0x00002FA60003FF01, 0x00002FA700040001,
+			0x00002FA800040101, 0x00002FA900040201, 0x00002FAA00040301, 0x00002FAB00040401,
+			0x00002FAC00040501, 0x00002FAD00040601, 0x00002FAE00040701, 0x00002FAF00040801,
+			0x00002FB000040901, 0x00002FB100040A01, 0x00002FB200040B01, 0x00002FB300040C01,
+			0x00002FB400040D01, 0x00002FB500040E01, 0x00002FB600040F01, 0x00002FB700041001,
+			0x00002FB800041101, 0x00002FB900041201, 0x00002FBA00041301, 0x00002FBB00041401,
+			0x00002FBC00041501, 0x00002FBD00041601, 0x00002FBE00041701, 0x00002FBF00041801,
+			0x00002FC000041901, 0x00002FC100041A01, 0x00002FC200041B01, 0x00002FC300041C01,
+			0x00002FC400041D01, 0x00002FC500041E01, 0x00002FC600041F01, 0x00002FC700042001,
+			0x00002FC800042101, 0x00002FC900042201, 0x00002FCA00042301, 0x00002FCB00042401,
+			0x00002FCC00042501, 0x00002FCD00042601, 0x00002FCE00042701, 0x00002FCF00042801,
+			0x00002FD000042901, 0x00002FD100042A01, 0x00002FD200042B01, 0x00002FD300042C01,
+			0x00002FD400042D01, 0x00002FD500042E01, 0x0000300000042F01, 0x0000303600043001,
+			0x0000303800043101, 0x0000303900043201, 0x0000303A00043301, 0x0000309B00043402,
+			0x0000309C00043602, 0x0000309F00043802, 0x000030FF00043A02, 0x0000313100043C01,
+			0x0000313200043D01, 0x0000313300043E01, 0x0000313400043F01, 0x0000313500044001,
+			0x0000313600044101, 0x0000313700044201, 0x0000313800044301, 0x0000313900044401,
+			0x0000313A00044501, 0x0000313B00044601, 0x0000313C00044701, 0x0000313D00044801,
+			0x0000313E00044901, 0x0000313F00044A01, 0x0000314000044B01, 0x0000314100044C01,
+			0x0000314200044D01, 0x0000314300044E01, 0x0000314400044F01, 0x0000314500045001,
+			0x0000314600045101, 0x0000314700045201, 0x0000314800045301, 0x0000314900045401,
+			0x0000314A00045501, 0x0000314B00045601, 0x0000314C00045701, 0x0000314D00045801,
+			0x0000314E00045901, 0x0000314F00045A01, 0x0000315000045B01, 0x0000315100045C01,
+			0x0000315200045D01, 0x0000315300045E01, 0x0000315400045F01, 0x0000315500046001,
+			0x0000315600046101, 0x0000315700046201, 0x0000315800046301, 0x0000315900046401,
+			0x0000315A00046501, 0x0000315B00046601, 0x0000315C00046701, 0x0000315D00046801,
+			0x0000315E00046901, 0x0000315F00046A01, 0x0000316000046B01, 0x0000316100046C01,
+			0x0000316200046D01, 0x0000316300046E01, 0x0000316400046F01, 0x0000316500047001,
+			0x0000316600047101, 0x0000316700047201, 0x0000316800047301, 0x0000316900047401,
+			0x0000316A00047501, 0x0000316B00047601, 0x0000316C00047701, 0x0000316D00047801,
+			0x0000316E00047901, 0x0000316F00047A01, 0x0000317000047B01, 0x0000317100047C01,
+			0x0000317200047D01, 0x0000317300047E01, 0x0000317400047F01, 0x0000317500048001,
+			0x0000317600048101, 0x0000317700048201, 0x0000317800048301, 0x0000317900048401,
+			0x0000317A00048501, 0x0000317B00048601, 0x0000317C00048701, 0x0000317D00048801,
+			0x0000317E00048901, 0x0000317F00048A01, 0x0000318000048B01, 0x0000318100048C01,
+			0x0000318200048D01, 0x0000318300048E01, 0x0000318400048F01, 0x0000318500049001,
+			0x0000318600049101, 0x0000318700049201, 0x0000318800049301, 0x0000318900049401,
+			0x0000318A00049501, 0x0000318B00049601, 0x0000318C00049701, 0x0000318D00049801,
+			0x0000318E00049901, 0x0000319200049A01, 0x0000319300049B01, 0x0000319400049C01,
+			0x0000319500049D01, 0x0000319600049E01, 0x0000319700049F01, 0x000031980004A001,
+			0x000031990004A101, 0x0000319A0004A201, 0x0000319B0004A301, 0x0000319C0004A401,
+			0x0000319D0004A501, 0x0000319E0004A601, 0x0000319F0004A701, 0x000032000004A803,
+			0x000032010004AB03, 0x000032020004AE03, 0x000032030004B103, 0x000032040004B403,
+			0x000032050004B703, 0x000032060004BA03, 0x000032070004BD03, 0x000032080004C003,
+			0x000032090004C303, 0x0000320A0004C603, 0x0000320B0004C903, 0x0000320C0004CC03,
+			0x0000320D0004CF03, 0x0000320E0004D204, 0x0000320F0004D604, 0x000032100004DA04,
+			0x000032110004DE04, 0x000032120004E204, 0x000032130004E604, 0x000032140004EA04,
+			0x000032150004EE04, 0x000032160004F204, 0x000032170004F604, 0x000032180004FA04,
+			0x000032190004FE04, 0x0000321A00050204, 0x0000321B00050604, 0x0000321C00050A04,
+			0x0000321D00050E07, 0x0000321E00051506, 0x0000322000051B03, 0x0000322100051E03,
+			0x0000322200052103, 0x0000322300052403, 0x0000322400052703, 0x0000322500052A03,
+			0x0000322600052D03, 0x0000322700053003, 0x0000322800053303, 0x0000322900053603,
+			0x0000322A00053903, 0x0000322B00053C03, 0x0000322C00053F03, 0x0000322D00054203,
+			0x0000322E00054503, 0x0000322F00054803, 0x0000323000054B03, 0x0000323100054E03,
+			0x0000323200055103, 0x0000323300055403, 0x0000323400055703, 0x0000323500055A03,
+			0x0000323600055D03, 0x0000323700056003, 0x0000323800056303, 0x0000323900056603,
+			0x0000323A00056903, 0x0000323B00056C03, 0x0000323C00056F03, 0x0000323D00057203,
+			0x0000323E00057503, 0x0000323F00057803, 0x0000324000057B03, 0x0000324100057E03,
+			0x0000324200058103, 0x0000324300058403, 0x0000324400058701, 0x0000324500058801,
+			0x0000324600058901, 0x0000324700058A01, 0x0000325000058B03, 0x0000325100058E02,
+			0x0000325200059002, 0x0000325300059202, 0x0000325400059402, 0x0000325500059602,
+			0x0000325600059802, 0x0000325700059A02, 0x0000325800059C02, 0x0000325900059E02,
+			0x0000325A0005A002, 0x0000325B0005A202, 0x0000325C0005A402, 0x0000325D0005A602,
+			0x0000325E0005A802, 0x0000325F0005AA02, 0x000032600005AC01, 0x000032610005AD01,
+			0x000032620005AE01, 0x000032630005AF01, 0x000032640005B001, 0x000032650005B101,
+			0x000032660005B201, 0x000032670005B301, 0x000032680005B401, 0x000032690005B501,
+			0x0000326A0005B601, 0x0000326B0005B701, 0x0000326C0005B801, 0x0000326D0005B901,
+			0x0000326E0005BA02, 0x0000326F0005BC02, 0x000032700005BE02, 0x000032710005C002,
+			0x000032720005C202, 0x000032730005C402, 0x000032740005C602, 0x000032750005C802,
+			0x000032760005CA02, 0x000032770005CC02, 0x000032780005CE02, 0x000032790005D002,
+			0x0000327A0005D202, 0x0000327B0005D402, 0x0000327C0005D605, 0x0000327D0005DB04,
+			0x0000327E0005DF02, 0x000032800005E101, 0x000032810005E201, 0x000032820005E301,
+			0x000032830005E401, 0x000032840005E501, 0x000032850005E601, 0x000032860005E701,
+			0x000032870005E801, 0x000032880005E901, 0x000032890005EA01, 0x0000328A0005EB01,
+			0x0000328B0005EC01, 0x0000328C0005ED01, 0x0000328D0005EE01, 0x0000328E0005EF01,
+			0x0000328F0005F001, 0x000032900005F101, 0x000032910005F201, 0x000032920005F301,
+			0x000032930005F401, 0x000032940005F501, 0x000032950005F601, 0x000032960005F701,
+			0x000032970005F801, 0x000032980005F901, 0x000032990005FA01, 0x0000329A0005FB01,
+			0x0000329B0005FC01, 0x0000329C0005FD01, 0x0000329D0005FE01, 0x0000329E0005FF01,
+			0x0000329F00060001, 0x000032A000060101, 0x000032A100060201, 0x000032A200060301,
+			0x000032A300060401, 0x000032A400060501, 0x000032A500060601, 0x000032A600060701,
+			0x000032A700060801, 0x000032A800060901, 0x000032A900060A01, 0x000032AA00060B01,
+			0x000032AB00060C01, 0x000032AC00060D01, 0x000032AD00060E01, 0x000032AE00060F01,
+			0x000032AF00061001, 0x000032B000061101, 0x000032B100061202, 0x000032B200061402,
+			0x000032B300061602, 0x000032B400061802, 0x000032B500061A02, 0x000032B600061C02,
+			0x000032B700061E02, 0x000032B800062002, 0x000032B900062202, 0x000032BA00062402,
+			0x000032BB00062602, 0x000032BC00062802, 0x000032BD00062A02, 0x000032BE00062C02,
+			0x000032BF00062E02, 0x000032C000063002, 0x000032C100063202, 0x000032C200063402,
+			0x000032C300063602, 0x000032C400063802, 0x000032C500063A02, 0x000032C600063C02,
+			0x000032C700063E02, 0x000032C800064002, 0x000032C900064203, 0x000032CA00064503,
+			0x000032CB00064803, 0x000032CC00064B02, 0x000032CD00064D03, 0x000032CE00065002,
+			0x000032CF00065203, 0x000032D000065501, 0x000032D100065601, 0x000032D200065701,
+			0x000032D300065801, 0x000032D400065901, 0x000032D500065A01, 0x000032D600065B01,
+			0x000032D700065C01, 0x000032D800065D01, 0x000032D900065E01, 0x000032DA00065F01,
+			0x000032DB00066001, 0x000032DC00066101, 0x000032DD00066201, 0x000032DE00066301,
+			0x000032DF00066401, 0x000032E000066501, 0x000032E100066601, 0x000032E200066701,
+			0x000032E300066801, 0x000032E400066901, 0x000032E500066A01, 0x000032E600066B01,
+			0x000032E700066C01, 0x000032E800066D01, 0x000032E900066E01, 0x000032EA00066F01,
+			0x000032EB00067001, 0x000032EC00067101, 0x000032ED00067201, 0x000032EE00067301,
+			0x000032EF00067401, 0x000032F000067501, 0x000032F100067601, 0x000032F200067701,
+			0x000032F300067801, 0x000032F400067901, 0x000032F500067A01, 0x000032F600067B01,
+			0x000032F700067C01, 0x000032F800067D01, 0x000032F900067E01, 0x000032FA00067F01,
+			0x000032FB00068001, 0x000032FC00068101, 0x000032FD00068201, 0x000032FE00068301,
+			0x000032FF00068402, 0x0000330000068605, 0x0000330100068B04, 0x0000330200068F05,
+			0x0000330300069403, 0x0000330400069705, 0x0000330500069C03, 0x0000330600069F03,
+			0x000033070006A206, 0x000033080006A804, 0x000033090006AC03, 0x0000330A0006AF03,
+			0x0000330B0006B203, 0x0000330C0006B504, 0x0000330D0006B904, 0x0000330E0006BD04,
+			0x0000330F0006C104, 0x000033100006C504, 0x000033110006C904, 0x000033120006CD04,
+			0x000033130006D106, 0x000033140006D702, 0x000033150006D906, 0x000033160006DF06,
+			0x000033170006E505, 0x000033180006EA04, 0x000033190006EE06, 0x0000331A0006F406,
+			0x0000331B0006FA04, 0x0000331C0006FE03, 0x0000331D00070103, 0x0000331E00070404,
+			0x0000331F00070804, 0x0000332000070C05, 0x0000332100071105, 0x0000332200071603,
+			0x0000332300071903, 0x0000332400071C04, 0x0000332500072003, 0x0000332600072303,
+			0x0000332700072602, 0x0000332800072802, 0x0000332900072A03, 0x0000332A00072D03,
+			0x0000332B00073006, 0x0000332C00073604, 0x0000332D00073A05, 0x0000332E00073F06,
+			0x0000332F00074504, 0x0000333000074903, 0x0000333100074C03, 0x0000333200074F06,
+			0x0000333300075504, 0x0000333400075906, 0x0000333500075F03, 0x0000333600076205,
+			0x0000333700076703, 0x0000333800076A04, 0x0000333900076E03, 0x0000333A00077104,
+			0x0000333B00077505, 0x0000333C00077A04, 0x0000333D00077E05, 0x0000333E00078304,
+			0x0000333F00078702, 0x0000334000078905, 0x0000334100078E03, 0x0000334200079103,
+			0x0000334300079404, 0x0000334400079803, 0x0000334500079B03, 0x0000334600079E03,
+			0x000033470007A105, 0x000033480007A604, 0x000033490007AA02, 0x0000334A0007AC06,
+			0x0000334B0007B203, 0x0000334C0007B505, 0x0000334D0007BA04, 0x0000334E0007BE04,
+			0x0000334F0007C203, 0x000033500007C503, 0x000033510007C804, 0x000033520007CC02,
+			0x000033530007CE04, 0x000033540007D205, 0x000033550007D702, 0x000033560007D906,
+			0x000033570007DF03, 0x000033580007E202, 0x000033590007E402, 0x0000335A0007E602,
+			0x0000335B0007E802, 0x0000335C0007EA02, 0x0000335D0007EC02, 0x0000335E0007EE02,
+			0x0000335F0007F002, 0x000033600007F202, 0x000033610007F402, 0x000033620007F603,
+			0x000033630007F903, 0x000033640007FC03, 0x000033650007FF03, 0x0000336600080203,
+			0x0000336700080503, 0x0000336800080803, 0x0000336900080B03, 0x0000336A00080E03,
+			0x0000336B00081103, 0x0000336C00081403, 0x0000336D00081703, 0x0000336E00081A03,
+			0x0000336F00081D03, 0x0000337000082003, 0x0000337100082303, 0x0000337200082602,
+			0x0000337300082802, 0x0000337400082A03, 0x0000337500082D02, 0x0000337600082F02,
+			0x0000337700083102, 0x0000337800083303, 0x0000337900083603, 0x0000337A00083902,
+			0x0000337B00083B02, 0x0000337C00083D02, 0x0000337D00083F02, 0x0000337E00084102,
+			0x0000337F00084304, 0x0000338000084702, 0x0000338100084902, 0x0000338200084B02,
+			0x0000338300084D02, 0x0000338400084F02, 0x0000338500085102, 0x0000338600085302,
+			0x0000338700085502, 0x0000338800085703, 0x0000338900085A04, 0x0000338A00085E02,
+			0x0000338B00086002, 0x0000338C00086202, 0x0000338D00086402, 0x0000338E00086602,
+			0x0000338F00086802, 0x0000339000086A02, 0x0000339100086C03, 0x0000339200086F03,
+			0x0000339300087203, 0x0000339400087503, 0x0000339500087802, 0x0000339600087A02,
+			0x0000339700087C02, 0x0000339800087E02, 0x0000339900088002, 0x0000339A00088202,
+			0x0000339B00088402, 0x0000339C00088602, 0x0000339D00088802, 0x0000339E00088A02,
+			0x0000339F00088C03, 0x000033A000088F03, 0x000033A100089202, 0x000033A200089403,
+			0x000033A300089703, 0x000033A400089A03, 0x000033A500089D02, 0x000033A600089F03,
+			0x000033A70008A203, 0x000033A80008A504, 0x000033A90008A902, 0x000033AA0008AB03,
+			0x000033AB0008AE03, 0x000033AC0008B103, 0x000033AD0008B403, 0x000033AE0008B705,
+			0x000033AF0008BC06, 0x000033B00008C202, 0x000033B10008C402, 0x000033B20008C602,
+			0x000033B30008C802, 0x000033B40008CA02, 0x000033B50008CC02, 0x000033B60008CE02,
+			0x000033B70008D002, 0x000033B80008D202, 0x000033B90008D402, 0x000033BA0008D602,
+			0x000033BB0008D802, 0x000033BC0008DA02, 0x000033BD0008DC02, 0x000033BE0008DE02,
+			0x000033BF0008E002, 0x000033C00008E202, 0x000033C10008E402, 0x000033C20008E604,
+			0x000033C30008EA02, 0x000033C40008EC02, 0x000033C50008EE02, 0x000033C60008F004,
+			0x000033C70008F403, 0x000033C80008F702, 0x000033C90008F902, 0x000033CA0008FB02,
+			0x000033CB0008FD02, 0x000033CC0008FF02, 0x000033CD00090102, 0x000033CE00090302,
+			0x000033CF00090502, 0x000033D000090702, 0x000033D100090902, 0x000033D200090B03,
+			0x000033D300090E02, 0x000033D400091002, 0x000033D500091203, 0x000033D600091503,
+			0x000033D700091802, 0x000033D800091A04, 0x000033D900091E03, 0x000033DA00092102,
+			0x000033DB00092302, 0x000033DC00092502, 0x000033DD00092702, 0x000033DE00092903,
+			0x000033DF00092C03, 0x000033E000092F02, 0x000033E100093102, 0x000033E200093302,
+			0x000033E300093502, 0x000033E400093702, 0x000033E500093902, 0x000033E600093B02,
+			0x000033E700093D02, 0x000033E800093F02, 0x000033E900094103, 0x000033EA00094403,
+			0x000033EB00094703, 0x000033EC00094A03, 0x000033ED00094D03, 0x000033EE00095003,
+			0x000033EF00095303, 0x000033F000095603, 0x000033F100095903, 0x000033F200095C03,
+			0x000033F300095F03, 0x000033F400096203, 0x000033F500096503, 0x000033F600096803,
+			0x000033F700096B03, 0x000033F800096E03, 0x000033F900097103, 0x000033FA00097403,
+			0x000033FB00097703, 0x000033FC00097A03, 0x000033FD00097D03, 0x000033FE00098003,
+			0x000033FF00098303, 0x0000A69C00098601, 0x0000A69D00098701, 0x0000A77000098801,
+			0x0000A7F200098901, 0x0000A7F300098A01, 0x0000A7F400098B01, 0x0000A7F800098C01,
+			0x0000A7F900098D01, 0x0000AB5C00098E01, 0x0000AB5D00098F01, 0x0000AB5E00099001,
+			0x0000AB5F00099101, 0x0000AB6900099201, 0x0000FB0000099302, 0x0000FB0100099502,
+			0x0000FB0200099702, 0x0000FB0300099903, 0x0000FB0400099C03, 0x0000FB0500099F02,
+			0x0000FB060009A102, 0x0000FB130009A302, 0x0000FB140009A502, 0x0000FB150009A702,
+			0x0000FB160009A902, 0x0000FB170009AB02, 0x0000FB200009AD01, 0x0000FB210009AE01,
+			0x0000FB220009AF01, 0x0000FB230009B001, 0x0000FB240009B101, 0x0000FB250009B201,
+			0x0000FB260009B301, 0x0000FB270009B401, 0x0000FB280009B501, 0x0000FB290009B601,
+			0x0000FB4F0009B702, 0x0000FB500009B901, 0x0000FB510009BA01, 0x0000FB520009BB01,
+			0x0000FB530009BC01, 0x0000FB540009BD01, 0x0000FB550009BE01, 0x0000FB560009BF01,
+			0x0000FB570009C001, 0x0000FB580009C101, 0x0000FB590009C201, 0x0000FB5A0009C301,
+			0x0000FB5B0009C401, 0x0000FB5C0009C501, 0x0000FB5D0009C601, 0x0000FB5E0009C701,
+			0x0000FB5F0009C801, 0x0000FB600009C901, 0x0000FB610009CA01, 0x0000FB620009CB01,
+			0x0000FB630009CC01, 0x0000FB640009CD01, 0x0000FB650009CE01, 0x0000FB660009CF01,
+			0x0000FB670009D001, 0x0000FB680009D101, 0x0000FB690009D201, 0x0000FB6A0009D301,
+			0x0000FB6B0009D401, 0x0000FB6C0009D501, 0x0000FB6D0009D601, 0x0000FB6E0009D701,
+			0x0000FB6F0009D801, 0x0000FB700009D901, 0x0000FB710009DA01, 0x0000FB720009DB01,
+			0x0000FB730009DC01, 0x0000FB740009DD01, 0x0000FB750009DE01, 0x0000FB760009DF01,
+			0x0000FB770009E001, 0x0000FB780009E101, 0x0000FB790009E201, 0x0000FB7A0009E301,
+			0x0000FB7B0009E401, 0x0000FB7C0009E501, 0x0000FB7D0009E601, 0x0000FB7E0009E701,
+			0x0000FB7F0009E801, 0x0000FB800009E901, 0x0000FB810009EA01, 0x0000FB820009EB01,
+			0x0000FB830009EC01, 0x0000FB840009ED01, 0x0000FB850009EE01, 0x0000FB860009EF01,
+			0x0000FB870009F001, 0x0000FB880009F101, 0x0000FB890009F201, 0x0000FB8A0009F301,
+			0x0000FB8B0009F401, 0x0000FB8C0009F501, 0x0000FB8D0009F601, 0x0000FB8E0009F701,
+			0x0000FB8F0009F801, 0x0000FB900009F901, 0x0000FB910009FA01, 0x0000FB920009FB01,
+			0x0000FB930009FC01, 0x0000FB940009FD01, 0x0000FB950009FE01, 0x0000FB960009FF01,
+			0x0000FB97000A0001, 0x0000FB98000A0101, 0x0000FB99000A0201, 0x0000FB9A000A0301,
+			0x0000FB9B000A0401, 0x0000FB9C000A0501, 0x0000FB9D000A0601, 0x0000FB9E000A0701,
+			0x0000FB9F000A0801, 0x0000FBA0000A0901, 0x0000FBA1000A0A01, 0x0000FBA2000A0B01,
+			0x0000FBA3000A0C01, 0x0000FBA4000A0D02, 0x0000FBA5000A0F02, 0x0000FBA6000A1101,
+			0x0000FBA7000A1201, 0x0000FBA8000A1301, 0x0000FBA9000A1401, 0x0000FBAA000A1501,
+			0x0000FBAB000A1601, 0x0000FBAC000A1701, 0x0000FBAD000A1801, 0x0000FBAE000A1901,
+			0x0000FBAF000A1A01, 0x0000FBB0000A1B02, 0x0000FBB1000A1D02, 0x0000FBD3000A1F01,
+			0x0000FBD4000A2001, 0x0000FBD5000A2101, 0x0000FBD6000A2201, 0x0000FBD7000A2301,
+			0x0000FBD8000A2401, 0x0000FBD9000A2501, 0x0000FBDA000A2601, 0x0000FBDB000A2701,
+			0x0000FBDC000A2801, 0x0000FBDD000A2902, 0x0000FBDE000A2B01, 0x0000FBDF000A2C01,
+			0x0000FBE0000A2D01, 0x0000FBE1000A2E01, 0x0000FBE2000A2F01, 0x0000FBE3000A3001,
+			0x0000FBE4000A3101, 0x0000FBE5000A3201, 0x0000FBE6000A3301, 0x0000FBE7000A3401,
+			0x0000FBE8000A3501, 0x0000FBE9000A3601, 0x0000FBEA000A3703, 0x0000FBEB000A3A03,
+			0x0000FBEC000A3D03, 0x0000FBED000A4003, 0x0000FBEE000A4303, 0x0000FBEF000A4603,
+			0x0000FBF0000A4903, 0x0000FBF1000A4C03, 0x0000FBF2000A4F03, 0x0000FBF3000A5203,
+			0x0000FBF4000A5503, 0x0000FBF5000A5803, 0x0000FBF6000A5B03, 0x0000FBF7000A5E03,
+			0x0000FBF8000A6103, 0x0000FBF9000A6403, 0x0000FBFA000A6703, 0x0000FBFB000A6A03,
+			0x0000FBFC000A6D01, 0x0000FBFD000A6E01, 0x0000FBFE000A6F01, 0x0000FBFF000A7001,
+			0x0000FC00000A7103, 0x0000FC01000A7403, 0x0000FC02000A7703, 0x0000FC03000A7A03,
+			0x0000FC04000A7D03, 0x0000FC05000A8002, 0x0000FC06000A8202, 0x0000FC07000A8402,
+			0x0000FC08000A8602, 0x0000FC09000A8802, 0x0000FC0A000A8A02, 0x0000FC0B000A8C02,
+			0x0000FC0C000A8E02, 0x0000FC0D000A9002, 0x0000FC0E000A9202, 0x0000FC0F000A9402,
+			0x0000FC10000A9602, 0x0000FC11000A9802, 0x0000FC12000A9A02, 0x0000FC13000A9C02,
+			0x0000FC14000A9E02, 0x0000FC15000AA002, 0x0000FC16000AA202, 0x0000FC17000AA402,
+			0x0000FC18000AA602, 0x0000FC19000AA802, 0x0000FC1A000AAA02, 0x0000FC1B000AAC02,
+			0x0000FC1C000AAE02, 0x0000FC1D000AB002, 0x0000FC1E000AB202, 0x0000FC1F000AB402,
+			0x0000FC20000AB602, 0x0000FC21000AB802, 0x0000FC22000ABA02, 0x0000FC23000ABC02,
+			0x0000FC24000ABE02, 0x0000FC25000AC002, 0x0000FC26000AC202, 0x0000FC27000AC402,
+			0x0000FC28000AC602, 0x0000FC29000AC802, 0x0000FC2A000ACA02, 0x0000FC2B000ACC02,
+			0x0000FC2C000ACE02, 0x0000FC2D000AD002, 0x0000FC2E000AD202, 0x0000FC2F000AD402,
+			0x0000FC30000AD602, 0x0000FC31000AD802, 0x0000FC32000ADA02, 0x0000FC33000ADC02,
+			0x0000FC34000ADE02, 0x0000FC35000AE002, 0x0000FC36000AE202, 0x0000FC37000AE402,
+			0x0000FC38000AE602, 0x0000FC39000AE802, 0x0000FC3A000AEA02, 0x0000FC3B000AEC02,
+			0x0000FC3C000AEE02, 0x0000FC3D000AF002, 0x0000FC3E000AF202, 0x0000FC3F000AF402,
+			0x0000FC40000AF602, 0x0000FC41000AF802, 0x0000FC42000AFA02, 0x0000FC43000AFC02,
+			0x0000FC44000AFE02, 0x0000FC45000B0002, 0x0000FC46000B0202, 0x0000FC47000B0402,
+			0x0000FC48000B0602, 0x0000FC49000B0802, 0x0000FC4A000B0A02, 0x0000FC4B000B0C02,
+			0x0000FC4C000B0E02, 0x0000FC4D000B1002, 0x0000FC4E000B1202, 0x0000FC4F000B1402,
+			0x0000FC50000B1602, 0x0000FC51000B1802, 0x0000FC52000B1A02, 0x0000FC53000B1C02,
+			0x0000FC54000B1E02, 0x0000FC55000B2002, 0x0000FC56000B2202, 0x0000FC57000B2402,
+			0x0000FC58000B2602, 0x0000FC59000B2802, 0x0000FC5A000B2A02, 0x0000FC5B000B2C02,
+			0x0000FC5C000B2E02, 0x0000FC5D000B3002, 0x0000FC5E000B3203, 0x0000FC5F000B3503,
+			0x0000FC60000B3803, 0x0000FC61000B3B03, 0x0000FC62000B3E03, 0x0000FC63000B4103,
+			0x0000FC64000B4403, 0x0000FC65000B4703, 0x0000FC66000B4A03, 0x0000FC67000B4D03,
+			0x0000FC68000B5003, 0x0000FC69000B5303, 0x0000FC6A000B5602, 0x0000FC6B000B5802,
+			0x0000FC6C000B5A02, 0x0000FC6D000B5C02, 0x0000FC6E000B5E02, 0x0000FC6F000B6002,
+			0x0000FC70000B6202, 0x0000FC71000B6402, 0x0000FC72000B6602, 0x0000FC73000B6802,
+			0x0000FC74000B6A02, 0x0000FC75000B6C02, 0x0000FC76000B6E02, 0x0000FC77000B7002,
+			0x0000FC78000B7202, 0x0000FC79000B7402, 0x0000FC7A000B7602, 0x0000FC7B000B7802,
+			0x0000FC7C000B7A02, 0x0000FC7D000B7C02, 0x0000FC7E000B7E02, 0x0000FC7F000B8002,
+			0x0000FC80000B8202, 0x0000FC81000B8402, 0x0000FC82000B8602, 0x0000FC83000B8802,
+			0x0000FC84000B8A02, 0x0000FC85000B8C02, 0x0000FC86000B8E02, 0x0000FC87000B9002,
+			0x0000FC88000B9202, 0x0000FC89000B9402, 0x0000FC8A000B9602, 0x0000FC8B000B9802,
+			0x0000FC8C000B9A02, 0x0000FC8D000B9C02, 0x0000FC8E000B9E02, 0x0000FC8F000BA002,
+			0x0000FC90000BA202, 0x0000FC91000BA402, 0x0000FC92000BA602, 0x0000FC93000BA802,
+			0x0000FC94000BAA02, 0x0000FC95000BAC02, 0x0000FC96000BAE02, 0x0000FC97000BB003,
+			0x0000FC98000BB303, 0x0000FC99000BB603, 0x0000FC9A000BB903, 0x0000FC9B000BBC03,
+			0x0000FC9C000BBF02, 0x0000FC9D000BC102, 0x0000FC9E000BC302, 0x0000FC9F000BC502,
+			0x0000FCA0000BC702, 0x0000FCA1000BC902, 0x0000FCA2000BCB02, 0x0000FCA3000BCD02,
+			0x0000FCA4000BCF02, 0x0000FCA5000BD102, 0x0000FCA6000BD302, 0x0000FCA7000BD502,
+			0x0000FCA8000BD702, 0x0000FCA9000BD902, 0x0000FCAA000BDB02, 0x0000FCAB000BDD02,
+			0x0000FCAC000BDF02, 0x0000FCAD000BE102, 0x0000FCAE000BE302, 0x0000FCAF000BE502,
+			0x0000FCB0000BE702, 0x0000FCB1000BE902, 0x0000FCB2000BEB02, 0x0000FCB3000BED02,
+			0x0000FCB4000BEF02, 0x0000FCB5000BF102, 0x0000FCB6000BF302, 0x0000FCB7000BF502,
+			0x0000FCB8000BF702, 0x0000FCB9000BF902, 0x0000FCBA000BFB02, 0x0000FCBB000BFD02,
+			0x0000FCBC000BFF02, 0x0000FCBD000C0102, 0x0000FCBE000C0302, 0x0000FCBF000C0502,
+			0x0000FCC0000C0702, 0x0000FCC1000C0902, 0x0000FCC2000C0B02, 0x0000FCC3000C0D02,
+			0x0000FCC4000C0F02, 0x0000FCC5000C1102, 0x0000FCC6000C1302, 0x0000FCC7000C1502,
+			0x0000FCC8000C1702, 0x0000FCC9000C1902, 0x0000FCCA000C1B02, 0x0000FCCB000C1D02,
+			0x0000FCCC000C1F02, 0x0000FCCD000C2102, 0x0000FCCE000C2302, 0x0000FCCF000C2502,
+			0x0000FCD0000C2702, 0x0000FCD1000C2902, 0x0000FCD2000C2B02, 0x0000FCD3000C2D02,
+			0x0000FCD4000C2F02, 0x0000FCD5000C3102, 0x0000FCD6000C3302, 0x0000FCD7000C3502,
+			0x0000FCD8000C3702, 0x0000FCD9000C3902, 0x0000FCDA000C3B02, 0x0000FCDB000C3D02,
+			0x0000FCDC000C3F02, 0x0000FCDD000C4102, 0x0000FCDE000C4302, 0x0000FCDF000C4503,
+			0x0000FCE0000C4803, 0x0000FCE1000C4B02, 0x0000FCE2000C4D02, 0x0000FCE3000C4F02,
+			0x0000FCE4000C5102, 0x0000FCE5000C5302, 0x0000FCE6000C5502, 0x0000FCE7000C5702,
+			0x0000FCE8000C5902, 0x0000FCE9000C5B02, 0x0000FCEA000C5D02, 0x0000FCEB000C5F02,
+			0x0000FCEC000C6102, 0x0000FCED000C6302, 0x0000FCEE000C6502, 0x0000FCEF000C6702,
+			0x0000FCF0000C6902, 0x0000FCF1000C6B02, 0x0000FCF2000C6D03, 0x0000FCF3000C7003,
+			0x0000FCF4000C7303, 0x0000FCF5000C7602, 0x0000FCF6000C7802, 0x0000FCF7000C7A02,
+			0x0000FCF8000C7C02, 0x0000FCF9000C7E02, 0x0000FCFA000C8002, 0x0000FCFB000C8202,
+			0x0000FCFC000C8402, 0x0000FCFD000C8602, 0x0000FCFE000C8802, 0x0000FCFF000C8A02,
+			0x0000FD00000C8C02, 0x0000FD01000C8E02, 0x0000FD02000C9002, 0x0000FD03000C9202,
+			0x0000FD04000C9402, 0x0000FD05000C9602, 0x0000FD06000C9802, 0x0000FD07000C9A02,
+			0x0000FD08000C9C02, 0x0000FD09000C9E02, 0x0000FD0A000CA002, 0x0000FD0B000CA202,
+			0x0000FD0C000CA402, 0x0000FD0D000CA602, 0x0000FD0E000CA802, 0x0000FD0F000CAA02,
+			0x0000FD10000CAC02, 0x0000FD11000CAE02, 0x0000FD12000CB002, 0x0000FD13000CB202,
+			0x0000FD14000CB402, 0x0000FD15000CB602, 0x0000FD16000CB802, 0x0000FD17000CBA02,
+			0x0000FD18000CBC02, 0x0000FD19000CBE02, 0x0000FD1A000CC002, 0x0000FD1B000CC202,
+			0x0000FD1C000CC402, 0x0000FD1D000CC602, 0x0000FD1E000CC802, 0x0000FD1F000CCA02,
+			0x0000FD20000CCC02, 0x0000FD21000CCE02, 0x0000FD22000CD002, 0x0000FD23000CD202,
+			0x0000FD24000CD402, 0x0000FD25000CD602, 0x0000FD26000CD802, 0x0000FD27000CDA02,
+			0x0000FD28000CDC02, 0x0000FD29000CDE02, 0x0000FD2A000CE002, 0x0000FD2B000CE202,
+			0x0000FD2C000CE402, 0x0000FD2D000CE602, 0x0000FD2E000CE802, 0x0000FD2F000CEA02,
+			0x0000FD30000CEC02, 0x0000FD31000CEE02, 0x0000FD32000CF002, 0x0000FD33000CF202,
+			0x0000FD34000CF402, 0x0000FD35000CF602, 0x0000FD36000CF802, 0x0000FD37000CFA02,
+			0x0000FD38000CFC02, 0x0000FD39000CFE02, 0x0000FD3A000D0002, 0x0000FD3B000D0202,
+			0x0000FD3C000D0402, 0x0000FD3D000D0602, 0x0000FD50000D0803, 0x0000FD51000D0B03,
+			0x0000FD52000D0E03, 0x0000FD53000D1103, 0x0000FD54000D1403, 0x0000FD55000D1703,
+			0x0000FD56000D1A03, 0x0000FD57000D1D03, 0x0000FD58000D2003, 0x0000FD59000D2303,
+			0x0000FD5A000D2603, 0x0000FD5B000D2903, 0x0000FD5C000D2C03, 0x0000FD5D000D2F03,
+			0x0000FD5E000D3203, 0x0000FD5F000D3503, 0x0000FD60000D3803, 0x0000FD61000D3B03,
+			0x0000FD62000D3E03, 0x0000FD63000D4103, 0x0000FD64000D4403, 0x0000FD65000D4703,
+			0x0000FD66000D4A03, 0x0000FD67000D4D03, 0x0000FD68000D5003, 0x0000FD69000D5303,
+			0x0000FD6A000D5603, 0x0000FD6B000D5903, 0x0000FD6C000D5C03, 0x0000FD6D000D5F03,
+			0x0000FD6E000D6203, 0x0000FD6F000D6503, 0x0000FD70000D6803, 0x0000FD71000D6B03,
+			0x0000FD72000D6E03, 0x0000FD73000D7103, 0x0000FD74000D7403, 0x0000FD75000D7703,
+			0x0000FD76000D7A03, 0x0000FD77000D7D03, 0x0000FD78000D8003, 0x0000FD79000D8303,
+			0x0000FD7A000D8603, 0x0000FD7B000D8903, 0x0000FD7C000D8C03, 0x0000FD7D000D8F03,
+			0x0000FD7E000D9203, 0x0000FD7F000D9503, 0x0000FD80000D9803, 0x0000FD81000D9B03,
+			0x0000FD82000D9E03, 0x0000FD83000DA103, 0x0000FD84000DA403, 0x0000FD85000DA703,
+			0x0000FD86000DAA03, 0x0000FD87000DAD03, 0x0000FD88000DB003, 0x0000FD89000DB303,
+			0x0000FD8A000DB603, 0x0000FD8B000DB903, 0x0000FD8C000DBC03, 0x0000FD8D000DBF03,
+			0x0000FD8E000DC203, 0x0000FD8F000DC503, 0x0000FD92000DC803, 0x0000FD93000DCB03,
+			0x0000FD94000DCE03, 0x0000FD95000DD103, 0x0000FD96000DD403, 0x0000FD97000DD703,
+			0x0000FD98000DDA03, 0x0000FD99000DDD03, 0x0000FD9A000DE003, 0x0000FD9B000DE303,
+			0x0000FD9C000DE603, 0x0000FD9D000DE903, 0x0000FD9E000DEC03, 0x0000FD9F000DEF03,
+			0x0000FDA0000DF203, 0x0000FDA1000DF503, 0x0000FDA2000DF803, 0x0000FDA3000DFB03,
+			0x0000FDA4000DFE03, 0x0000FDA5000E0103, 0x0000FDA6000E0403, 0x0000FDA7000E0703,
+			0x0000FDA8000E0A03, 0x0000FDA9000E0D03, 0x0000FDAA000E1003, 0x0000FDAB000E1303,
+			0x0000FDAC000E1603, 0x0000FDAD000E1903, 0x0000FDAE000E1C03, 0x0000FDAF000E1F03,
+			0x0000FDB0000E2203, 0x0000FDB1000E2503, 0x0000FDB2000E2803, 0x0000FDB3000E2B03,
+			0x0000FDB4000E2E03, 0x0000FDB5000E3103, 0x0000FDB6000E3403, 0x0000FDB7000E3703,
+			0x0000FDB8000E3A03, 0x0000FDB9000E3D03, 0x0000FDBA000E4003, 0x0000FDBB000E4303,
+			0x0000FDBC000E4603, 0x0000FDBD000E4903, 0x0000FDBE000E4C03, 0x0000FDBF000E4F03,
+			0x0000FDC0000E5203, 0x0000FDC1000E5503, 0x0000FDC2000E5803, 0x0000FDC3000E5B03,
+			0x0000FDC4000E5E03, 0x0000FDC5000E6103, 0x0000FDC6000E6403, 0x0000FDC7000E6703,
+			0x0000FDF0000E6A03, 0x0000FDF1000E6D03, 0x0000FDF2000E7004, 0x0000FDF3000E7404,
+			0x0000FDF4000E7804, 0x0000FDF5000E7C04, 0x0000FDF6000E8004, 0x0000FDF7000E8404,
+			0x0000FDF8000E8804, 0x0000FDF9000E8C03, 0x0000FDFA000E8F12, 0x0000FDFB000EA108,
+			0x0000FDFC000EA904, 0x0000FE10000EAD01, 0x0000FE11000EAE01, 0x0000FE12000EAF01,
+			0x0000FE13000EB001, 0x0000FE14000EB101, 0x0000FE15000EB201, 0x0000FE16000EB301,
+			0x0000FE17000EB401, 0x0000FE18000EB501, 0x0000FE19000EB603, 0x0000FE30000EB902,
+			0x0000FE31000EBB01, 0x0000FE32000EBC01, 0x0000FE33000EBD01, 0x0000FE34000EBE01,
+			0x0000FE35000EBF01, 0x0000FE36000EC001, 0x0000FE37000EC101, 0x0000FE38000EC201,
+			0x0000FE39000EC301, 0x0000FE3A000EC401, 0x0000FE3B000EC501, 0x0000FE3C000EC601,
+			0x0000FE3D000EC701, 0x0000FE3E000EC801, 0x0000FE3F000EC901, 0x0000FE40000ECA01,
+			0x0000FE41000ECB01, 0x0000FE42000ECC01, 0x0000FE43000ECD01, 0x0000FE44000ECE01,
+			0x0000FE47000ECF01, 0x0000FE48000ED001, 0x0000FE49000ED102, 0x0000FE4A000ED302,
+			0x0000FE4B000ED502, 0x0000FE4C000ED702, 0x0000FE4D000ED901, 0x0000FE4E000EDA01,
+			0x0000FE4F000EDB01, 0x0000FE50000EDC01, 0x0000FE51000EDD01, 0x0000FE52000EDE01,
+			0x0000FE54000EDF01, 0x0000FE55000EE001, 0x0000FE56000EE101, 0x0000FE57000EE201,
+			0x0000FE58000EE301, 0x0000FE59000EE401, 0x0000FE5A000EE501, 0x0000FE5B000EE601,
+			0x0000FE5C000EE701, 0x0000FE5D000EE801, 0x0000FE5E000EE901, 0x0000FE5F000EEA01,
+			0x0000FE60000EEB01, 0x0000FE61000EEC01, 0x0000FE62000EED01, 0x0000FE63000EEE01,
+			0x0000FE64000EEF01, 0x0000FE65000EF001, 0x0000FE66000EF101, 0x0000FE68000EF201,
+			0x0000FE69000EF301, 0x0000FE6A000EF401, 0x0000FE6B000EF501, 0x0000FE70000EF602,
+			0x0000FE71000EF802, 0x0000FE72000EFA02, 0x0000FE74000EFC02, 0x0000FE76000EFE02,
+			0x0000FE77000F0002, 0x0000FE78000F0202, 0x0000FE79000F0402, 0x0000FE7A000F0602,
+			0x0000FE7B000F0802, 0x0000FE7C000F0A02, 0x0000FE7D000F0C02, 0x0000FE7E000F0E02,
+			0x0000FE7F000F1002, 0x0000FE80000F1201, 0x0000FE81000F1302, 0x0000FE82000F1502,
+			0x0000FE83000F1702, 0x0000FE84000F1902, 0x0000FE85000F1B02, 0x0000FE86000F1D02,
+			0x0000FE87000F1F02, 0x0000FE88000F2102, 0x0000FE89000F2302, 0x0000FE8A000F2502,
+			0x0000FE8B000F2702, 0x0000FE8C000F2902, 0x0000FE8D000F2B01, 0x0000FE8E000F2C01,
+			0x0000FE8F000F2D01, 0x0000FE90000F2E01, 0x0000FE91000F2F01, 0x0000FE92000F3001,
+			0x0000FE93000F3101, 0x0000FE94000F3201, 0x0000FE95000F3301, 0x0000FE96000F3401,
+			0x0000FE97000F3501, 0x0000FE98000F3601, 0x0000FE99000F3701, 0x0000FE9A000F3801,
+			0x0000FE9B000F3901, 0x0000FE9C000F3A01, 0x0000FE9D000F3B01, 0x0000FE9E000F3C01,
+			0x0000FE9F000F3D01, 0x0000FEA0000F3E01, 0x0000FEA1000F3F01, 0x0000FEA2000F4001,
+			0x0000FEA3000F4101, 0x0000FEA4000F4201, 0x0000FEA5000F4301, 0x0000FEA6000F4401,
+			0x0000FEA7000F4501, 0x0000FEA8000F4601, 0x0000FEA9000F4701, 0x0000FEAA000F4801,
+			0x0000FEAB000F4901, 0x0000FEAC000F4A01, 0x0000FEAD000F4B01, 0x0000FEAE000F4C01,
+			0x0000FEAF000F4D01, 0x0000FEB0000F4E01, 0x0000FEB1000F4F01, 0x0000FEB2000F5001,
+			0x0000FEB3000F5101, 0x0000FEB4000F5201, 0x0000FEB5000F5301, 0x0000FEB6000F5401,
+			0x0000FEB7000F5501, 0x0000FEB8000F5601, 0x0000FEB9000F5701, 0x0000FEBA000F5801,
+			0x0000FEBB000F5901, 0x0000FEBC000F5A01, 0x0000FEBD000F5B01, 0x0000FEBE000F5C01,
+			0x0000FEBF000F5D01, 0x0000FEC0000F5E01, 0x0000FEC1000F5F01, 0x0000FEC2000F6001,
+			0x0000FEC3000F6101, 0x0000FEC4000F6201, 0x0000FEC5000F6301, 0x0000FEC6000F6401,
+			0x0000FEC7000F6501, 0x0000FEC8000F6601, 0x0000FEC9000F6701, 0x0000FECA000F6801,
+			0x0000FECB000F6901, 0x0000FECC000F6A01, 0x0000FECD000F6B01, 0x0000FECE000F6C01,
+			0x0000FECF000F6D01, 0x0000FED0000F6E01, 0x0000FED1000F6F01, 0x0000FED2000F7001,
+			0x0000FED3000F7101, 0x0000FED4000F7201, 0x0000FED5000F7301, 0x0000FED6000F7401,
+			0x0000FED7000F7501, 0x0000FED8000F7601, 0x0000FED9000F7701, 0x0000FEDA000F7801,
+			0x0000FEDB000F7901, 0x0000FEDC000F7A01, 0x0000FEDD000F7B01, 0x0000FEDE000F7C01,
+			0x0000FEDF000F7D01, 0x0000FEE0000F7E01, 0x0000FEE1000F7F01, 0x0000FEE2000F8001,
+			0x0000FEE3000F8101, 0x0000FEE4000F8201, 0x0000FEE5000F8301, 0x0000FEE6000F8401,
+			0x0000FEE7000F8501, 0x0000FEE8000F8601, 0x0000FEE9000F8701, 0x0000FEEA000F8801,
+			0x0000FEEB000F8901, 0x0000FEEC000F8A01, 0x0000FEED000F8B01, 0x0000FEEE000F8C01,
+			0x0000FEEF000F8D01, 0x0000FEF0000F8E01, 0x0000FEF1000F8F01, 0x0000FEF2000F9001,
+			0x0000FEF3000F9101, 0x0000FEF4000F9201, 0x0000FEF5000F9303, 0x0000FEF6000F9603,
+			0x0000FEF7000F9903, 0x0000FEF8000F9C03, 0x0000FEF9000F9F03, 0x0000FEFA000FA203,
+			0x0000FEFB000FA502, 0x0000FEFC000FA702, 0x0000FF01000FA901, 0x0000FF02000FAA01,
+			0x0000FF03000FAB01, 0x0000FF04000FAC01, 0x0000FF05000FAD01, 0x0000FF06000FAE01,
+			0x0000FF07000FAF01, 0x0000FF08000FB001, 0x0000FF09000FB101, 0x0000FF0A000FB201,
+			0x0000FF0B000FB301, 0x0000FF0C000FB401, 0x0000FF0D000FB501, 0x0000FF0E000FB601,
+			0x0000FF0F000FB701, 0x0000FF10000FB801, 0x0000FF11000FB901, 0x0000FF12000FBA01,
+			0x0000FF13000FBB01, 0x0000FF14000FBC01, 0x0000FF15000FBD01, 0x0000FF16000FBE01,
+			0x0000FF17000FBF01, 0x0000FF18000FC001, 0x0000FF19000FC101, 0x0000FF1A000FC201,
+			0x0000FF1B000FC301, 0x0000FF1C000FC401, 0x0000FF1D000FC501, 0x0000FF1E000FC601,
+			0x0000FF1F000FC701, 0x0000FF20000FC801, 0x0000FF21000FC901, 0x0000FF22000FCA01,
+			0x0000FF23000FCB01, 0x0000FF24000FCC01, 0x0000FF25000FCD01, 0x0000FF26000FCE01,
+			0x0000FF27000FCF01, 0x0000FF28000FD001, 0x0000FF29000FD101, 0x0000FF2A000FD201,
+			0x0000FF2B000FD301, 0x0000FF2C000FD401, 0x0000FF2D000FD501, 0x0000FF2E000FD601,
+			0x0000FF2F000FD701, 0x0000FF30000FD801, 0x0000FF31000FD901, 0x0000FF32000FDA01,
+			0x0000FF33000FDB01, 0x0000FF34000FDC01, 0x0000FF35000FDD01, 0x0000FF36000FDE01,
+			0x0000FF37000FDF01, 0x0000FF38000FE001, 0x0000FF39000FE101, 0x0000FF3A000FE201,
+			0x0000FF3B000FE301, 0x0000FF3C000FE401, 0x0000FF3D000FE501, 0x0000FF3E000FE601,
+			0x0000FF3F000FE701, 0x0000FF40000FE801, 0x0000FF41000FE901, 0x0000FF42000FEA01,
+			0x0000FF43000FEB01, 0x0000FF44000FEC01, 0x0000FF45000FED01, 0x0000FF46000FEE01,
+			0x0000FF47000FEF01, 0x0000FF48000FF001, 0x0000FF49000FF101, 0x0000FF4A000FF201,
+			0x0000FF4B000FF301, 0x0000FF4C000FF401, 0x0000FF4D000FF501, 0x0000FF4E000FF601,
+			0x0000FF4F000FF701, 0x0000FF50000FF801, 0x0000FF51000FF901, 0x0000FF52000FFA01,
+			0x0000FF53000FFB01, 0x0000FF54000FFC01, 0x0000FF55000FFD01, 0x0000FF56000FFE01,
+			0x0000FF57000FFF01, 0x0000FF5800100001, 0x0000FF5900100101, 0x0000FF5A00100201,
+			0x0000FF5B00100301, 0x0000FF5C00100401, 0x0000FF5D00100501, 0x0000FF5E00100601,
+			0x0000FF5F00100701, 0x0000FF6000100801, 0x0000FF6100100901, 0x0000FF6200100A01,
+			0x0000FF6300100B01, 0x0000FF6400100C01, 0x0000FF6500100D01, 0x0000FF6600100E01,
+			0x0000FF6700100F01, 0x0000FF6800101001, 0x0000FF6900101101, 0x0000FF6A00101201,
+			0x0000FF6B00101301, 0x0000FF6C00101401, 0x0000FF6D00101501, 0x0000FF6E00101601,
+			0x0000FF6F00101701, 0x0000FF7000101801, 0x0000FF7100101901, 0x0000FF7200101A01,
+			0x0000FF7300101B01, 0x0000FF7400101C01, 0x0000FF7500101D01, 0x0000FF7600101E01,
+			0x0000FF7700101F01, 0x0000FF7800102001, 0x0000FF7900102101, 0x0000FF7A00102201,
+			0x0000FF7B00102301, 0x0000FF7C00102401, 0x0000FF7D00102501, 0x0000FF7E00102601,
+			0x0000FF7F00102701, 0x0000FF8000102801, 0x0000FF8100102901, 0x0000FF8200102A01,
+			0x0000FF8300102B01, 0x0000FF8400102C01, 0x0000FF8500102D01, 0x0000FF8600102E01,
+			0x0000FF8700102F01, 0x0000FF8800103001, 0x0000FF8900103101, 0x0000FF8A00103201,
+			0x0000FF8B00103301, 0x0000FF8C00103401, 0x0000FF8D00103501, 0x0000FF8E00103601,
+			0x0000FF8F00103701, 0x0000FF9000103801, 0x0000FF9100103901, 0x0000FF9200103A01,
+			0x0000FF9300103B01, 0x0000FF9400103C01, 0x0000FF9500103D01, 0x0000FF9600103E01,
+			0x0000FF9700103F01, 0x0000FF9800104001, 0x0000FF9900104101, 0x0000FF9A00104201,
+			0x0000FF9B00104301, 0x0000FF9C00104401, 0x0000FF9D00104501, 0x0000FF9E00104601,
+			0x0000FF9F00104701, 0x0000FFA000104801, 0x0000FFA100104901, 0x0000FFA200104A01,
+			0x0000FFA300104B01, 0x0000FFA400104C01, 0x0000FFA500104D01, 0x0000FFA600104E01,
+			0x0000FFA700104F01, 0x0000FFA800105001, 0x0000FFA900105101, 0x0000FFAA00105201,
+			0x0000FFAB00105301, 0x0000FFAC00105401, 0x0000FFAD00105501, 0x0000FFAE00105601,
+			0x0000FFAF00105701, 0x0000FFB000105801, 0x0000FFB100105901, 0x0000FFB200105A01,
+			0x0000FFB300105B01, 0x0000FFB400105C01, 0x0000FFB500105D01, 0x0000FFB600105E01,
+			0x0000FFB700105F01, 0x0000FFB800106001, 0x0000FFB900106101, 0x0000FFBA00106201,
+			0x0000FFBB00106301, 0x0000FFBC00106401, 0x0000FFBD00106501, 0x0000FFBE00106601,
+			0x0000FFC200106701, 0x0000FFC300106801, 0x0000FFC400106901, 0x0000FFC500106A01,
+			0x0000FFC600106B01, 0x0000FFC700106C01, 0x0000FFCA00106D01, 0x0000FFCB00106E01,
+			0x0000FFCC00106F01, 0x0000FFCD00107001, 0x0000FFCE00107101, 0x0000FFCF00107201,
+			0x0000FFD200107301, 0x0000FFD300107401, 0x0000FFD400107501, 0x0000FFD500107601,
+			0x0000FFD600107701, 0x0000FFD700107801, 0x0000FFDA00107901, 0x0000FFDB00107A01,
+			0x0000FFDC00107B01, 0x0000FFE000107C01, 0x0000FFE100107D01, 0x0000FFE200107E01,
+			0x0000FFE300107F02, 0x0000FFE400108101, 0x0000FFE500108201, 0x0000FFE600108301,
+			0x0000FFE800108401, 0x0000FFE900108501, 0x0000FFEA00108601, 0x0000FFEB00108701,
+			0x0000FFEC00108801, 0x0000FFED00108901, 0x0000FFEE00108A01, 0x0001078100108B01,
+			0x0001078200108C01, 0x0001078300108D01, 0x0001078400108E01, 0x0001078500108F01,
+			0x0001078700109001, 0x0001078800109101, 0x0001078900109201, 0x0001078A00109301,
+			0x0001078B00109401, 0x0001078C00109501, 0x0001078D00109601, 0x0001078E00109701,
+			0x0001078F00109801, 0x0001079000109901, 0x0001079100109A01, 0x0001079200109B01,
+			0x0001079300109C01, 0x0001079400109D01, 0x0001079500109E01, 0x0001079600109F01,
+			0x000107970010A001, 0x000107980010A101, 0x000107990010A201, 0x0001079A0010A301,
+			0x0001079B0010A401, 0x0001079C0010A501, 0x0001079D0010A601, 0x0001079E0010A701,
+			0x0001079F0010A801, 0x000107A00010A901, 0x000107A10010AA01, 0x000107A20010AB01,
+			0x000107A30010AC01, 0x000107A40010AD01, 0x000107A50010AE01, 0x000107A60010AF01,
+			0x000107A70010B001, 0x000107A80010B101, 0x000107A90010B201, 0x000107AA0010B301,
+			0x000107AB0010B401, 0x000107AC0010B501, 0x000107AD0010B601, 0x000107AE0010B701,
+			0x000107AF0010B801, 0x000107B00010B901, 0x000107B20010BA01, 0x000107B30010BB01,
+			0x000107B40010BC01, 0x000107B50010BD01, 0x000107B60010BE01, 0x000107B70010BF01,
+			0x000107B80010C001, 0x000107B90010C101, 0x000107BA0010C201, 0x0001D4000010C301,
+			0x0001D4010010C401, 0x0001D4020010C501, 0x0001D4030010C601, 0x0001D4040010C701,
+			0x0001D4050010C801, 0x0001D4060010C901, 0x0001D4070010CA01, 0x0001D4080010CB01,
+			0x0001D4090010CC01, 0x0001D40A0010CD01, 0x0001D40B0010CE01, 0x0001D40C0010CF01,
+			0x0001D40D0010D001, 0x0001D40E0010D101, 0x0001D40F0010D201, 0x0001D4100010D301,
+			0x0001D4110010D401, 0x0001D4120010D501, 0x0001D4130010D601, 0x0001D4140010D701,
+			0x0001D4150010D801, 0x0001D4160010D901, 0x0001D4170010DA01, 0x0001D4180010DB01,
+			0x0001D4190010DC01, 0x0001D41A0010DD01, 0x0001D41B0010DE01, 0x0001D41C0010DF01,
+			0x0001D41D0010E001, 0x0001D41E0010E101, 0x0001D41F0010E201, 0x0001D4200010E301,
+			0x0001D4210010E401, 0x0001D4220010E501, 0x0001D4230010E601, 0x0001D4240010E701,
+			0x0001D4250010E801, 0x0001D4260010E901, 0x0001D4270010EA01, 0x0001D4280010EB01,
+			0x0001D4290010EC01, 0x0001D42A0010ED01, 0x0001D42B0010EE01, 0x0001D42C0010EF01,
+			0x0001D42D0010F001, 0x0001D42E0010F101, 0x0001D42F0010F201, 0x0001D4300010F301,
+			0x0001D4310010F401, 0x0001D4320010F501, 0x0001D4330010F601, 0x0001D4340010F701,
+			0x0001D4350010F801, 0x0001D4360010F901, 0x0001D4370010FA01, 0x0001D4380010FB01,
+			0x0001D4390010FC01, 0x0001D43A0010FD01, 0x0001D43B0010FE01, 0x0001D43C0010FF01,
+			0x0001D43D00110001, 0x0001D43E00110101, 0x0001D43F00110201, 0x0001D44000110301,
+			0x0001D44100110401, 0x0001D44200110501, 0x0001D44300110601, 0x0001D44400110701,
+			0x0001D44500110801, 0x0001D44600110901, 0x0001D44700110A01, 0x0001D44800110B01,
+			0x0001D44900110C01, 0x0001D44A00110D01, 0x0001D44B00110E01, 0x0001D44C00110F01,
+			0x0001D44D00111001, 0x0001D44E00111101, 0x0001D44F00111201, 0x0001D45000111301,
+			0x0001D45100111401, 0x0001D45200111501, 0x0001D45300111601, 0x0001D45400111701,
+			0x0001D45600111801, 0x0001D45700111901, 0x0001D45800111A01, 0x0001D45900111B01,
+			0x0001D45A00111C01, 0x0001D45B00111D01, 0x0001D45C00111E01, 0x0001D45D00111F01,
+			0x0001D45E00112001, 0x0001D45F00112101, 0x0001D46000112201, 0x0001D46100112301,
+			0x0001D46200112401, 0x0001D46300112501, 0x0001D46400112601, 0x0001D46500112701,
+			0x0001D46600112801, 0x0001D46700112901, 0x0001D46800112A01, 0x0001D46900112B01,
+			0x0001D46A00112C01, 0x0001D46B00112D01, 0x0001D46C00112E01, 0x0001D46D00112F01,
+			0x0001D46E00113001, 0x0001D46F00113101, 0x0001D47000113201, 0x0001D47100113301,
+			0x0001D47200113401, 0x0001D47300113501, 0x0001D47400113601, 0x0001D47500113701,
+			0x0001D47600113801, 0x0001D47700113901, 0x0001D47800113A01, 0x0001D47900113B01,
+			0x0001D47A00113C01, 0x0001D47B00113D01, 0x0001D47C00113E01, 0x0001D47D00113F01,
+			0x0001D47E00114001, 0x0001D47F00114101, 0x0001D48000114201, 0x0001D48100114301,
+			0x0001D48200114401, 0x0001D48300114501, 0x0001D48400114601, 0x0001D48500114701,
+			0x0001D48600114801, 0x0001D48700114901, 0x0001D48800114A01, 0x0001D48900114B01,
+			0x0001D48A00114C01, 0x0001D48B00114D01, 0x0001D48C00114E01, 0x0001D48D00114F01,
+			0x0001D48E00115001, 0x0001D48F00115101, 0x0001D49000115201, 0x0001D49100115301,
+			0x0001D49200115401, 0x0001D49300115501, 0x0001D49400115601, 0x0001D49500115701,
+			0x0001D49600115801, 0x0001D49700115901, 0x0001D49800115A01, 0x0001D49900115B01,
+			0x0001D49A00115C01, 0x0001D49B00115D01, 0x0001D49C00115E01, 0x0001D49E00115F01,
+			0x0001D49F00116001, 0x0001D4A200116101, 0x0001D4A500116201, 0x0001D4A600116301,
+			0x0001D4A900116401, 0x0001D4AA00116501, 0x0001D4AB00116601, 0x0001D4AC00116701,
+			0x0001D4AE00116801, 0x0001D4AF00116901, 0x0001D4B000116A01, 0x0001D4B100116B01,
+			0x0001D4B200116C01, 0x0001D4B300116D01, 0x0001D4B400116E01, 0x0001D4B500116F01,
+			0x0001D4B600117001, 0x0001D4B700117101, 0x0001D4B800117201, 0x0001D4B900117301,
+			0x0001D4BB00117401, 0x0001D4BD00117501, 0x0001D4BE00117601, 0x0001D4BF00117701,
+			0x0001D4C000117801, 0x0001D4C100117901, 0x0001D4C200117A01, 0x0001D4C300117B01,
+			0x0001D4C500117C01, 0x0001D4C600117D01, 0x0001D4C700117E01, 0x0001D4C800117F01,
+			0x0001D4C900118001, 0x0001D4CA00118101, 0x0001D4CB00118201, 0x0001D4CC00118301,
+			0x0001D4CD00118401, 0x0001D4CE00118501, 0x0001D4CF00118601, 0x0001D4D000118701,
+			0x0001D4D100118801, 0x0001D4D200118901, 0x0001D4D300118A01, 0x0001D4D400118B01,
+			0x0001D4D500118C01, 0x0001D4D600118D01, 0x0001D4D700118E01, 0x0001D4D800118F01,
+			0x0001D4D900119001, 0x0001D4DA00119101, 0x0001D4DB00119201, 0x0001D4DC00119301,
+			0x0001D4DD00119401, 0x0001D4DE00119501, 0x0001D4DF00119601, 0x0001D4E000119701,
+			0x0001D4E100119801, 0x0001D4E200119901, 0x0001D4E300119A01, 0x0001D4E400119B01,
+			0x0001D4E500119C01, 0x0001D4E600119D01, 0x0001D4E700119E01, 0x0001D4E800119F01,
+			0x0001D4E90011A001, 0x0001D4EA0011A101, 0x0001D4EB0011A201, 0x0001D4EC0011A301,
+			0x0001D4ED0011A401, 0x0001D4EE0011A501, 0x0001D4EF0011A601, 0x0001D4F00011A701,
+			0x0001D4F10011A801, 0x0001D4F20011A901, 0x0001D4F30011AA01, 0x0001D4F40011AB01,
+			0x0001D4F50011AC01, 0x0001D4F60011AD01, 0x0001D4F70011AE01, 0x0001D4F80011AF01,
+			0x0001D4F90011B001, 0x0001D4FA0011B101, 0x0001D4FB0011B201, 0x0001D4FC0011B301,
+			0x0001D4FD0011B401, 0x0001D4FE0011B501, 0x0001D4FF0011B601, 0x0001D5000011B701,
+			0x0001D5010011B801, 0x0001D5020011B901, 0x0001D5030011BA01, 0x0001D5040011BB01,
+			0x0001D5050011BC01, 0x0001D5070011BD01, 0x0001D5080011BE01, 0x0001D5090011BF01,
+			0x0001D50A0011C001, 0x0001D50D0011C101, 0x0001D50E0011C201, 0x0001D50F0011C301,
+			0x0001D5100011C401, 0x0001D5110011C501, 0x0001D5120011C601, 0x0001D5130011C701,
+			0x0001D5140011C801, 0x0001D5160011C901, 0x0001D5170011CA01, 0x0001D5180011CB01,
+			0x0001D5190011CC01, 0x0001D51A0011CD01, 0x0001D51B0011CE01, 0x0001D51C0011CF01,
+			0x0001D51E0011D001, 0x0001D51F0011D101, 0x0001D5200011D201, 0x0001D5210011D301,
+			0x0001D5220011D401, 0x0001D5230011D501, 0x0001D5240011D601, 0x0001D5250011D701,
+			0x0001D5260011D801, 0x0001D5270011D901, 0x0001D5280011DA01, 0x0001D5290011DB01,
+			0x0001D52A0011DC01, 0x0001D52B0011DD01, 0x0001D52C0011DE01, 0x0001D52D0011DF01,
+			0x0001D52E0011E001, 0x0001D52F0011E101, 0x0001D5300011E201, 0x0001D5310011E301,
+			0x0001D5320011E401, 0x0001D5330011E501, 0x0001D5340011E601, 0x0001D5350011E701,
+			0x0001D5360011E801, 0x0001D5370011E901, 0x0001D5380011EA01, 0x0001D5390011EB01,
+			0x0001D53B0011EC01, 0x0001D53C0011ED01, 0x0001D53D0011EE01, 0x0001D53E0011EF01,
+			0x0001D5400011F001, 0x0001D5410011F101, 0x0001D5420011F201, 0x0001D5430011F301,
+			0x0001D5440011F401, 0x0001D5460011F501, 0x0001D54A0011F601, 0x0001D54B0011F701,
+			0x0001D54C0011F801, 0x0001D54D0011F901, 0x0001D54E0011FA01, 0x0001D54F0011FB01,
+			0x0001D5500011FC01, 0x0001D5520011FD01, 0x0001D5530011FE01, 0x0001D5540011FF01,
+			0x0001D55500120001, 0x0001D55600120101, 0x0001D55700120201, 0x0001D55800120301,
+			0x0001D55900120401, 0x0001D55A00120501, 0x0001D55B00120601, 0x0001D55C00120701,
+			0x0001D55D00120801, 0x0001D55E00120901, 0x0001D55F00120A01, 0x0001D56000120B01,
+			0x0001D56100120C01, 0x0001D56200120D01, 0x0001D56300120E01, 0x0001D56400120F01,
+			0x0001D56500121001, 0x0001D56600121101, 0x0001D56700121201, 0x0001D56800121301,
+			0x0001D56900121401, 0x0001D56A00121501, 0x0001D56B00121601, 0x0001D56C00121701,
+			0x0001D56D00121801, 0x0001D56E00121901, 0x0001D56F00121A01, 0x0001D57000121B01,
+			0x0001D57100121C01, 0x0001D57200121D01, 0x0001D57300121E01, 0x0001D57400121F01,
+			0x0001D57500122001, 0x0001D57600122101, 0x0001D57700122201, 0x0001D57800122301,
+			0x0001D57900122401, 0x0001D57A00122501, 0x0001D57B00122601, 0x0001D57C00122701,
+			0x0001D57D00122801, 0x0001D57E00122901, 0x0001D57F00122A01, 0x0001D58000122B01,
+			0x0001D58100122C01, 0x0001D58200122D01, 0x0001D58300122E01, 0x0001D58400122F01,
+			0x0001D58500123001, 0x0001D58600123101, 0x0001D58700123201, 0x0001D58800123301,
+			0x0001D58900123401, 0x0001D58A00123501, 0x0001D58B00123601, 0x0001D58C00123701,
+			0x0001D58D00123801, 0x0001D58E00123901, 0x0001D58F00123A01, 0x0001D59000123B01,
+			0x0001D59100123C01, 0x0001D59200123D01, 0x0001D59300123E01, 0x0001D59400123F01,
+			0x0001D59500124001, 0x0001D59600124101, 0x0001D59700124201, 0x0001D59800124301,
+			0x0001D59900124401, 0x0001D59A00124501, 0x0001D59B00124601, 0x0001D59C00124701,
+			0x0001D59D00124801, 0x0001D59E00124901, 0x0001D59F00124A01, 0x0001D5A000124B01,
+			0x0001D5A100124C01, 0x0001D5A200124D01, 0x0001D5A300124E01, 0x0001D5A400124F01,
+			0x0001D5A500125001, 0x0001D5A600125101, 0x0001D5A700125201, 0x0001D5A800125301,
+			0x0001D5A900125401, 0x0001D5AA00125501, 0x0001D5AB00125601, 0x0001D5AC00125701,
+			0x0001D5AD00125801, 0x0001D5AE00125901, 0x0001D5AF00125A01, 0x0001D5B000125B01,
+			0x0001D5B100125C01, 0x0001D5B200125D01, 0x0001D5B300125E01, 0x0001D5B400125F01,
+			0x0001D5B500126001, 0x0001D5B600126101, 0x0001D5B700126201, 0x0001D5B800126301,
+			0x0001D5B900126401, 0x0001D5BA00126501, 0x0001D5BB00126601, 0x0001D5BC00126701,
+			0x0001D5BD00126801, 0x0001D5BE00126901, 0x0001D5BF00126A01, 0x0001D5C000126B01,
+			0x0001D5C100126C01, 0x0001D5C200126D01, 0x0001D5C300126E01, 0x0001D5C400126F01,
+			0x0001D5C500127001, 0x0001D5C600127101, 0x0001D5C700127201, 0x0001D5C800127301,
+			0x0001D5C900127401, 0x0001D5CA00127501, 0x0001D5CB00127601, 0x0001D5CC00127701,
+			0x0001D5CD00127801, 0x0001D5CE00127901, 0x0001D5CF00127A01, 0x0001D5D000127B01,
+			0x0001D5D100127C01, 0x0001D5D200127D01, 0x0001D5D300127E01, 0x0001D5D400127F01,
+			0x0001D5D500128001, 0x0001D5D600128101, 0x0001D5D700128201, 0x0001D5D800128301,
+			0x0001D5D900128401, 0x0001D5DA00128501, 0x0001D5DB00128601, 0x0001D5DC00128701,
+			0x0001D5DD00128801, 0x0001D5DE00128901, 0x0001D5DF00128A01, 0x0001D5E000128B01,
+			0x0001D5E100128C01, 0x0001D5E200128D01, 0x0001D5E300128E01, 0x0001D5E400128F01,
+			0x0001D5E500129001, 0x0001D5E600129101, 0x0001D5E700129201, 0x0001D5E800129301,
+			0x0001D5E900129401, 0x0001D5EA00129501, 0x0001D5EB00129601, 0x0001D5EC00129701,
+			0x0001D5ED00129801, 0x0001D5EE00129901, 0x0001D5EF00129A01, 0x0001D5F000129B01,
+			0x0001D5F100129C01, 0x0001D5F200129D01, 0x0001D5F300129E01, 0x0001D5F400129F01,
+			0x0001D5F50012A001, 0x0001D5F60012A101, 0x0001D5F70012A201, 0x0001D5F80012A301,
+			0x0001D5F90012A401, 0x0001D5FA0012A501, 0x0001D5FB0012A601, 0x0001D5FC0012A701,
+			0x0001D5FD0012A801, 0x0001D5FE0012A901, 0x0001D5FF0012AA01, 0x0001D6000012AB01,
+			0x0001D6010012AC01, 0x0001D6020012AD01, 0x0001D6030012AE01, 0x0001D6040012AF01,
+			0x0001D6050012B001, 0x0001D6060012B101, 0x0001D6070012B201, 0x0001D6080012B301,
+			0x0001D6090012B401, 0x0001D60A0012B501, 0x0001D60B0012B601, 0x0001D60C0012B701,
+			0x0001D60D0012B801, 0x0001D60E0012B901, 0x0001D60F0012BA01, 0x0001D6100012BB01,
+			0x0001D6110012BC01, 0x0001D6120012BD01, 0x0001D6130012BE01, 0x0001D6140012BF01,
+			0x0001D6150012C001, 0x0001D6160012C101, 0x0001D6170012C201, 0x0001D6180012C301,
+			0x0001D6190012C401, 0x0001D61A0012C501, 0x0001D61B0012C601, 0x0001D61C0012C701,
+			0x0001D61D0012C801, 0x0001D61E0012C901, 0x0001D61F0012CA01, 0x0001D6200012CB01,
+			0x0001D6210012CC01, 0x0001D6220012CD01, 0x0001D6230012CE01, 0x0001D6240012CF01,
+			0x0001D6250012D001, 0x0001D6260012D101, 0x0001D6270012D201, 0x0001D6280012D301,
+			0x0001D6290012D401, 0x0001D62A0012D501, 0x0001D62B0012D601, 0x0001D62C0012D701,
+			0x0001D62D0012D801, 0x0001D62E0012D901, 0x0001D62F0012DA01, 0x0001D6300012DB01,
+			0x0001D6310012DC01, 0x0001D6320012DD01, 0x0001D6330012DE01, 0x0001D6340012DF01,
+			0x0001D6350012E001, 0x0001D6360012E101, 0x0001D6370012E201, 0x0001D6380012E301,
+			0x0001D6390012E401, 0x0001D63A0012E501, 0x0001D63B0012E601, 0x0001D63C0012E701,
+			0x0001D63D0012E801, 0x0001D63E0012E901, 0x0001D63F0012EA01, 0x0001D6400012EB01,
+			0x0001D6410012EC01, 0x0001D6420012ED01, 0x0001D6430012EE01, 0x0001D6440012EF01,
+			0x0001D6450012F001, 0x0001D6460012F101, 0x0001D6470012F201, 0x0001D6480012F301,
+			0x0001D6490012F401, 0x0001D64A0012F501, 0x0001D64B0012F601, 0x0001D64C0012F701,
+			0x0001D64D0012F801, 0x0001D64E0012F901, 0x0001D64F0012FA01, 0x0001D6500012FB01,
+			0x0001D6510012FC01, 0x0001D6520012FD01, 0x0001D6530012FE01, 0x0001D6540012FF01,
+			0x0001D65500130001, 0x0001D65600130101, 0x0001D65700130201, 0x0001D65800130301,
+			0x0001D65900130401, 0x0001D65A00130501, 0x0001D65B00130601, 0x0001D65C00130701,
+			0x0001D65D00130801, 0x0001D65E00130901, 0x0001D65F00130A01, 0x0001D66000130B01,
+			0x0001D66100130C01, 0x0001D66200130D01, 0x0001D66300130E01, 0x0001D66400130F01,
+			0x0001D66500131001, 0x0001D66600131101, 0x0001D66700131201, 0x0001D66800131301,
+			0x0001D66900131401, 0x0001D66A00131501, 0x0001D66B00131601, 0x0001D66C00131701,
+			0x0001D66D00131801, 0x0001D66E00131901, 0x0001D66F00131A01, 0x0001D67000131B01,
+			0x0001D67100131C01, 0x0001D67200131D01, 0x0001D67300131E01, 0x0001D67400131F01,
+			0x0001D67500132001, 0x0001D67600132101, 0x0001D67700132201, 0x0001D67800132301,
+			0x0001D67900132401, 0x0001D67A00132501, 0x0001D67B00132601, 0x0001D67C00132701,
+			0x0001D67D00132801, 0x0001D67E00132901, 0x0001D67F00132A01, 0x0001D68000132B01,
+			0x0001D68100132C01, 0x0001D68200132D01, 0x0001D68300132E01, 0x0001D68400132F01,
+			0x0001D68500133001, 0x0001D68600133101, 0x0001D68700133201, 0x0001D68800133301,
+			0x0001D68900133401, 0x0001D68A00133501, 0x0001D68B00133601, 0x0001D68C00133701,
+			0x0001D68D00133801, 0x0001D68E00133901, 0x0001D68F00133A01, 0x0001D69000133B01,
+			0x0001D69100133C01, 0x0001D69200133D01, 0x0001D69300133E01, 0x0001D69400133F01,
+			0x0001D69500134001, 0x0001D69600134101, 0x0001D69700134201, 0x0001D69800134301,
+			0x0001D69900134401, 0x0001D69A00134501, 0x0001D69B00134601, 0x0001D69C00134701,
+			0x0001D69D00134801, 0x0001D69E00134901, 0x0001D69F00134A01, 0x0001D6A000134B01,
+			0x0001D6A100134C01, 0x0001D6A200134D01, 0x0001D6A300134E01, 0x0001D6A400134F01,
+			0x0001D6A500135001, 0x0001D6A800135101, 0x0001D6A900135201, 0x0001D6AA00135301,
+			0x0001D6AB00135401, 0x0001D6AC00135501, 0x0001D6AD00135601, 0x0001D6AE00135701,
+			0x0001D6AF00135801, 0x0001D6B000135901, 0x0001D6B100135A01, 0x0001D6B200135B01,
+			0x0001D6B300135C01, 0x0001D6B400135D01, 0x0001D6B500135E01, 0x0001D6B600135F01,
+			0x0001D6B700136001, 0x0001D6B800136101, 0x0001D6B900136201, 0x0001D6BA00136301,
+			0x0001D6BB00136401, 0x0001D6BC00136501, 0x0001D6BD00136601, 0x0001D6BE00136701,
+			0x0001D6BF00136801, 0x0001D6C000136901, 0x0001D6C100136A01, 0x0001D6C200136B01,
+			0x0001D6C300136C01, 0x0001D6C400136D01, 0x0001D6C500136E01, 0x0001D6C600136F01,
+			0x0001D6C700137001, 0x0001D6C800137101, 0x0001D6C900137201, 0x0001D6CA00137301,
+			0x0001D6CB00137401, 0x0001D6CC00137501, 0x0001D6CD00137601, 0x0001D6CE00137701,
+			0x0001D6CF00137801, 0x0001D6D000137901, 0x0001D6D100137A01, 0x0001D6D200137B01,
+			0x0001D6D300137C01, 0x0001D6D400137D01, 0x0001D6D500137E01, 0x0001D6D600137F01,
+			0x0001D6D700138001, 0x0001D6D800138101, 0x0001D6D900138201, 0x0001D6DA00138301,
+			0x0001D6DB00138401, 0x0001D6DC00138501, 0x0001D6DD00138601, 0x0001D6DE00138701,
+			0x0001D6DF00138801, 0x0001D6E000138901, 0x0001D6E100138A01, 0x0001D6E200138B01,
+			0x0001D6E300138C01, 0x0001D6E400138D01, 0x0001D6E500138E01, 0x0001D6E600138F01,
+			0x0001D6E700139001, 0x0001D6E800139101, 0x0001D6E900139201, 0x0001D6EA00139301,
+			0x0001D6EB00139401, 0x0001D6EC00139501, 0x0001D6ED00139601, 0x0001D6EE00139701,
+			0x0001D6EF00139801, 0x0001D6F000139901, 0x0001D6F100139A01, 0x0001D6F200139B01,
+			0x0001D6F300139C01, 0x0001D6F400139D01, 0x0001D6F500139E01, 0x0001D6F600139F01,
+			0x0001D6F70013A001, 0x0001D6F80013A101, 0x0001D6F90013A201, 0x0001D6FA0013A301,
+			0x0001D6FB0013A401, 0x0001D6FC0013A501, 0x0001D6FD0013A601, 0x0001D6FE0013A701,
+			0x0001D6FF0013A801, 0x0001D7000013A901, 0x0001D7010013AA01, 0x0001D7020013AB01,
+			0x0001D7030013AC01, 0x0001D7040013AD01, 0x0001D7050013AE01, 0x0001D7060013AF01,
+			0x0001D7070013B001, 0x0001D7080013B101, 0x0001D7090013B201, 0x0001D70A0013B301,
+			0x0001D70B0013B401, 0x0001D70C0013B501, 0x0001D70D0013B601, 0x0001D70E0013B701,
+			0x0001D70F0013B801, 0x0001D7100013B901, 0x0001D7110013BA01, 0x0001D7120013BB01,
+			0x0001D7130013BC01, 0x0001D7140013BD01, 0x0001D7150013BE01, 0x0001D7160013BF01,
+			0x0001D7170013C001, 0x0001D7180013C101, 0x0001D7190013C201, 0x0001D71A0013C301,
+			0x0001D71B0013C401, 0x0001D71C0013C501, 0x0001D71D0013C601, 0x0001D71E0013C701,
+			0x0001D71F0013C801, 0x0001D7200013C901, 0x0001D7210013CA01, 0x0001D7220013CB01,
+			0x0001D7230013CC01, 0x0001D7240013CD01, 0x0001D7250013CE01, 0x0001D7260013CF01,
+			0x0001D7270013D001, 0x0001D7280013D101, 0x0001D7290013D201, 0x0001D72A0013D301,
+			0x0001D72B0013D401, 0x0001D72C0013D501, 0x0001D72D0013D601, 0x0001D72E0013D701,
+			0x0001D72F0013D801, 0x0001D7300013D901, 0x0001D7310013DA01, 0x0001D7320013DB01,
+			0x0001D7330013DC01, 0x0001D7340013DD01, 0x0001D7350013DE01, 0x0001D7360013DF01,
+			0x0001D7370013E001, 0x0001D7380013E101, 0x0001D7390013E201, 0x0001D73A0013E301,
+			0x0001D73B0013E401, 0x0001D73C0013E501, 0x0001D73D0013E601, 0x0001D73E0013E701,
+			0x0001D73F0013E801, 0x0001D7400013E901, 0x0001D7410013EA01, 0x0001D7420013EB01,
+			0x0001D7430013EC01, 0x0001D7440013ED01, 0x0001D7450013EE01, 0x0001D7460013EF01,
+			0x0001D7470013F001, 0x0001D7480013F101, 0x0001D7490013F201, 0x0001D74A0013F301,
+			0x0001D74B0013F401, 0x0001D74C0013F501, 0x0001D74D0013F601, 0x0001D74E0013F701,
+			0x0001D74F0013F801, 0x0001D7500013F901, 0x0001D7510013FA01, 0x0001D7520013FB01,
+			0x0001D7530013FC01, 0x0001D7540013FD01, 0x0001D7550013FE01, 0x0001D7560013FF01,
+			0x0001D75700140001, 0x0001D75800140101, 0x0001D75900140201, 0x0001D75A00140301,
+			0x0001D75B00140401, 0x0001D75C00140501, 0x0001D75D00140601, 0x0001D75E00140701,
+			0x0001D75F00140801, 0x0001D76000140901, 0x0001D76100140A01, 0x0001D76200140B01,
+			0x0001D76300140C01, 0x0001D76400140D01, 0x0001D76500140E01, 0x0001D76600140F01,
+			0x0001D76700141001, 0x0001D76800141101, 0x0001D76900141201, 0x0001D76A00141301,
+			0x0001D76B00141401, 0x0001D76C00141501, 0x0001D76D00141601, 0x0001D76E00141701,
+			0x0001D76F00141801, 0x0001D77000141901, 0x0001D77100141A01, 0x0001D77200141B01,
+			0x0001D77300141C01, 0x0001D77400141D01, 0x0001D77500141E01, 0x0001D77600141F01,
+			0x0001D77700142001, 0x0001D77800142101, 0x0001D77900142201, 0x0001D77A00142301,
+			0x0001D77B00142401, 0x0001D77C00142501, 0x0001D77D00142601, 0x0001D77E00142701,
+			0x0001D77F00142801, 0x0001D78000142901, 0x0001D78100142A01, 0x0001D78200142B01,
+			0x0001D78300142C01, 0x0001D78400142D01, 0x0001D78500142E01, 0x0001D78600142F01,
+			0x0001D78700143001, 0x0001D78800143101, 0x0001D78900143201, 0x0001D78A00143301,
+			0x0001D78B00143401, 0x0001D78C00143501, 0x0001D78D00143601, 0x0001D78E00143701,
+			0x0001D78F00143801, 0x0001D79000143901, 0x0001D79100143A01, 0x0001D79200143B01,
+			0x0001D79300143C01, 0x0001D79400143D01, 0x0001D79500143E01, 0x0001D79600143F01,
+			0x0001D79700144001, 0x0001D79800144101, 0x0001D79900144201, 0x0001D79A00144301,
+			0x0001D79B00144401, 0x0001D79C00144501, 0x0001D79D00144601, 0x0001D79E00144701,
+			0x0001D79F00144801, 0x0001D7A000144901, 0x0001D7A100144A01, 0x0001D7A200144B01,
+			0x0001D7A300144C01, 0x0001D7A400144D01, 0x0001D7A500144E01, 0x0001D7A600144F01,
+			0x0001D7A700145001, 0x0001D7A800145101, 0x0001D7A900145201, 0x0001D7AA00145301,
+			0x0001D7AB00145401, 0x0001D7AC00145501, 0x0001D7AD00145601, 0x0001D7AE00145701,
+			0x0001D7AF00145801, 0x0001D7B000145901, 0x0001D7B100145A01, 0x0001D7B200145B01,
+			0x0001D7B300145C01, 0x0001D7B400145D01, 0x0001D7B500145E01, 0x0001D7B600145F01,
+			0x0001D7B700146001, 0x0001D7B800146101, 0x0001D7B900146201, 0x0001D7BA00146301,
+			0x0001D7BB00146401, 0x0001D7BC00146501, 0x0001D7BD00146601, 0x0001D7BE00146701,
+			0x0001D7BF00146801, 0x0001D7C000146901, 0x0001D7C100146A01, 0x0001D7C200146B01,
+			0x0001D7C300146C01, 0x0001D7C400146D01, 0x0001D7C500146E01, 0x0001D7C600146F01,
+			0x0001D7C700147001, 0x0001D7C800147101, 0x0001D7C900147201, 0x0001D7CA00147301,
+			0x0001D7CB00147401, 0x0001D7CE00147501, 0x0001D7CF00147601, 0x0001D7D000147701,
+			0x0001D7D100147801, 0x0001D7D200147901, 0x0001D7D300147A01, 0x0001D7D400147B01,
+			0x0001D7D500147C01, 0x0001D7D600147D01, 0x0001D7D700147E01, 0x0001D7D800147F01,
+			0x0001D7D900148001, 0x0001D7DA00148101, 0x0001D7DB00148201, 0x0001D7DC00148301,
+			0x0001D7DD00148401, 0x0001D7DE00148501, 0x0001D7DF00148601, 0x0001D7E000148701,
+			0x0001D7E100148801, 0x0001D7E200148901, 0x0001D7E300148A01, 0x0001D7E400148B01,
+			0x0001D7E500148C01, 0x0001D7E600148D01, 0x0001D7E700148E01, 0x0001D7E800148F01,
+			0x0001D7E900149001, 0x0001D7EA00149101, 0x0001D7EB00149201, 0x0001D7EC00149301,
+			0x0001D7ED00149401, 0x0001D7EE00149501, 0x0001D7EF00149601, 0x0001D7F000149701,
+			0x0001D7F100149801, 0x0001D7F200149901, 0x0001D7F300149A01, 0x0001D7F400149B01,
+			0x0001D7F500149C01, 0x0001D7F600149D01, 0x0001D7F700149E01, 0x0001D7F800149F01,
+			0x0001D7F90014A001, 0x0001D7FA0014A101, 0x0001D7FB0014A201, 0x0001D7FC0014A301,
+			0x0001D7FD0014A401, 0x0001D7FE0014A501, 0x0001D7FF0014A601, 0x0001EE000014A701,
+			0x0001EE010014A801, 0x0001EE020014A901, 0x0001EE030014AA01, 0x0001EE050014AB01,
+			0x0001EE060014AC01, 0x0001EE070014AD01, 0x0001EE080014AE01, 0x0001EE090014AF01,
+			0x0001EE0A0014B001, 0x0001EE0B0014B101, 0x0001EE0C0014B201, 0x0001EE0D0014B301,
+			0x0001EE0E0014B401, 0x0001EE0F0014B501, 0x0001EE100014B601, 0x0001EE110014B701,
+			0x0001EE120014B801, 0x0001EE130014B901, 0x0001EE140014BA01, 0x0001EE150014BB01,
+			0x0001EE160014BC01, 0x0001EE170014BD01, 0x0001EE180014BE01, 0x0001EE190014BF01,
+			0x0001EE1A0014C001, 0x0001EE1B0014C101, 0x0001EE1C0014C201, 0x0001EE1D0014C301,
+			0x0001EE1E0014C401, 0x0001EE1F0014C501, 0x0001EE210014C601, 0x0001EE220014C701,
+			0x0001EE240014C801, 0x0001EE270014C901, 0x0001EE290014CA01, 0x0001EE2A0014CB01,
+			0x0001EE2B0014CC01, 0x0001EE2C0014CD01, 0x0001EE2D0014CE01, 0x0001EE2E0014CF01,
+			0x0001EE2F0014D001, 0x0001EE300014D101, 0x0001EE310014D201, 0x0001EE320014D301,
+			0x0001EE340014D401, 0x0001EE350014D501, 0x0001EE360014D601, 0x0001EE370014D701,
+			0x0001EE390014D801, 0x0001EE3B0014D901, 0x0001EE420014DA01, 0x0001EE470014DB01,
+			0x0001EE490014DC01, 0x0001EE4B0014DD01, 0x0001EE4D0014DE01, 0x0001EE4E0014DF01,
+			0x0001EE4F0014E001, 0x0001EE510014E101, 0x0001EE520014E201, 0x0001EE540014E301,
+			0x0001EE570014E401, 0x0001EE590014E501, 0x0001EE5B0014E601, 0x0001EE5D0014E701,
+			0x0001EE5F0014E801, 0x0001EE610014E901, 0x0001EE620014EA01, 0x0001EE640014EB01,
+			0x0001EE670014EC01, 0x0001EE680014ED01, 0x0001EE690014EE01, 0x0001EE6A0014EF01,
+			0x0001EE6C0014F001, 0x0001EE6D0014F101, 0x0001EE6E0014F201, 0x0001EE6F0014F301,
+			0x0001EE700014F401, 0x0001EE710014F501, 0x0001EE720014F601, 0x0001EE740014F701,
+			0x0001EE750014F801, 0x0001EE760014F901, 0x0001EE770014FA01, 0x0001EE790014FB01,
+			0x0001EE7A0014FC01, 0x0001EE7B0014FD01, 0x0001EE7C0014FE01, 0x0001EE7E0014FF01,
+			0x0001EE8000150001, 0x0001EE8100150101, 0x0001EE8200150201, 0x0001EE8300150301,
+			0x0001EE8400150401, 0x0001EE8500150501, 0x0001EE8600150601, 0x0001EE8700150701,
+			0x0001EE8800150801, 0x0001EE8900150901, 0x0001EE8B00150A01, 0x0001EE8C00150B01,
+			0x0001EE8D00150C01, 0x0001EE8E00150D01, 0x0001EE8F00150E01, 0x0001EE9000150F01,
+			0x0001EE9100151001, 0x0001EE9200151101, 0x0001EE9300151201, 0x0001EE9400151301,
+			0x0001EE9500151401, 0x0001EE9600151501, 0x0001EE9700151601, 0x0001EE9800151701,
+			0x0001EE9900151801, 0x0001EE9A00151901, 0x0001EE9B00151A01, 0x0001EEA100151B01,
+			0x0001EEA200151C01, 0x0001EEA300151D01, 0x0001EEA500151E01, 0x0001EEA600151F01,
+			0x0001EEA700152001, 0x0001EEA800152101, 0x0001EEA900152201, 0x0001EEAB00152301,
+			0x0001EEAC00152401, 0x0001EEAD00152501, 0x0001EEAE00152601, 0x0001EEAF00152701,
+			0x0001EEB000152801, 0x0001EEB100152901, 0x0001EEB200152A01, 0x0001EEB300152B01,
+			0x0001EEB400152C01, 0x0001EEB500152D01, 0x0001EEB600152E01, 0x0001EEB700152F01,
+			0x0001EEB800153001, 0x0001EEB900153101, 0x0001EEBA00153201, 0x0001EEBB00153301,
+			0x0001F10000153402, 0x0001F10100153602, 0x0001F10200153802, 0x0001F10300153A02,
+			0x0001F10400153C02, 0x0001F10500153E02, 0x0001F10600154002, 0x0001F10700154202,
+			0x0001F10800154402, 0x0001F10900154602, 0x0001F10A00154802, 0x0001F11000154A03,
+			0x0001F11100154D03, 0x0001F11200155003, 0x0001F11300155303, 0x0001F11400155603,
+			0x0001F11500155903, 0x0001F11600155C03, 0x0001F11700155F03, 0x0001F11800156203,
+			0x0001F11900156503, 0x0001F11A00156803, 0x0001F11B00156B03, 0x0001F11C00156E03,
+			0x0001F11D00157103, 0x0001F11E00157403, 0x0001F11F00157703, 0x0001F12000157A03,
+			0x0001F12100157D03, 0x0001F12200158003, 0x0001F12300158303, 0x0001F12400158603,
+			0x0001F12500158903, 0x0001F12600158C03, 0x0001F12700158F03, 0x0001F12800159203,
+			0x0001F12900159503, 0x0001F12A00159803, 0x0001F12B00159B01, 0x0001F12C00159C01,
+			0x0001F12D00159D02, 0x0001F12E00159F02, 0x0001F1300015A101, 0x0001F1310015A201,
+			0x0001F1320015A301, 0x0001F1330015A401, 0x0001F1340015A501, 0x0001F1350015A601,
+			0x0001F1360015A701, 0x0001F1370015A801, 0x0001F1380015A901, 0x0001F1390015AA01,
+			0x0001F13A0015AB01, 0x0001F13B0015AC01, 0x0001F13C0015AD01, 0x0001F13D0015AE01,
+			0x0001F13E0015AF01, 0x0001F13F0015B001, 0x0001F1400015B101, 0x0001F1410015B201,
+			0x0001F1420015B301, 0x0001F1430015B401, 0x0001F1440015B501, 0x0001F1450015B601,
+			0x0001F1460015B701, 0x0001F1470015B801, 0x0001F1480015B901, 0x0001F1490015BA01,
+			0x0001F14A0015BB02, 0x0001F14B0015BD02, 0x0001F14C0015BF02, 0x0001F14D0015C102,
+			0x0001F14E0015C303, 0x0001F14F0015C602, 0x0001F16A0015C802, 0x0001F16B0015CA02,
+			0x0001F16C0015CC02, 0x0001F1900015CE02, 0x0001F2000015D002, 0x0001F2010015D202,
+			0x0001F2020015D401, 0x0001F2100015D501, 0x0001F2110015D601, 0x0001F2120015D701,
+			0x0001F2130015D802, 0x0001F2140015DA01, 0x0001F2150015DB01, 0x0001F2160015DC01,
+			0x0001F2170015DD01, 0x0001F2180015DE01, 0x0001F2190015DF01, 0x0001F21A0015E001,
+			0x0001F21B0015E101, 0x0001F21C0015E201, 0x0001F21D0015E301, 0x0001F21E0015E401,
+			0x0001F21F0015E501, 0x0001F2200015E601, 0x0001F2210015E701, 0x0001F2220015E801,
+			0x0001F2230015E901, 0x0001F2240015EA01, 0x0001F2250015EB01, 0x0001F2260015EC01,
+			0x0001F2270015ED01, 0x0001F2280015EE01, 0x0001F2290015EF01, 0x0001F22A0015F001,
+			0x0001F22B0015F101, 0x0001F22C0015F201, 0x0001F22D0015F301, 0x0001F22E0015F401,
+			0x0001F22F0015F501, 0x0001F2300015F601, 0x0001F2310015F701, 0x0001F2320015F801,
+			0x0001F2330015F901, 0x0001F2340015FA01, 0x0001F2350015FB01, 0x0001F2360015FC01,
+			0x0001F2370015FD01, 0x0001F2380015FE01, 0x0001F2390015FF01, 0x0001F23A00160001,
+			0x0001F23B00160101, 0x0001F24000160203, 0x0001F24100160503, 0x0001F24200160803,
+			0x0001F24300160B03, 0x0001F24400160E03, 0x0001F24500161103, 0x0001F24600161403,
+			0x0001F24700161703, 0x0001F24800161A03, 0x0001F25000161D01, 0x0001F25100161E01,
+			0x0001FBF000161F01, 0x0001FBF100162001, 0x0001FBF200162101, 0x0001FBF300162201,
+			0x0001FBF400162301, 0x0001FBF500162401, 0x0001FBF600162501, 0x0001FBF700162601,
+			0x0001FBF800162701, 0x0001FBF900162801,
+		};
+
+		// Code points of the compatibility decompositions
+		inline constexpr char32_t compatibility_pool[5673] = {
+			32, 32, 776, 97, 32, 772, 50, 51, 32, 769, 956, 32, 807, 49, 111, 49, 8260, 52, 49, 8260, 50, 51, 8260, 52,
+			73, 74, 105, 106, 76, 183, 108, 183, 700, 110, 115, 68, 90, 780, 68, 122, 780, 100, 122, 780, 76, 74, 76, 106,
+			108, 106, 78, 74, 78, 106, 110, 106, 68, 90, 68, 122, 100, 122, 104, 614, 106, 114, 633, 635, 641, 119, 121, 32,
+			774, 32, 775, 32, 778, 32, 808, 32, 771, 32, 779, 611, 108, 115, 120, 661, 32, 837, 32, 769, 32, 776, 769, 946,
+			952, 933, 933, 769, 933, 776, 966, 960, 954, 961, 962, 920, 949, 931, 1381, 1410, 1575, 1652, 1608, 1652, 1735, 1652, 1610, 1652,
+			3661, 3634, 3789, 3762, 3755, 3737, 3755, 3745, 3851, 4018, 3953, 3968, 4019, 3953, 3968, 4316, 65, 198, 66, 68, 69, 398, 71, 72,
+			73, 74, 75, 76, 77, 78, 79, 546, 80, 82, 84, 85, 87, 97, 592, 593, 7426, 98, 100, 101, 601, 603, 604, 103,
+			107, 109, 331, 111, 596, 7446, 7447, 112, 116, 117, 7453, 623, 118, 7461, 946, 947, 948, 966, 967, 105, 114, 117, 118, 946,
+			947, 961, 966, 967, 1085, 594, 99, 597, 240, 604, 102, 607, 609, 613, 616, 617, 618, 7547, 669, 621, 7557, 671, 625, 624,
+			626, 627, 628, 629, 632, 642, 643, 427, 649, 650, 7452, 651, 652, 122, 656, 657, 658, 952, 97, 702, 115, 775, 32, 787,
+			32, 787, 32, 834, 32, 776, 834, 32, 787, 768, 32, 787, 769, 32, 787, 834, 32, 788, 768, 32, 788, 769, 32, 788,
+			834, 32, 776, 768, 32, 776, 769, 32, 769, 32, 788, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 8208, 32,
+			819, 46, 46, 46, 46, 46, 46, 32, 8242, 8242, 8242, 8242, 8242, 8245, 8245, 8245, 8245, 8245, 33, 33, 32, 773, 63, 63,
+			63, 33, 33, 63, 8242, 8242, 8242, 8242, 32, 48, 105, 52, 53, 54, 55, 56, 57, 43, 8722, 61, 40, 41, 110, 48,
+			49, 50, 51, 52, 53, 54, 55, 56, 57, 43, 8722, 61, 40, 41, 97, 101, 111, 120, 601, 104, 107, 108, 109, 110,
+			112, 115, 116, 82, 115, 97, 47, 99, 97, 47, 115, 67, 176, 67, 99, 47, 111, 99, 47, 117, 400, 176, 70, 103,
+			72, 72, 72, 104, 295, 73, 73, 76, 108, 78, 78, 111, 80, 81, 82, 82, 82, 83, 77, 84, 69, 76, 84, 77,
+			90, 90, 66, 67, 101, 69, 70, 77, 111, 1488, 1489, 1490, 1491, 105, 70, 65, 88, 960, 947, 915, 928, 8721, 68, 100,
+			101, 105, 106, 49, 8260, 55, 49, 8260, 57, 49, 8260, 49, 48, 49, 8260, 51, 50, 8260, 51, 49, 8260, 53, 50, 8260,
+			53, 51, 8260, 53, 52, 8260, 53, 49, 8260, 54, 53, 8260, 54, 49, 8260, 56, 51, 8260, 56, 53, 8260, 56, 55, 8260,
+			56, 49, 8260, 73, 73, 73, 73, 73, 73, 73, 86, 86, 86, 73, 86, 73, 73, 86, 73, 73, 73, 73, 88, 88,
+			88, 73, 88, 73, 73, 76, 67, 68, 77, 105, 105, 105, 105, 105, 105, 105, 118, 118, 118, 105, 118, 105, 105, 118,
+			105, 105, 105, 105, 120, 120, 120, 105, 120, 105, 105, 108, 99, 100, 109, 48, 8260, 51, 8747, 8747, 8747, 8747, 8747, 8750,
+			8750, 8750, 8750, 8750, 49, 50, 51, 52, 53, 54, 55, 56, 57, 49, 48, 49, 49, 49, 50, 49, 51, 49, 52, 49,
+			53, 49, 54, 49, 55, 49, 56, 49, 57, 50, 48, 40, 49, 41, 40, 50, 41, 40, 51, 41, 40, 52, 41, 40,
+			53, 41, 40, 54, 41, 40, 55, 41, 40, 56, 41, 40, 57, 41, 40, 49, 48, 41, 40, 49, 49, 41, 40, 49,
+			50, 41, 40, 49, 51, 41, 40, 49, 52, 41, 40, 49, 53, 41, 40, 49, 54, 41, 40, 49, 55, 41, 40, 49,
+			56, 41, 40, 49, 57, 41, 40, 50, 48, 41, 49, 46, 50, 46, 51, 46, 52, 46, 53, 46, 54, 46, 55, 46,
+			56, 46, 57, 46, 49, 48, 46, 49, 49, 46, 49, 50, 46, 49, 51, 46, 49, 52, 46, 49, 53, 46, 49, 54,
+			46, 49, 55, 46, 49, 56, 46, 49, 57, 46, 50, 48, 46, 40, 97, 41, 40, 98, 41, 40, 99, 41, 40, 100,
+			41, 40, 101, 41, 40, 102, 41, 40, 103, 41, 40, 104, 41, 40, 105, 41, 40, 106, 41, 40, 107, 41, 40, 108,
+			41, 40, 109, 41, 40, 110, 41, 40, 111, 41, 40, 112, 41, 40, 113, 41, 40, 114, 41, 40, 115, 41, 40, 116,
+			41, 40, 117, 41, 40, 118, 41, 40, 119, 41, 40, 120, 41, 40, 121, 41, 40, 122, 41, 65, 66, 67, 68, 69,
+			70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99,
+			100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 48,
+			8747, 8747, 8747, 8747, 58, 58, 61, 61, 61, 61, 61, 61, 106, 86, 11617, 27597, 40863, 19968, 20008, 20022, 20031, 20057, 20101, 20108,
+			20128, 20154, 20799, 20837, 20843, 20866, 20886, 20907, 20960, 20981, 20992, 21147, 21241, 21269, 21274, 21304, 21313, 21340, 21353, 21378, 21430, 21448, 21475, 22231,
+			22303, 22763, 22786, 22794, 22805, 22823, 22899, 23376, 23424, 23544, 23567, 23586, 23608, 23662, 23665, 24027, 24037, 24049, 24062, 24178, 24186, 24191, 24308, 24318,
+			24331, 24339, 24400, 24417, 24435, 24515, 25096, 25142, 25163, 25903, 25908, 25991, 26007, 26020, 26041, 26080, 26085, 26352, 26376, 26408, 27424, 27490, 27513, 27571,
+			27595, 27604, 27611, 27663, 27668, 27700, 28779, 29226, 29238, 29243, 29247, 29255, 29273, 29275, 29356, 29572, 29577, 29916, 29926, 29976, 29983, 29992, 30000, 30091,
+			30098, 30326, 30333, 30382, 30399, 30446, 30683, 30690, 30707, 31034, 31160, 31166, 31348, 31435, 31481, 31859, 31992, 32566, 32593, 32650, 32701, 32769, 32780, 32786,
+			32819, 32895, 32905, 33251, 33258, 33267, 33276, 33292, 33307, 33311, 33390, 33394, 33400, 34381, 34411, 34880, 34892, 34915, 35198, 35211, 35282, 35328, 35895, 35910,
+			35925, 35960, 35997, 36196, 36208, 36275, 36523, 36554, 36763, 36784, 36789, 37009, 37193, 37318, 37324, 37329, 38263, 38272, 38428, 38582, 38585, 38632, 38737, 38750,
+			38754, 38761, 38859, 38893, 38899, 38913, 39080, 39131, 39135, 39318, 39321, 39340, 39592, 39640, 39647, 39717, 39727, 39730, 39740, 39770, 40165, 40565, 40575, 40613,
+			40635, 40643, 40653, 40657, 40697, 40701, 40718, 40723, 40736, 40763, 40778, 40786, 40845, 40860, 40864, 32, 12306, 21313, 21316, 21317, 32, 12441, 32, 12442,
+			12424, 12426, 12467, 12488, 4352, 4353, 4522, 4354, 4524, 4525, 4355, 4356, 4357, 4528, 4529, 4530, 4531, 4532, 4533, 4378, 4358, 4359, 4360, 4385,
+			4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449, 4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462,
+			4463, 4464, 4465, 4466, 4467, 4468, 4469, 4448, 4372, 4373, 4551, 4552, 4556, 4558, 4563, 4567, 4569, 4380, 4573, 4575, 4381, 4382, 4384, 4386,
+			4387, 4391, 4393, 4395, 4396, 4397, 4398, 4399, 4402, 4406, 4416, 4423, 4428, 4593, 4594, 4439, 4440, 4441, 4484, 4485, 4488, 4497, 4498, 4500,
+			4510, 4513, 19968, 20108, 19977, 22235, 19978, 20013, 19979, 30002, 20057, 19993, 19969, 22825, 22320, 20154, 40, 4352, 41, 40, 4354, 41, 40, 4355,
+			41, 40, 4357, 41, 40, 4358, 41, 40, 4359, 41, 40, 4361, 41, 40, 4363, 41, 40, 4364, 41, 40, 4366, 41, 40, 4367,
+			41, 40, 4368, 41, 40, 4369, 41, 40, 4370, 41, 40, 4352, 4449, 41, 40, 4354, 4449, 41, 40, 4355, 4449, 41, 40, 4357,
+			4449, 41, 40, 4358, 4449, 41, 40, 4359, 4449, 41, 40, 4361, 4449, 41, 40, 4363, 4449, 41, 40, 4364, 4449, 41, 40, 4366,
+			4449, 41, 40, 4367, 4449, 41, 40, 4368, 4449, 41, 40, 4369, 4449, 41, 40, 4370, 4449, 41, 40, 4364, 4462, 41, 40, 4363,
+			4457, 4364, 4453, 4523, 41, 40, 4363, 4457, 4370, 4462, 41, 40, 19968, 41, 40, 20108, 41, 40, 19977, 41, 40, 22235, 41, 40,
+			20116, 41, 40, 20845, 41, 40, 19971, 41, 40, 20843, 41, 40, 20061, 41, 40, 21313, 41, 40, 26376, 41, 40, 28779, 41, 40,
+			27700, 41, 40, 26408, 41, 40, 37329, 41, 40, 22303, 41, 40, 26085, 41, 40, 26666, 41, 40, 26377, 41, 40, 31038, 41, 40,
+			21517, 41, 40, 29305, 41, 40, 36001, 41, 40, 31069, 41, 40, 21172, 41, 40, 20195, 41, 40, 21628, 41, 40, 23398, 41, 40,
+			30435, 41, 40, 20225, 41, 40, 36039, 41, 40, 21332, 41, 40, 31085, 41, 40, 20241, 41, 40, 33258, 41, 40, 33267, 41, 21839,
+			24188, 25991, 31631, 80, 84, 69, 50, 49, 50, 50, 50, 51, 50, 52, 50, 53, 50, 54, 50, 55, 50, 56, 50, 57,
+			51, 48, 51, 49, 51, 50, 51, 51, 51, 52, 51, 53, 4352, 4354, 4355, 4357, 4358, 4359, 4361, 4363, 4364, 4366, 4367, 4368,
+			4369, 4370, 4352, 4449, 4354, 4449, 4355, 4449, 4357, 4449, 4358, 4449, 4359, 4449, 4361, 4449, 4363, 4449, 4364, 4449, 4366, 4449, 4367, 4449,
+			4368, 4449, 4369, 4449, 4370, 4449, 4366, 4449, 4535, 4352, 4457, 4364, 4462, 4363, 4468, 4363, 4462, 19968, 20108, 19977, 22235, 20116, 20845, 19971,
+			20843, 20061, 21313, 26376, 28779, 27700, 26408, 37329, 22303, 26085, 26666, 26377, 31038, 21517, 29305, 36001, 31069, 21172, 31192, 30007, 22899, 36969, 20778, 21360,
+			27880, 38917, 20241, 20889, 27491, 19978, 20013, 19979, 24038, 21491, 21307, 23447, 23398, 30435, 20225, 36039, 21332, 22812, 51, 54, 51, 55, 51, 56,
+			51, 57, 52, 48, 52, 49, 52, 50, 52, 51, 52, 52, 52, 53, 52, 54, 52, 55, 52, 56, 52, 57, 53, 48,
+			49, 26376, 50, 26376, 51, 26376, 52, 26376, 53, 26376, 54, 26376, 55, 26376, 56, 26376, 57, 26376, 49, 48, 26376, 49, 49, 26376,
+			49, 50, 26376, 72, 103, 101, 114, 103, 101, 86, 76, 84, 68, 12450, 12452, 12454, 12456, 12458, 12459, 12461, 12463, 12465, 12467, 12469,
+			12471, 12473, 12475, 12477, 12479, 12481, 12484, 12486, 12488, 12490, 12491, 12492, 12493, 12494, 12495, 12498, 12501, 12504, 12507, 12510, 12511, 12512, 12513, 12514,
+			12516, 12518, 12520, 12521, 12522, 12523, 12524, 12525, 12527, 12528, 12529, 12530, 20196, 21644, 12450, 12495, 12442, 12540, 12488, 12450, 12523, 12501, 12449, 12450,
+			12531, 12504, 12442, 12450, 12450, 12540, 12523, 12452, 12491, 12531, 12463, 12441, 12452, 12531, 12481, 12454, 12457, 12531, 12456, 12473, 12463, 12540, 12488, 12441,
+			12456, 12540, 12459, 12540, 12458, 12531, 12473, 12458, 12540, 12512, 12459, 12452, 12522, 12459, 12521, 12483, 12488, 12459, 12525, 12522, 12540, 12459, 12441, 12525,
+			12531, 12459, 12441, 12531, 12510, 12461, 12441, 12459, 12441, 12461, 12441, 12491, 12540, 12461, 12517, 12522, 12540, 12461, 12441, 12523, 12479, 12441, 12540, 12461,
+			12525, 12461, 12525, 12463, 12441, 12521, 12512, 12461, 12525, 12513, 12540, 12488, 12523, 12461, 12525, 12527, 12483, 12488, 12463, 12441, 12521, 12512, 12463, 12441,
+			12521, 12512, 12488, 12531, 12463, 12523, 12475, 12441, 12452, 12525, 12463, 12525, 12540, 12493, 12465, 12540, 12473, 12467, 12523, 12490, 12467, 12540, 12507, 12442,
+			12469, 12452, 12463, 12523, 12469, 12531, 12481, 12540, 12512, 12471, 12522, 12531, 12463, 12441, 12475, 12531, 12481, 12475, 12531, 12488, 12479, 12441, 12540, 12473,
+			12486, 12441, 12471, 12488, 12441, 12523, 12488, 12531, 12490, 12494, 12494, 12483, 12488, 12495, 12452, 12484, 12495, 12442, 12540, 12475, 12531, 12488, 12495, 12442,
+			12540, 12484, 12495, 12441, 12540, 12524, 12523, 12498, 12442, 12450, 12473, 12488, 12523, 12498, 12442, 12463, 12523, 12498, 12442, 12467, 12498, 12441, 12523, 12501,
+			12449, 12521, 12483, 12488, 12441, 12501, 12451, 12540, 12488, 12501, 12441, 12483, 12471, 12455, 12523, 12501, 12521, 12531, 12504, 12463, 12479, 12540, 12523, 12504,
+			12442, 12477, 12504, 12442, 12491, 12498, 12504, 12523, 12484, 12504, 12442, 12531, 12473, 12504, 12442, 12540, 12471, 12441, 12504, 12441, 12540, 12479, 12507, 12442,
+			12452, 12531, 12488, 12507, 12441, 12523, 12488, 12507, 12531, 12507, 12442, 12531, 12488, 12441, 12507, 12540, 12523, 12507, 12540, 12531, 12510, 12452, 12463, 12525,
+			12510, 12452, 12523, 12510, 12483, 12495, 12510, 12523, 12463, 12510, 12531, 12471, 12519, 12531, 12511, 12463, 12525, 12531, 12511, 12522, 12511, 12522, 12495, 12441,
+			12540, 12523, 12513, 12459, 12441, 12513, 12459, 12441, 12488, 12531, 12513, 12540, 12488, 12523, 12516, 12540, 12488, 12441, 12516, 12540, 12523, 12518, 12450, 12531,
+			12522, 12483, 12488, 12523, 12522, 12521, 12523, 12498, 12442, 12540, 12523, 12540, 12501, 12441, 12523, 12524, 12512, 12524, 12531, 12488, 12465, 12441, 12531, 12527,
+			12483, 12488, 48, 28857, 49, 28857, 50, 28857, 51, 28857, 52, 28857, 53, 28857, 54, 28857, 55, 28857, 56, 28857, 57, 28857, 49, 48,
+			28857, 49, 49, 28857, 49, 50, 28857, 49, 51, 28857, 49, 52, 28857, 49, 53, 28857, 49, 54, 28857, 49, 55, 28857, 49, 56,
+			28857, 49, 57, 28857, 50, 48, 28857, 50, 49, 28857, 50, 50, 28857, 50, 51, 28857, 50, 52, 28857, 104, 80, 97, 100, 97,
+			65, 85, 98, 97, 114, 111, 86, 112, 99, 100, 109, 100, 109, 50, 100, 109, 51, 73, 85, 24179, 25104, 26157, 21644, 22823,
+			27491, 26126, 27835, 26666, 24335, 20250, 31038, 112, 65, 110, 65, 956, 65, 109, 65, 107, 65, 75, 66, 77, 66, 71, 66, 99,
+			97, 108, 107, 99, 97, 108, 112, 70, 110, 70, 956, 70, 956, 103, 109, 103, 107, 103, 72, 122, 107, 72, 122, 77,
+			72, 122, 71, 72, 122, 84, 72, 122, 956, 108, 109, 108, 100, 108, 107, 108, 102, 109, 110, 109, 956, 109, 109, 109,
+			99, 109, 107, 109, 109, 109, 50, 99, 109, 50, 109, 50, 107, 109, 50, 109, 109, 51, 99, 109, 51, 109, 51, 107,
+			109, 51, 109, 8725, 115, 109, 8725, 115, 50, 80, 97, 107, 80, 97, 77, 80, 97, 71, 80, 97, 114, 97, 100, 114,
+			97, 100, 8725, 115, 114, 97, 100, 8725, 115, 50, 112, 115, 110, 115, 956, 115, 109, 115, 112, 86, 110, 86, 956, 86,
+			109, 86, 107, 86, 77, 86, 112, 87, 110, 87, 956, 87, 109, 87, 107, 87, 77, 87, 107, 937, 77, 937, 97, 46,
+			109, 46, 66, 113, 99, 99, 99, 100, 67, 8725, 107, 103, 67, 111, 46, 100, 66, 71, 121, 104, 97, 72, 80, 105,
+			110, 75, 75, 75, 77, 107, 116, 108, 109, 108, 110, 108, 111, 103, 108, 120, 109, 98, 109, 105, 108, 109, 111, 108,
+			80, 72, 112, 46, 109, 46, 80, 80, 77, 80, 82, 115, 114, 83, 118, 87, 98, 86, 8725, 109, 65, 8725, 109, 49,
+			26085, 50, 26085, 51, 26085, 52, 26085, 53, 26085, 54, 26085, 55, 26085, 56, 26085, 57, 26085, 49, 48, 26085, 49, 49, 26085, 49,
+			50, 26085, 49, 51, 26085, 49, 52, 26085, 49, 53, 26085, 49, 54, 26085, 49, 55, 26085, 49, 56, 26085, 49, 57, 26085, 50,
+			48, 26085, 50, 49, 26085, 50, 50, 26085, 50, 51, 26085, 50, 52, 26085, 50, 53, 26085, 50, 54, 26085, 50, 55, 26085, 50,
+			56, 26085, 50, 57, 26085, 51, 48, 26085, 51, 49, 26085, 103, 97, 108, 1098, 1100, 42863, 67, 70, 81, 294, 339, 42791, 43831,
+			619, 43858, 653, 102, 102, 102, 105, 102, 108, 102, 102, 105, 102, 102, 108, 115, 116, 115, 116, 1396, 1398, 1396, 1381, 1396,
+			1387, 1406, 1398, 1396, 1389, 1506, 1488, 1491, 1492, 1499, 1500, 1501, 1512, 1514, 43, 1488, 1500, 1649, 1649, 1659, 1659, 1659, 1659, 1662,
+			1662, 1662, 1662, 1664, 1664, 1664, 1664, 1658, 1658, 1658, 1658, 1663, 1663, 1663, 1663, 1657, 1657, 1657, 1657, 1700, 1700, 1700, 1700, 1702,
+			1702, 1702, 1702, 1668, 1668, 1668, 1668, 1667, 1667, 1667, 1667, 1670, 1670, 1670, 1670, 1671, 1671, 1671, 1671, 1677, 1677, 1676, 1676, 1678,
+			1678, 1672, 1672, 1688, 1688, 1681, 1681, 1705, 1705, 1705, 1705, 1711, 1711, 1711, 1711, 1715, 1715, 1715, 1715, 1713, 1713, 1713, 1713, 1722,
+			1722, 1723, 1723, 1723, 1723, 1749, 1620, 1749, 1620, 1729, 1729, 1729, 1729, 1726, 1726, 1726, 1726, 1746, 1746, 1746, 1620, 1746, 1620, 1709,
+			1709, 1709, 1709, 1735, 1735, 1734, 1734, 1736, 1736, 1735, 1652, 1739, 1739, 1733, 1733, 1737, 1737, 1744, 1744, 1744, 1744, 1609, 1609, 1610,
+			1620, 1575, 1610, 1620, 1575, 1610, 1620, 1749, 1610, 1620, 1749, 1610, 1620, 1608, 1610, 1620, 1608, 1610, 1620, 1735, 1610, 1620, 1735, 1610,
+			1620, 1734, 1610, 1620, 1734, 1610, 1620, 1736, 1610, 1620, 1736, 1610, 1620, 1744, 1610, 1620, 1744, 1610, 1620, 1744, 1610, 1620, 1609, 1610,
+			1620, 1609, 1610, 1620, 1609, 1740, 1740, 1740, 1740, 1610, 1620, 1580, 1610, 1620, 1581, 1610, 1620, 1605, 1610, 1620, 1609, 1610, 1620, 1610,
+			1576, 1580, 1576, 1581, 1576, 1582, 1576, 1605, 1576, 1609, 1576, 1610, 1578, 1580, 1578, 1581, 1578, 1582, 1578, 1605, 1578, 1609, 1578, 1610,
+			1579, 1580, 1579, 1605, 1579, 1609, 1579, 1610, 1580, 1581, 1580, 1605, 1581, 1580, 1581, 1605, 1582, 1580, 1582, 1581, 1582, 1605, 1587, 1580,
+			1587, 1581, 1587, 1582, 1587, 1605, 1589, 1581, 1589, 1605, 1590, 1580, 1590, 1581, 1590, 1582, 1590, 1605, 1591, 1581, 1591, 1605, 1592, 1605,
+			1593, 1580, 1593, 1605, 1594, 1580, 1594, 1605, 1601, 1580, 1601, 1581, 1601, 1582, 1601, 1605, 1601, 1609, 1601, 1610, 1602, 1581, 1602, 1605,
+			1602, 1609, 1602, 1610, 1603, 1575, 1603, 1580, 1603, 1581, 1603, 1582, 1603, 1604, 1603, 1605, 1603, 1609, 1603, 1610, 1604, 1580, 1604, 1581,
+			1604, 1582, 1604, 1605, 1604, 1609, 1604, 1610, 1605, 1580, 1605, 1581, 1605, 1582, 1605, 1605, 1605, 1609, 1605, 1610, 1606, 1580, 1606, 1581,
+			1606, 1582, 1606, 1605, 1606, 1609, 1606, 1610, 1607, 1580, 1607, 1605, 1607, 1609, 1607, 1610, 1610, 1580, 1610, 1581, 1610, 1582, 1610, 1605,
+			1610, 1609, 1610, 1610, 1584, 1648, 1585, 1648, 1609, 1648, 32, 1612, 1617, 32, 1613, 1617, 32, 1614, 1617, 32, 1615, 1617, 32, 1616,
+			1617, 32, 1617, 1648, 1610, 1620, 1585, 1610, 1620, 1586, 1610, 1620, 1605, 1610, 1620, 1606, 1610, 1620, 1609, 1610, 1620, 1610, 1576, 1585,
+			1576, 1586, 1576, 1605, 1576, 1606, 1576, 1609, 1576, 1610, 1578, 1585, 1578, 1586, 1578, 1605, 1578, 1606, 1578, 1609, 1578, 1610, 1579, 1585,
+			1579, 1586, 1579, 1605, 1579, 1606, 1579, 1609, 1579, 1610, 1601, 1609, 1601, 1610, 1602, 1609, 1602, 1610, 1603, 1575, 1603, 1604, 1603, 1605,
+			1603, 1609, 1603, 1610, 1604, 1605, 1604, 1609, 1604, 1610, 1605, 1575, 1605, 1605, 1606, 1585, 1606, 1586, 1606, 1605, 1606, 1606, 1606, 1609,
+			1606, 1610, 1609, 1648, 1610, 1585, 1610, 1586, 1610, 1605, 1610, 1606, 1610, 1609, 1610, 1610, 1610, 1620, 1580, 1610, 1620, 1581, 1610, 1620,
+			1582, 1610, 1620, 1605, 1610, 1620, 1607, 1576, 1580, 1576, 1581, 1576, 1582, 1576, 1605, 1576, 1607, 1578, 1580, 1578, 1581, 1578, 1582, 1578,
+			1605, 1578, 1607, 1579, 1605, 1580, 1581, 1580, 1605, 1581, 1580, 1581, 1605, 1582, 1580, 1582, 1605, 1587, 1580, 1587, 1581, 1587, 1582, 1587,
+			1605, 1589, 1581, 1589, 1582, 1589, 1605, 1590, 1580, 1590, 1581, 1590, 1582, 1590, 1605, 1591, 1581, 1592, 1605, 1593, 1580, 1593, 1605, 1594,
+			1580, 1594, 1605, 1601, 1580, 1601, 1581, 1601, 1582, 1601, 1605, 1602, 1581, 1602, 1605, 1603, 1580, 1603, 1581, 1603, 1582, 1603, 1604, 1603,
+			1605, 1604, 1580, 1604, 1581, 1604, 1582, 1604, 1605, 1604, 1607, 1605, 1580, 1605, 1581, 1605, 1582, 1605, 1605, 1606, 1580, 1606, 1581, 1606,
+			1582, 1606, 1605, 1606, 1607, 1607, 1580, 1607, 1605, 1607, 1648, 1610, 1580, 1610, 1581, 1610, 1582, 1610, 1605, 1610, 1607, 1610, 1620, 1605,
+			1610, 1620, 1607, 1576, 1605, 1576, 1607, 1578, 1605, 1578, 1607, 1579, 1605, 1579, 1607, 1587, 1605, 1587, 1607, 1588, 1605, 1588, 1607, 1603,
+			1604, 1603, 1605, 1604, 1605, 1606, 1605, 1606, 1607, 1610, 1605, 1610, 1607, 1600, 1614, 1617, 1600, 1615, 1617, 1600, 1616, 1617, 1591, 1609,
+			1591, 1610, 1593, 1609, 1593, 1610, 1594, 1609, 1594, 1610, 1587, 1609, 1587, 1610, 1588, 1609, 1588, 1610, 1581, 1609, 1581, 1610, 1580, 1609,
+			1580, 1610, 1582, 1609, 1582, 1610, 1589, 1609, 1589, 1610, 1590, 1609, 1590, 1610, 1588, 1580, 1588, 1581, 1588, 1582, 1588, 1605, 1588, 1585,
+			1587, 1585, 1589, 1585, 1590, 1585, 1591, 1609, 1591, 1610, 1593, 1609, 1593, 1610, 1594, 1609, 1594, 1610, 1587, 1609, 1587, 1610, 1588, 1609,
+			1588, 1610, 1581, 1609, 1581, 1610, 1580, 1609, 1580, 1610, 1582, 1609, 1582, 1610, 1589, 1609, 1589, 1610, 1590, 1609, 1590, 1610, 1588, 1580,
+			1588, 1581, 1588, 1582, 1588, 1605, 1588, 1585, 1587, 1585, 1589, 1585, 1590, 1585, 1588, 1580, 1588, 1581, 1588, 1582, 1588, 1605, 1587, 1607,
+			1588, 1607, 1591, 1605, 1587, 1580, 1587, 1581, 1587, 1582, 1588, 1580, 1588, 1581, 1588, 1582, 1591, 1605, 1592, 1605, 1575, 1611, 1575, 1611,
+			1578, 1580, 1605, 1578, 1581, 1580, 1578, 1581, 1580, 1578, 1581, 1605, 1578, 1582, 1605, 1578, 1605, 1580, 1578, 1605, 1581, 1578, 1605, 1582,
+			1580, 1605, 1581, 1580, 1605, 1581, 1581, 1605, 1610, 1581, 1605, 1609, 1587, 1581, 1580, 1587, 1580, 1581, 1587, 1580, 1609, 1587, 1605, 1581,
+			1587, 1605, 1581, 1587, 1605, 1580, 1587, 1605, 1605, 1587, 1605, 1605, 1589, 1581, 1581, 1589, 1581, 1581, 1589, 1605, 1605, 1588, 1581, 1605,
+			1588, 1581, 1605, 1588, 1580, 1610, 1588, 1605, 1582, 1588, 1605, 1582, 1588, 1605, 1605, 1588, 1605, 1605, 1590, 1581, 1609, 1590, 1582, 1605,
+			1590, 1582, 1605, 1591, 1605, 1581, 1591, 1605, 1581, 1591, 1605, 1605, 1591, 1605, 1610, 1593, 1580, 1605, 1593, 1605, 1605, 1593, 1605, 1605,
+			1593, 1605, 1609, 1594, 1605, 1605, 1594, 1605, 1610, 1594, 1605, 1609, 1601, 1582, 1605, 1601, 1582, 1605, 1602, 1605, 1581, 1602, 1605, 1605,
+			1604, 1581, 1605, 1604, 1581, 1610, 1604, 1581, 1609, 1604, 1580, 1580, 1604, 1580, 1580, 1604, 1582, 1605, 1604, 1582, 1605, 1604, 1605, 1581,
+			1604, 1605, 1581, 1605, 1581, 1580, 1605, 1581, 1605, 1605, 1581, 1610, 1605, 1580, 1581, 1605, 1580, 1605, 1605, 1582, 1580, 1605, 1582, 1605,
+			1605, 1580, 1582, 1607, 1605, 1580, 1607, 1605, 1605, 1606, 1581, 1605, 1606, 1581, 1609, 1606, 1580, 1605, 1606, 1580, 1605, 1606, 1580, 1609,
+			1606, 1605, 1610, 1606, 1605, 1609, 1610, 1605, 1605, 1610, 1605, 1605, 1576, 1582, 1610, 1578, 1580, 1610, 1578, 1580, 1609, 1578, 1582, 1610,
+			1578, 1582, 1609, 1578, 1605, 1610, 1578, 1605, 1609, 1580, 1605, 1610, 1580, 1581, 1609, 1580, 1605, 1609, 1587, 1582, 1609, 1589, 1581, 1610,
+			1588, 1581, 1610, 1590, 1581, 1610, 1604, 1580, 1610, 1604, 1605, 1610, 1610, 1581, 1610, 1610, 1580, 1610, 1610, 1605, 1610, 1605, 1605, 1610,
+			1602, 1605, 1610, 1606, 1581, 1610, 1602, 1605, 1581, 1604, 1581, 1605, 1593, 1605, 1610, 1603, 1605, 1610, 1606, 1580, 1581, 1605, 1582, 1610,
+			1604, 1580, 1605, 1603, 1605, 1605, 1604, 1580, 1605, 1606, 1580, 1581, 1580, 1581, 1610, 1581, 1580, 1610, 1605, 1580, 1610, 1601, 1605, 1610,
+			1576, 1581, 1610, 1603, 1605, 1605, 1593, 1580, 1605, 1589, 1605, 1605, 1587, 1582, 1610, 1606, 1580, 1610, 1589, 1604, 1746, 1602, 1604, 1746,
+			1575, 1604, 1604, 1607, 1575, 1603, 1576, 1585, 1605, 1581, 1605, 1583, 1589, 1604, 1593, 1605, 1585, 1587, 1608, 1604, 1593, 1604, 1610, 1607,
+			1608, 1587, 1604, 1605, 1589, 1604, 1609, 1589, 1604, 1609, 32, 1575, 1604, 1604, 1607, 32, 1593, 1604, 1610, 1607, 32, 1608, 1587, 1604,
+			1605, 1580, 1604, 32, 1580, 1604, 1575, 1604, 1607, 1585, 1740, 1575, 1604, 44, 12289, 12290, 58, 59, 33, 63, 12310, 12311, 46, 46,
+			46, 46, 46, 8212, 8211, 95, 95, 40, 41, 123, 125, 12308, 12309, 12304, 12305, 12298, 12299, 12296, 12297, 12300, 12301, 12302, 12303, 91,
+			93, 32, 773, 32, 773, 32, 773, 32, 773, 95, 95, 95, 44, 12289, 46, 59, 58, 63, 33, 8212, 40, 41, 123, 125,
+			12308, 12309, 35, 38, 42, 43, 45, 60, 62, 61, 92, 36, 37, 64, 32, 1611, 1600, 1611, 32, 1612, 32, 1613, 32, 1614,
+			1600, 1614, 32, 1615, 1600, 1615, 32, 1616, 1600, 1616, 32, 1617, 1600, 1617, 32, 1618, 1600, 1618, 1569, 1575, 1619, 1575, 1619, 1575,
+			1620, 1575, 1620, 1608, 1620, 1608, 1620, 1575, 1621, 1575, 1621, 1610, 1620, 1610, 1620, 1610, 1620, 1610, 1620, 1575, 1575, 1576, 1576, 1576,
+			1576, 1577, 1577, 1578, 1578, 1578, 1578, 1579, 1579, 1579, 1579, 1580, 1580, 1580, 1580, 1581, 1581, 1581, 1581, 1582, 1582, 1582, 1582, 1583,
+			1583, 1584, 1584, 1585, 1585, 1586, 1586, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1589, 1589, 1589, 1589, 1590, 1590, 1590, 1590, 1591,
+			1591, 1591, 1591, 1592, 1592, 1592, 1592, 1593, 1593, 1593, 1593, 1594, 1594, 1594, 1594, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1603,
+			1603, 1603, 1603, 1604, 1604, 1604, 1604, 1605, 1605, 1605, 1605, 1606, 1606, 1606, 1606, 1607, 1607, 1607, 1607, 1608, 1608, 1609, 1609, 1610,
+			1610, 1610, 1610, 1604, 1575, 1619, 1604, 1575, 1619, 1604, 1575, 1620, 1604, 1575, 1620, 1604, 1575, 1621, 1604, 1575, 1621, 1604, 1575, 1604,
+			1575, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+			56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+			80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+			104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 10629,
+			10630, 12290, 12300, 12301, 12289, 12539, 12530, 12449, 12451, 12453, 12455, 12457, 12515, 12517, 12519, 12483, 12540, 12450, 12452, 12454, 12456, 12458, 12459, 12461,
+			12463, 12465, 12467, 12469, 12471, 12473, 12475, 12477, 12479, 12481, 12484, 12486, 12488, 12490, 12491, 12492, 12493, 12494, 12495, 12498, 12501, 12504, 12507, 12510,
+			12511, 12512, 12513, 12514, 12516, 12518, 12520, 12521, 12522, 12523, 12524, 12525, 12527, 12531, 12441, 12442, 4448, 4352, 4353, 4522, 4354, 4524, 4525, 4355,
+			4356, 4357, 4528, 4529, 4530, 4531, 4532, 4533, 4378, 4358, 4359, 4360, 4385, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449,
+			4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 162, 163, 172, 32,
+			772, 166, 165, 8361, 9474, 8592, 8593, 8594, 8595, 9632, 9675, 720, 721, 230, 665, 595, 675, 43878, 677, 676, 598, 599, 7569, 600,
+			606, 681, 612, 610, 608, 667, 295, 668, 615, 644, 682, 683, 620, 122628, 42894, 622, 122629, 654, 122630, 248, 630, 631, 113, 634,
+			122632, 637, 638, 640, 680, 678, 43879, 679, 648, 11377, 655, 673, 674, 664, 448, 449, 450, 122634, 122654, 65, 66, 67, 68, 69,
+			70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99,
+			100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65,
+			66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+			90, 97, 98, 99, 100, 101, 102, 103, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+			121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+			87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+			117, 118, 119, 120, 121, 122, 65, 67, 68, 71, 74, 75, 78, 79, 80, 81, 83, 84, 85, 86, 87, 88, 89, 90,
+			97, 98, 99, 100, 102, 104, 105, 106, 107, 108, 109, 110, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65,
+			66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+			90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+			120, 121, 122, 65, 66, 68, 69, 70, 71, 74, 75, 76, 77, 78, 79, 80, 81, 83, 84, 85, 86, 87, 88, 89,
+			97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+			121, 122, 65, 66, 68, 69, 70, 71, 73, 74, 75, 76, 77, 79, 83, 84, 85, 86, 87, 88, 89, 97, 98, 99,
+			100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65,
+			66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+			90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+			120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+			86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+			116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+			82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+			112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+			78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+			108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+			74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103,
+			104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69,
+			70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99,
+			100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 305,
+			567, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 920, 931, 932, 933, 934, 935,
+			936, 937, 8711, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965,
+			966, 967, 968, 969, 8706, 949, 952, 954, 966, 961, 960, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925,
+			926, 927, 928, 929, 920, 931, 932, 933, 934, 935, 936, 937, 8711, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955,
+			956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 8706, 949, 952, 954, 966, 961, 960, 913, 914, 915,
+			916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 920, 931, 932, 933, 934, 935, 936, 937, 8711, 945,
+			946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969,
+			8706, 949, 952, 954, 966, 961, 960, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929,
+			920, 931, 932, 933, 934, 935, 936, 937, 8711, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959,
+			960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 8706, 949, 952, 954, 966, 961, 960, 913, 914, 915, 916, 917, 918, 919,
+			920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 920, 931, 932, 933, 934, 935, 936, 937, 8711, 945, 946, 947, 948, 949,
+			950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 8706, 949, 952, 954,
+			966, 961, 960, 988, 989, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 48, 49, 50, 51, 52, 53, 54, 55, 56,
+			57, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 48, 49, 50,
+			51, 52, 53, 54, 55, 56, 57, 1575, 1576, 1580, 1583, 1608, 1586, 1581, 1591, 1610, 1603, 1604, 1605, 1606, 1587, 1593, 1601, 1589,
+			1602, 1585, 1588, 1578, 1579, 1582, 1584, 1590, 1592, 1594, 1646, 1722, 1697, 1647, 1576, 1580, 1607, 1581, 1610, 1603, 1604, 1605, 1606, 1587,
+			1593, 1601, 1589, 1602, 1588, 1578, 1579, 1582, 1590, 1594, 1580, 1581, 1610, 1604, 1606, 1587, 1593, 1589, 1602, 1588, 1582, 1590, 1594, 1722,
+			1647, 1576, 1580, 1607, 1581, 1591, 1610, 1603, 1605, 1606, 1587, 1593, 1601, 1589, 1602, 1588, 1578, 1579, 1582, 1590, 1592, 1594, 1646, 1697,
+			1575, 1576, 1580, 1583, 1607, 1608, 1586, 1581, 1591, 1610, 1604, 1605, 1606, 1587, 1593, 1601, 1589, 1602, 1585, 1588, 1578, 1579, 1582, 1584,
+			1590, 1592, 1594, 1576, 1580, 1583, 1608, 1586, 1581, 1591, 1610, 1604, 1605, 1606, 1587, 1593, 1601, 1589, 1602, 1585, 1588, 1578, 1579, 1582,
+			1584, 1590, 1592, 1594, 48, 46, 48, 44, 49, 44, 50, 44, 51, 44, 52, 44, 53, 44, 54, 44, 55, 44, 56, 44,
+			57, 44, 40, 65, 41, 40, 66, 41, 40, 67, 41, 40, 68, 41, 40, 69, 41, 40, 70, 41, 40, 71, 41, 40,
+			72, 41, 40, 73, 41, 40, 74, 41, 40, 75, 41, 40, 76, 41, 40, 77, 41, 40, 78, 41, 40, 79, 41, 40,
+			80, 41, 40, 81, 41, 40, 82, 41, 40, 83, 41, 40, 84, 41, 40, 85, 41, 40, 86, 41, 40, 87, 41, 40,
+			88, 41, 40, 89, 41, 40, 90, 41, 12308, 83, 12309, 67, 82, 67, 68, 87, 90, 65, 66, 67, 68, 69, 70, 71,
+			72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 72, 86, 77, 86, 83,
+			68, 83, 83, 80, 80, 86, 87, 67, 77, 67, 77, 68, 77, 82, 68, 74, 12411, 12363, 12467, 12467, 12469, 25163, 23383, 21452,
+			12486, 12441, 20108, 22810, 35299, 22825, 20132, 26144, 28961, 26009, 21069, 24460, 20877, 26032, 21021, 32066, 29983, 36009, 22768, 21561, 28436, 25237, 25429, 19968,
+			19977, 36938, 24038, 20013, 21491, 25351, 36208, 25171, 31105, 31354, 21512, 28288, 26377, 26376, 30003, 21106, 21942, 37197, 12308, 26412, 12309, 12308, 19977, 12309,
+			12308, 20108, 12309, 12308, 23433, 12309, 12308, 28857, 12309, 12308, 25171, 12309, 12308, 30423, 12309, 12308, 21213, 12309, 12308, 25943, 12309, 24471, 21487, 48,
+			49, 50, 51, 52, 53, 54, 55, 56, 57,
+		};
+
+		// Primary composites except Hangul: first << 42 | second << 21 | composite
+		inline constexpr uint64_t compositions[941] = {
+			0x0000F0006700226E, 0x0000F40067002260, 0x0000F8006700226F, 0x00010400600000C0,
+			0x00010400602000C1, 0x00010400604000C2, 0x00010400606000C3, 0x0001040060800100,
+			0x0001040060C00102, 0x0001040060E00226, 0x00010400610000C4, 0x0001040061201EA2,
+			0x00010400614000C5, 0x00010400618001CD, 0x0001040061E00200, 0x0001040062200202,
+			0x0001040064601EA0, 0x0001040064A01E00, 0x0001040065000104, 0x0001080060E01E02,
+			0x0001080064601E04, 0x0001080066201E06, 0x00010C0060200106, 0x00010C0060400108,
+			0x00010C0060E0010A, 0x00010C006180010C, 0x00010C0064E000C7, 0x0001100060E01E0A,
+			0x000110006180010E, 0x0001100064601E0C, 0x0001100064E01E10, 0x0001100065A01E12,
+			0x0001100066201E0E, 0x00011400600000C8, 0x00011400602000C9, 0x00011400604000CA,
+			0x0001140060601EBC, 0x0001140060800112, 0x0001140060C00114, 0x0001140060E00116,
+			0x00011400610000CB, 0x0001140061201EBA, 0x000114006180011A, 0x0001140061E00204,
+			0x0001140062200206, 0x0001140064601EB8, 0x0001140064E00228, 0x0001140065000118,
+			0x0001140065A01E18, 0x0001140066001E1A, 0x0001180060E01E1E, 0x00011C00602001F4,
+			0x00011C006040011C, 0x00011C0060801E20, 0x00011C0060C0011E, 0x00011C0060E00120,
+			0x00011C00618001E6, 0x00011C0064E00122, 0x0001200060400124, 0x0001200060E01E22,
+			0x0001200061001E26, 0x000120006180021E, 0x0001200064601E24, 0x0001200064E01E28,
+			0x0001200065C01E2A, 0x00012400600000CC, 0x00012400602000CD, 0x00012400604000CE,
+			0x0001240060600128, 0x000124006080012A, 0x0001240060C0012C, 0x0001240060E00130,
+			0x00012400610000CF, 0x0001240061201EC8, 0x00012400618001CF, 0x0001240061E00208,
+			0x000124006220020A, 0x0001240064601ECA, 0x000124006500012E, 0x0001240066001E2C,
+			0x0001280060400134, 0x00012C0060201E30, 0x00012C00618001E8, 0x00012C0064601E32,
+			0x00012C0064E00136, 0x00012C0066201E34, 0x0001300060200139, 0x000130006180013D,
+			0x0001300064601E36, 0x0001300064E0013B, 0x0001300065A01E3C, 0x0001300066201E3A,
+			0x0001340060201E3E, 0x0001340060E01E40, 0x0001340064601E42, 0x00013800600001F8,
+			0x0001380060200143, 0x00013800606000D1, 0x0001380060E01E44, 0x0001380061800147,
+			0x0001380064601E46, 0x0001380064E00145, 0x0001380065A01E4A, 0x0001380066201E48,
+			0x00013C00600000D2, 0x00013C00602000D3, 0x00013C00604000D4, 0x00013C00606000D5,
+			0x00013C006080014C, 0x00013C0060C0014E, 0x00013C0060E0022E, 0x00013C00610000D6,
+			0x00013C0061201ECE, 0x00013C0061600150, 0x00013C00618001D1, 0x00013C0061E0020C,
+			0x00013C006220020E, 0x00013C00636001A0, 0x00013C0064601ECC, 0x00013C00650001EA,
+			0x0001400060201E54, 0x0001400060E01E56, 0x0001480060200154, 0x0001480060E01E58,
+			0x0001480061800158, 0x0001480061E00210, 0x0001480062200212, 0x0001480064601E5A,
+			0x0001480064E00156, 0x0001480066201E5E, 0x00014C006020015A, 0x00014C006040015C,
+			0x00014C0060E01E60, 0x00014C0061800160, 0x00014C0064601E62, 0x00014C0064C00218,
+			0x00014C0064E0015E, 0x0001500060E01E6A, 0x0001500061800164, 0x0001500064601E6C,
+			0x0001500064C0021A, 0x0001500064E00162, 0x0001500065A01E70, 0x0001500066201E6E,
+			0x00015400600000D9, 0x00015400602000DA, 0x00015400604000DB, 0x0001540060600168,
+			0x000154006080016A, 0x0001540060C0016C, 0x00015400610000DC, 0x0001540061201EE6,
+			0x000154006140016E, 0x0001540061600170, 0x00015400618001D3, 0x0001540061E00214,
+			0x0001540062200216, 0x00015400636001AF, 0x0001540064601EE4, 0x0001540064801E72,
+			0x0001540065000172, 0x0001540065A01E76, 0x0001540066001E74, 0x0001580060601E7C,
+			0x0001580064601E7E, 0x00015C0060001E80, 0x00015C0060201E82, 0x00015C0060400174,
+			0x00015C0060E01E86, 0x00015C0061001E84, 0x00015C0064601E88, 0x0001600060E01E8A,
+			0x0001600061001E8C, 0x0001640060001EF2, 0x00016400602000DD, 0x0001640060400176,
+			0x0001640060601EF8, 0x0001640060800232, 0x0001640060E01E8E, 0x0001640061000178,
+			0x0001640061201EF6, 0x0001640064601EF4, 0x0001680060200179, 0x0001680060401E90,
+			0x0001680060E0017B, 0x000168006180017D, 0x0001680064601E92, 0x0001680066201E94,
+			0x00018400600000E0, 0x00018400602000E1, 0x00018400604000E2, 0x00018400606000E3,
+			0x0001840060800101, 0x0001840060C00103, 0x0001840060E00227, 0x00018400610000E4,
+			0x0001840061201EA3, 0x00018400614000E5, 0x00018400618001CE, 0x0001840061E00201,
+			0x0001840062200203, 0x0001840064601EA1, 0x0001840064A01E01, 0x0001840065000105,
+			0x0001880060E01E03, 0x0001880064601E05, 0x0001880066201E07, 0x00018C0060200107,
+			0x00018C0060400109, 0x00018C0060E0010B, 0x00018C006180010D, 0x00018C0064E000E7,
+			0x0001900060E01E0B, 0x000190006180010F, 0x0001900064601E0D, 0x0001900064E01E11,
+			0x0001900065A01E13, 0x0001900066201E0F, 0x00019400600000E8, 0x00019400602000E9,
+			0x00019400604000EA, 0x0001940060601EBD, 0x0001940060800113, 0x0001940060C00115,
+			0x0001940060E00117, 0x00019400610000EB, 0x0001940061201EBB, 0x000194006180011B,
+			0x0001940061E00205, 0x0001940062200207, 0x0001940064601EB9, 0x0001940064E00229,
+			0x0001940065000119, 0x0001940065A01E19, 0x0001940066001E1B, 0x0001980060E01E1F,
+			0x00019C00602001F5, 0x00019C006040011D, 0x00019C0060801E21, 0x00019C0060C0011F,
+			0x00019C0060E00121, 0x00019C00618001E7, 0x00019C0064E00123, 0x0001A00060400125,
+			0x0001A00060E01E23, 0x0001A00061001E27, 0x0001A0006180021F, 0x0001A00064601E25,
+			0x0001A00064E01E29, 0x0001A00065C01E2B, 0x0001A00066201E96, 0x0001A400600000EC,
+			0x0001A400602000ED, 0x0001A400604000EE, 0x0001A40060600129, 0x0001A4006080012B,
+			0x0001A40060C0012D, 0x0001A400610000EF, 0x0001A40061201EC9, 0x0001A400618001D0,
+			0x0001A40061E00209, 0x0001A4006220020B, 0x0001A40064601ECB, 0x0001A4006500012F,
+			0x0001A40066001E2D, 0x0001A80060400135, 0x0001A800618001F0, 0x0001AC0060201E31,
+			0x0001AC00618001E9, 0x0001AC0064601E33, 0x0001AC0064E00137, 0x0001AC0066201E35,
+			0x0001B0006020013A, 0x0001B0006180013E, 0x0001B00064601E37, 0x0001B00064E0013C,
+			0x0001B00065A01E3D, 0x0001B00066201E3B, 0x0001B40060201E3F, 0x0001B40060E01E41,
+			0x0001B40064601E43, 0x0001B800600001F9, 0x0001B80060200144, 0x0001B800606000F1,
+			0x0001B80060E01E45, 0x0001B80061800148, 0x0001B80064601E47, 0x0001B80064E00146,
+			0x0001B80065A01E4B, 0x0001B80066201E49, 0x0001BC00600000F2, 0x0001BC00602000F3,
+			0x0001BC00604000F4, 0x0001BC00606000F5, 0x0001BC006080014D, 0x0001BC0060C0014F,
+			0x0001BC0060E0022F, 0x0001BC00610000F6, 0x0001BC0061201ECF, 0x0001BC0061600151,
+			0x0001BC00618001D2, 0x0001BC0061E0020D, 0x0001BC006220020F, 0x0001BC00636001A1,
+			0x0001BC0064601ECD, 0x0001BC00650001EB, 0x0001C00060201E55, 0x0001C00060E01E57,
+			0x0001C80060200155, 0x0001C80060E01E59, 0x0001C80061800159, 0x0001C80061E00211,
+			0x0001C80062200213, 0x0001C80064601E5B, 0x0001C80064E00157, 0x0001C80066201E5F,
+			0x0001CC006020015B, 0x0001CC006040015D, 0x0001CC0060E01E61, 0x0001CC0061800161,
+			0x0001CC0064601E63, 0x0001CC0064C00219, 0x0001CC0064E0015F, 0x0001D00060E01E6B,
+			0x0001D00061001E97, 0x0001D00061800165, 0x0001D00064601E6D, 0x0001D00064C0021B,
+			0x0001D00064E00163, 0x0001D00065A01E71, 0x0001D00066201E6F, 0x0001D400600000F9,
+			0x0001D400602000FA, 0x0001D400604000FB, 0x0001D40060600169, 0x0001D4006080016B,
+			0x0001D40060C0016D, 0x0001D400610000FC, 0x0001D40061201EE7, 0x0001D4006140016F,
+			0x0001D40061600171, 0x0001D400618001D4, 0x0001D40061E00215, 0x0001D40062200217,
+			0x0001D400636001B0, 0x0001D40064601EE5, 0x0001D40064801E73, 0x0001D40065000173,
+			0x0001D40065A01E77, 0x0001D40066001E75, 0x0001D80060601E7D, 0x0001D80064601E7F,
+			0x0001DC0060001E81, 0x0001DC0060201E83, 0x0001DC0060400175, 0x0001DC0060E01E87,
+			0x0001DC0061001E85, 0x0001DC0061401E98, 0x0001DC0064601E89, 0x0001E00060E01E8B,
+			0x0001E00061001E8D, 0x0001E40060001EF3, 0x0001E400602000FD, 0x0001E40060400177,
+			0x0001E40060601EF9, 0x0001E40060800233, 0x0001E40060E01E8F, 0x0001E400610000FF,
+			0x0001E40061201EF7, 0x0001E40061401E99, 0x0001E40064601EF5, 0x0001E8006020017A,
+			0x0001E80060401E91, 0x0001E80060E0017C, 0x0001E8006180017E, 0x0001E80064601E93,
+			0x0001E80066201E95, 0x0002A00060001FED, 0x0002A00060200385, 0x0002A00068401FC1,
+			0x0003080060001EA6, 0x0003080060201EA4, 0x0003080060601EAA, 0x0003080061201EA8,
+			0x00031000608001DE, 0x00031400602001FA, 0x00031800602001FC, 0x00031800608001E2,
+			0x00031C0060201E08, 0x0003280060001EC0, 0x0003280060201EBE, 0x0003280060601EC4,
+			0x0003280061201EC2, 0x00033C0060201E2E, 0x0003500060001ED2, 0x0003500060201ED0,
+			0x0003500060601ED6, 0x0003500061201ED4, 0x0003540060201E4C, 0x000354006080022C,
+			0x0003540061001E4E, 0x000358006080022A, 0x00036000602001FE, 0x00037000600001DB,
+			0x00037000602001D7, 0x00037000608001D5, 0x00037000618001D9, 0x0003880060001EA7,
+			0x0003880060201EA5, 0x0003880060601EAB, 0x0003880061201EA9, 0x00039000608001DF,
+			0x00039400602001FB, 0x00039800602001FD, 0x00039800608001E3, 0x00039C0060201E09,
+			0x0003A80060001EC1, 0x0003A80060201EBF, 0x0003A80060601EC5, 0x0003A80061201EC3,
+			0x0003BC0060201E2F, 0x0003D00060001ED3, 0x0003D00060201ED1, 0x0003D00060601ED7,
+			0x0003D00061201ED5, 0x0003D40060201E4D, 0x0003D4006080022D, 0x0003D40061001E4F,
+			0x0003D8006080022B, 0x0003E000602001FF, 0x0003F000600001DC, 0x0003F000602001D8,
+			0x0003F000608001D6, 0x0003F000618001DA, 0x0004080060001EB0, 0x0004080060201EAE,
+			0x0004080060601EB4, 0x0004080061201EB2, 0x00040C0060001EB1, 0x00040C0060201EAF,
+			0x00040C0060601EB5, 0x00040C0061201EB3, 0x0004480060001E14, 0x0004480060201E16,
+			0x00044C0060001E15, 0x00044C0060201E17, 0x0005300060001E50, 0x0005300060201E52,
+			0x0005340060001E51, 0x0005340060201E53, 0x0005680060E01E64, 0x00056C0060E01E65,
+			0x0005800060E01E66, 0x0005840060E01E67, 0x0005A00060201E78, 0x0005A40060201E79,
+			0x0005A80061001E7A, 0x0005AC0061001E7B, 0x0005FC0060E01E9B, 0x0006800060001EDC,
+			0x0006800060201EDA, 0x0006800060601EE0, 0x0006800061201EDE, 0x0006800064601EE2,
+			0x0006840060001EDD, 0x0006840060201EDB, 0x0006840060601EE1, 0x0006840061201EDF,
+			0x0006840064601EE3, 0x0006BC0060001EEA, 0x0006BC0060201EE8, 0x0006BC0060601EEE,
+			0x0006BC0061201EEC, 0x0006BC0064601EF0, 0x0006C00060001EEB, 0x0006C00060201EE9,
+			0x0006C00060601EEF, 0x0006C00061201EED, 0x0006C00064601EF1, 0x0006DC00618001EE,
+			0x0007A800608001EC, 0x0007AC00608001ED, 0x00089800608001E0, 0x00089C00608001E1,
+			0x0008A00060C01E1C, 0x0008A40060C01E1D, 0x0008B80060800230, 0x0008BC0060800231,
+			0x000A4800618001EF, 0x000E440060001FBA, 0x000E440060200386, 0x000E440060801FB9,
+			0x000E440060C01FB8, 0x000E440062601F08, 0x000E440062801F09, 0x000E440068A01FBC,
+			0x000E540060001FC8, 0x000E540060200388, 0x000E540062601F18, 0x000E540062801F19,
+			0x000E5C0060001FCA, 0x000E5C0060200389, 0x000E5C0062601F28, 0x000E5C0062801F29,
+			0x000E5C0068A01FCC, 0x000E640060001FDA, 0x000E64006020038A, 0x000E640060801FD9,
+			0x000E640060C01FD8, 0x000E6400610003AA, 0x000E640062601F38, 0x000E640062801F39,
+			0x000E7C0060001FF8, 0x000E7C006020038C, 0x000E7C0062601F48, 0x000E7C0062801F49,
+			0x000E840062801FEC, 0x000E940060001FEA, 0x000E94006020038E, 0x000E940060801FE9,
+			0x000E940060C01FE8, 0x000E9400610003AB, 0x000E940062801F59, 0x000EA40060001FFA,
+			0x000EA4006020038F, 0x000EA40062601F68, 0x000EA40062801F69, 0x000EA40068A01FFC,
+			0x000EB00068A01FB4, 0x000EB80068A01FC4, 0x000EC40060001F70, 0x000EC400602003AC,
+			0x000EC40060801FB1, 0x000EC40060C01FB0, 0x000EC40062601F00, 0x000EC40062801F01,
+			0x000EC40068401FB6, 0x000EC40068A01FB3, 0x000ED40060001F72, 0x000ED400602003AD,
+			0x000ED40062601F10, 0x000ED40062801F11, 0x000EDC0060001F74, 0x000EDC00602003AE,
+			0x000EDC0062601F20, 0x000EDC0062801F21, 0x000EDC0068401FC6, 0x000EDC0068A01FC3,
+			0x000EE40060001F76, 0x000EE400602003AF, 0x000EE40060801FD1, 0x000EE40060C01FD0,
+			0x000EE400610003CA, 0x000EE40062601F30, 0x000EE40062801F31, 0x000EE40068401FD6,
+			0x000EFC0060001F78, 0x000EFC00602003CC, 0x000EFC0062601F40, 0x000EFC0062801F41,
+			0x000F040062601FE4, 0x000F040062801FE5, 0x000F140060001F7A, 0x000F1400602003CD,
+			0x000F140060801FE1, 0x000F140060C01FE0, 0x000F1400610003CB, 0x000F140062601F50,
+			0x000F140062801F51, 0x000F140068401FE6, 0x000F240060001F7C, 0x000F2400602003CE,
+			0x000F240062601F60, 0x000F240062801F61, 0x000F240068401FF6, 0x000F240068A01FF3,
+			0x000F280060001FD2, 0x000F280060200390, 0x000F280068401FD7, 0x000F2C0060001FE2,
+			0x000F2C00602003B0, 0x000F2C0068401FE7, 0x000F380068A01FF4, 0x000F4800602003D3,
+			0x000F4800610003D4, 0x0010180061000407, 0x0010400060C004D0, 0x00104000610004D2,
+			0x00104C0060200403, 0x0010540060000400, 0x0010540060C004D6, 0x0010540061000401,
+			0x0010580060C004C1, 0x00105800610004DC, 0x00105C00610004DE, 0x001060006000040D,
+			0x00106000608004E2, 0x0010600060C00419, 0x00106000610004E4, 0x001068006020040C,
+			0x00107800610004E6, 0x00108C00608004EE, 0x00108C0060C0040E, 0x00108C00610004F0,
+			0x00108C00616004F2, 0x00109C00610004F4, 0x0010AC00610004F8, 0x0010B400610004EC,
+			0x0010C00060C004D1, 0x0010C000610004D3, 0x0010CC0060200453, 0x0010D40060000450,
+			0x0010D40060C004D7, 0x0010D40061000451, 0x0010D80060C004C2, 0x0010D800610004DD,
+			0x0010DC00610004DF, 0x0010E0006000045D, 0x0010E000608004E3, 0x0010E00060C00439,
+			0x0010E000610004E5, 0x0010E8006020045C, 0x0010F800610004E7, 0x00110C00608004EF,
+			0x00110C0060C0045E, 0x00110C00610004F1, 0x00110C00616004F3, 0x00111C00610004F5,
+			0x00112C00610004F9, 0x00113400610004ED, 0x0011580061000457, 0x0011D00061E00476,
+			0x0011D40061E00477, 0x00136000610004DA, 0x00136400610004DB, 0x0013A000610004EA,
+			0x0013A400610004EB, 0x00189C00CA600622, 0x00189C00CA800623, 0x00189C00CAA00625,
+			0x00192000CA800624, 0x00192800CA800626, 0x001B0400CA8006C2, 0x001B4800CA8006D3,
+			0x001B5400CA8006C0, 0x0024A00127800929, 0x0024C00127800931, 0x0024CC0127800934,
+			0x00271C0137C009CB, 0x00271C013AE009CC, 0x002D1C0167C00B4B, 0x002D1C016AC00B48,
+			0x002D1C016AE00B4C, 0x002E48017AE00B94, 0x002F180177C00BCA, 0x002F18017AE00BCC,
+			0x002F1C0177C00BCB, 0x003118018AC00C48, 0x0032FC019AA00CC0, 0x0033180198400CCA,
+			0x003318019AA00CC7, 0x003318019AC00CC8, 0x003328019AA00CCB, 0x00351801A7C00D4A,
+			0x00351801AAE00D4C, 0x00351C01A7C00D4B, 0x00376401B9400DDA, 0x00376401B9E00DDC,
+			0x00376401BBE00DDE, 0x00377001B9400DDD, 0x0040940205C01026, 0x006C140366A01B06,
+			0x006C1C0366A01B08, 0x006C240366A01B0A, 0x006C2C0366A01B0C, 0x006C340366A01B0E,
+			0x006C440366A01B12, 0x006CE80366A01B3B, 0x006CF00366A01B3D, 0x006CF80366A01B40,
+			0x006CFC0366A01B41, 0x006D080366A01B43, 0x0078D80060801E38, 0x0078DC0060801E39,
+			0x0079680060801E5C, 0x00796C0060801E5D, 0x0079880060E01E68, 0x00798C0060E01E69,
+			0x007A800060401EAC, 0x007A800060C01EB6, 0x007A840060401EAD, 0x007A840060C01EB7,
+			0x007AE00060401EC6, 0x007AE40060401EC7, 0x007B300060401ED8, 0x007B340060401ED9,
+			0x007C000060001F02, 0x007C000060201F04, 0x007C000068401F06, 0x007C000068A01F80,
+			0x007C040060001F03, 0x007C040060201F05, 0x007C040068401F07, 0x007C040068A01F81,
+			0x007C080068A01F82, 0x007C0C0068A01F83, 0x007C100068A01F84, 0x007C140068A01F85,
+			0x007C180068A01F86, 0x007C1C0068A01F87, 0x007C200060001F0A, 0x007C200060201F0C,
+			0x007C200068401F0E, 0x007C200068A01F88, 0x007C240060001F0B, 0x007C240060201F0D,
+			0x007C240068401F0F, 0x007C240068A01F89, 0x007C280068A01F8A, 0x007C2C0068A01F8B,
+			0x007C300068A01F8C, 0x007C340068A01F8D, 0x007C380068A01F8E, 0x007C3C0068A01F8F,
+			0x007C400060001F12, 0x007C400060201F14, 0x007C440060001F13, 0x007C440060201F15,
+			0x007C600060001F1A, 0x007C600060201F1C, 0x007C640060001F1B, 0x007C640060201F1D,
+			0x007C800060001F22, 0x007C800060201F24, 0x007C800068401F26, 0x007C800068A01F90,
+			0x007C840060001F23, 0x007C840060201F25, 0x007C840068401F27, 0x007C840068A01F91,
+			0x007C880068A01F92, 0x007C8C0068A01F93, 0x007C900068A01F94, 0x007C940068A01F95,
+			0x007C980068A01F96, 0x007C9C0068A01F97, 0x007CA00060001F2A, 0x007CA00060201F2C,
+			0x007CA00068401F2E, 0x007CA00068A01F98, 0x007CA40060001F2B, 0x007CA40060201F2D,
+			0x007CA40068401F2F, 0x007CA40068A01F99, 0x007CA80068A01F9A, 0x007CAC0068A01F9B,
+			0x007CB00068A01F9C, 0x007CB40068A01F9D, 0x007CB80068A01F9E, 0x007CBC0068A01F9F,
+			0x007CC00060001F32, 0x007CC00060201F34, 0x007CC00068401F36, 0x007CC40060001F33,
+			0x007CC40060201F35, 0x007CC40068401F37, 0x007CE00060001F3A, 0x007CE00060201F3C,
+			0x007CE00068401F3E, 0x007CE40060001F3B, 0x007CE40060201F3D, 0x007CE40068401F3F,
+			0x007D000060001F42, 0x007D000060201F44, 0x007D040060001F43, 0x007D040060201F45,
+			0x007D200060001F4A, 0x007D200060201F4C, 0x007D240060001F4B, 0x007D240060201F4D,
+			0x007D400060001F52, 0x007D400060201F54, 0x007D400068401F56, 0x007D440060001F53,
+			0x007D440060201F55, 0x007D440068401F57, 0x007D640060001F5B, 0x007D640060201F5D,
+			0x007D640068401F5F, 0x007D800060001F62, 0x007D800060201F64, 0x007D800068401F66,
+			0x007D800068A01FA0, 0x007D840060001F63, 0x007D840060201F65, 0x007D840068401F67,
+			0x007D840068A01FA1, 0x007D880068A01FA2, 0x007D8C0068A01FA3, 0x007D900068A01FA4,
+			0x007D940068A01FA5, 0x007D980068A01FA6, 0x007D9C0068A01FA7, 0x007DA00060001F6A,
+			0x007DA00060201F6C, 0x007DA00068401F6E, 0x007DA00068A01FA8, 0x007DA40060001F6B,
+			0x007DA40060201F6D, 0x007DA40068401F6F, 0x007DA40068A01FA9, 0x007DA80068A01FAA,
+			0x007DAC0068A01FAB, 0x007DB00068A01FAC, 0x007DB40068A01FAD, 0x007DB80068A01FAE,
+			0x007DBC0068A01FAF, 0x007DC00068A01FB2, 0x007DD00068A01FC2, 0x007DF00068A01FF2,
+			0x007ED80068A01FB7, 0x007EFC0060001FCD, 0x007EFC0060201FCE, 0x007EFC0068401FCF,
+			0x007F180068A01FC7, 0x007FD80068A01FF7, 0x007FF80060001FDD, 0x007FF80060201FDE,
+			0x007FF80068401FDF, 0x008640006700219A, 0x008648006700219B, 0x00865000670021AE,
+			0x00874000670021CD, 0x00874800670021CF, 0x00875000670021CE, 0x00880C0067002204,
+			0x0088200067002209, 0x00882C006700220C, 0x00888C0067002224, 0x0088940067002226,
+			0x0088F00067002241, 0x00890C0067002244, 0x0089140067002247, 0x0089200067002249,
+			0x008934006700226D, 0x0089840067002262, 0x0089900067002270, 0x0089940067002271,
+			0x0089C80067002274, 0x0089CC0067002275, 0x0089D80067002278, 0x0089DC0067002279,
+			0x0089E80067002280, 0x0089EC0067002281, 0x0089F000670022E0, 0x0089F400670022E1,
+			0x008A080067002284, 0x008A0C0067002285, 0x008A180067002288, 0x008A1C0067002289,
+			0x008A4400670022E2, 0x008A4800670022E3, 0x008A8800670022AC, 0x008AA000670022AD,
+			0x008AA400670022AE, 0x008AAC00670022AF, 0x008AC800670022EA, 0x008ACC00670022EB,
+			0x008AD000670022EC, 0x008AD400670022ED, 0x00C1180613203094, 0x00C12C061320304C,
+			0x00C134061320304E, 0x00C13C0613203050, 0x00C1440613203052, 0x00C14C0613203054,
+			0x00C1540613203056, 0x00C15C0613203058, 0x00C164061320305A, 0x00C16C061320305C,
+			0x00C174061320305E, 0x00C17C0613203060, 0x00C1840613203062, 0x00C1900613203065,
+			0x00C1980613203067, 0x00C1A00613203069, 0x00C1BC0613203070, 0x00C1BC0613403071,
+			0x00C1C80613203073, 0x00C1C80613403074, 0x00C1D40613203076, 0x00C1D40613403077,
+			0x00C1E00613203079, 0x00C1E0061340307A, 0x00C1EC061320307C, 0x00C1EC061340307D,
+			0x00C274061320309E, 0x00C29806132030F4, 0x00C2AC06132030AC, 0x00C2B406132030AE,
+			0x00C2BC06132030B0, 0x00C2C406132030B2, 0x00C2CC06132030B4, 0x00C2D406132030B6,
+			0x00C2DC06132030B8, 0x00C2E406132030BA, 0x00C2EC06132030BC, 0x00C2F406132030BE,
+			0x00C2FC06132030C0, 0x00C30406132030C2, 0x00C31006132030C5, 0x00C31806132030C7,
+			0x00C32006132030C9, 0x00C33C06132030D0, 0x00C33C06134030D1, 0x00C34806132030D3,
+			0x00C34806134030D4, 0x00C35406132030D6, 0x00C35406134030D7, 0x00C36006132030D9,
+			0x00C36006134030DA, 0x00C36C06132030DC, 0x00C36C06134030DD, 0x00C3BC06132030F7,
+			0x00C3C006132030F8, 0x00C3C406132030F9, 0x00C3C806132030FA, 0x00C3F406132030FE,
+			0x044264221741109A, 0x04426C221741109C, 0x04429422174110AB, 0x0444C42224E1112E,
+			0x0444C82224E1112F, 0x044D1C2267C1134B, 0x044D1C226AE1134C, 0x0452E422960114BC,
+			0x0452E422974114BB, 0x0452E42297A114BE, 0x0456E022B5E115BA, 0x0456E422B5E115BB,
+			0x0464D42326011938,
+		};
+
+		// Canonical combining class | NormalizationFlag << 8 of cp
+		inline uint16_t normalization_info(char32_t cp) {
+			if (cp >= normalization_limit) return 0;
+			return normalization_properties[normalization_indexes[normalization_blocks[cp >> 6] * 64 + (cp & 63)]];
+		}
+
+		inline uint8_t combining_class(char32_t cp) {
+			return static_cast<uint8_t>(normalization_info(cp));
+		}
+
+		// Index of the first entry whose value >> shift is not below key
+		inline size_t lower_bound_packed(const uint64_t* entries, size_t count, uint64_t key, unsigned shift) {
+			size_t low = 0, high = count;
+			while (low < high) {
+				size_t mid = (low + high) / 2;
+				if ((entries[mid] >> shift) < key) low = mid + 1;
+				else high = mid;
+			}
+			return low;
+		}
+
+		// Full decomposition of cp (canonical, or compatibility if compat)
+		// in out, or 0 if it has none. Hangul syllables are left to the caller.
+		inline size_t decomposition(char32_t cp, bool compat, const char32_t*& out) {
+			if (compat) {
+				const size_t count = sizeof(compatibility_decompositions) / sizeof(compatibility_decompositions[0]);
+				size_t i = lower_bound_packed(compatibility_decompositions, count, cp, 32);
+				if (i < count && (compatibility_decompositions[i] >> 32) == cp) {
+					out = compatibility_pool + ((compatibility_decompositions[i] >> 8) & 0xFFFFFF);
+					return compatibility_decompositions[i] & 0xFF;
+				}
+			}
+			const size_t count = sizeof(canonical_decompositions) / sizeof(canonical_decompositions[0]);
+			size_t i = lower_bound_packed(canonical_decompositions, count, cp, 32);
+			if (i < count && (canonical_decompositions[i] >> 32) == cp) {
+				out = canonical_pool + ((canonical_decompositions[i] >> 8) & 0xFFFFFF);
+				return canonical_decompositions[i] & 0xFF;
+			}
+			return 0;
+		}
+
+		// Primary composite of first followed by second, or 0. No Hangul.
+		inline char32_t composition(char32_t first, char32_t second) {
+			const size_t count = sizeof(compositions) / sizeof(compositions[0]);
+			uint64_t key = static_cast<uint64_t>(first) << 21 | second;
+			size_t i = lower_bound_packed(compositions, count, key, 21);
+			if (i < count && (compositions[i] >> 21) == key) return static_cast<char32_t>(compositions[i] & 0x1FFFFF);
+			return 0;
+		}
+	}
+}
@@ -1,9 +1,214 @@
 ﻿#include "Modern-Text-Tokenizer.hpp"
 #include <chrono>
+#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+#ifdef MTT_ALLOC_PROFILING
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#endif
 
 using namespace std;
 using namespace MecanikDev;
 
+#ifdef MTT_ALLOC_PROFILING
+// Allocation profiling build (-DMTT_ALLOC_PROFILING=ON): global operator
+// new/delete are replaced to count heap traffic. The array, nothrow and
+// sized forms forward to these by default; over-aligned allocations are
+// not counted.
+namespace AllocationCounters
+{
+	std::atomic<uint64_t> allocations{ 0 };
+	std::atomic<uint64_t> bytes{ 0 };
+	std::atomic<uint64_t> frees{ 0 };
+}
+
+void* operator new(std::size_t size) {
+	AllocationCounters::allocations.fetch_add(1, std::memory_order_relaxed);
+	AllocationCounters::bytes.fetch_add(size, std::memory_order_relaxed);
+	if (void* p = std::malloc(size ? size : 1)) return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+	if (p) AllocationCounters::frees.fetch_add(1, std::memory_order_relaxed);
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+	::operator delete(p);
+}
+#endif
+
+// Heap traffic of a measured region; all zero unless built with
+// MTT_ALLOC_PROFILING
+struct AllocationSnapshot {
+	uint64_t allocations = 0;
+	uint64_t bytes = 0;
+	uint64_t frees = 0;
+
+	static AllocationSnapshot now() {
+		AllocationSnapshot snapshot;
+#ifdef MTT_ALLOC_PROFILING
+		snapshot.allocations = AllocationCounters::allocations.load(std::memory_order_relaxed);
+		snapshot.bytes = AllocationCounters::bytes.load(std::memory_order_relaxed);
+		snapshot.frees = AllocationCounters::frees.load(std::memory_order_relaxed);
+#endif
+		return snapshot;
+	}
+
+	AllocationSnapshot operator-(const AllocationSnapshot& earlier) const {
+		AllocationSnapshot delta;
+		delta.allocations = allocations - earlier.allocations;
+		delta.bytes = bytes - earlier.bytes;
+		delta.frees = frees - earlier.frees;
+		return delta;
+	}
+};
+
+void print_allocations(const char* region, const AllocationSnapshot& delta, size_t tokens) {
+	std::cout << "    " << std::left << std::setw(10) << region << std::right
+		<< delta.allocations << " allocations (" << std::fixed << std::setprecision(4)
+		<< static_cast<double>(delta.allocations) / tokens << "/token, " << std::setprecision(2)
+		<< static_cast<double>(delta.bytes) / tokens << " B/token), " << delta.frees << " frees" << std::endl;
+}
+
+// Hardware performance counters around a measured region (Linux
+// perf_event_open, user space only). Each counter is opened on its own so
+// that one unsupported event does not disable the rest; when none can be
+// opened (containers, perf_event_paranoid, other platforms) available()
+// is false and the harness just skips the counter report.
+class PerfCounters
+{
+public:
+	enum Event { cycles, instructions, branch_misses, l1d_misses, llc_misses, event_count };
+
+	static const char* name(int event) {
+		static const char* names[] = { "cycles", "instructions", "branch-misses", "L1D-misses", "LLC-misses" };
+		return names[event];
+	}
+
+private:
+	int fds_[event_count];
+	double values_[event_count] = {};
+	std::string error_;
+
+public:
+	PerfCounters() {
+		for (int& fd : fds_) fd = -1;
+#if defined(__linux__)
+		const uint32_t types[event_count] = {
+			PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE
+		};
+		const uint64_t configs[event_count] = {
+			PERF_COUNT_HW_CPU_CYCLES,
+			PERF_COUNT_HW_INSTRUCTIONS,
+			PERF_COUNT_HW_BRANCH_MISSES,
+			PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+			PERF_COUNT_HW_CACHE_MISSES
+		};
+
+		for (int e = 0; e < event_count; ++e) {
+			perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = types[e];
+			attr.config = configs[e];
+			attr.disabled = 1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			fds_[e] = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+			if (fds_[e] < 0 && error_.empty()) {
+				error_ = std::strerror(errno);
+			}
+		}
+#else
+		error_ = "not available on this platform";
+#endif
+	}
+
+	~PerfCounters() {
+#if defined(__linux__)
+		for (int fd : fds_) {
+			if (fd >= 0) ::close(fd);
+		}
+#endif
+	}
+
+	PerfCounters(const PerfCounters&) = delete;
+	PerfCounters& operator=(const PerfCounters&) = delete;
+
+	bool available() const {
+		for (int fd : fds_) {
+			if (fd >= 0) return true;
+		}
+		return false;
+	}
+
+	bool valid(int event) const { return fds_[event] >= 0; }
+	double value(int event) const { return values_[event]; }
+	const std::string& error() const { return error_; }
+
+	void start() {
+#if defined(__linux__)
+		for (int fd : fds_) {
+			if (fd < 0) continue;
+			::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+			::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+		}
+#endif
+	}
+
+	// Stop counting and read the values, scaled up if the kernel multiplexed
+	// the counters
+	void stop() {
+#if defined(__linux__)
+		for (int e = 0; e < event_count; ++e) {
+			values_[e] = 0;
+			if (fds_[e] < 0) continue;
+			::ioctl(fds_[e], PERF_EVENT_IOC_DISABLE, 0);
+
+			uint64_t data[3] = {};	// value, time enabled, time running
+			if (::read(fds_[e], data, sizeof(data)) == static_cast<ssize_t>(sizeof(data)) && data[2] > 0) {
+				values_[e] = static_cast<double>(data[0]) * static_cast<double>(data[1]) / static_cast<double>(data[2]);
+			}
+		}
+#endif
+	}
+};
+
+// Print the counters of one region per input byte and per token
+void print_counters(const char* region, const PerfCounters& counters, size_t bytes, size_t tokens) {
+	std::cout << "    " << std::left << std::setw(10) << region << std::right;
+	for (int e = 0; e < PerfCounters::event_count; ++e) {
+		if (!counters.valid(e)) {
+			std::cout << "  " << PerfCounters::name(e) << " n/a";
+			continue;
+		}
+		double v = counters.value(e);
+		std::cout << "  " << PerfCounters::name(e) << " " << std::fixed << std::setprecision(2)
+			<< v / bytes << "/B " << v / tokens << "/tok";
+	}
+	if (counters.valid(PerfCounters::cycles) && counters.valid(PerfCounters::instructions) &&
+		counters.value(PerfCounters::cycles) > 0) {
+		std::cout << "  IPC " << counters.value(PerfCounters::instructions) / counters.value(PerfCounters::cycles);
+	}
+	std::cout << std::endl;
+}
+
 void print_separator(const std::string& title) {
 	std::cout << "\n" << std::string(50, '=') << std::endl;
 	std::cout << "  " << title << std::endl;
@@ -180,6 +385,17 @@ void test_sequence_encoding() {
 		}
 		std::cout << std::endl;
 	}
+
+	// Limits too small for the special tokens never overflow max_length
+	bool bounded = true;
+	for (int max_length : { -5, 0, 1, 2, 3 }) {
+		auto with_specials = tokenizer.encode_sequence(test_sentences[0], max_length, true);
+		auto without_specials = tokenizer.encode_sequence(test_sentences[0], max_length, false);
+		size_t limit = static_cast<size_t>(std::max(max_length, 0));
+		bounded = bounded && with_specials.size() <= limit && without_specials.size() <= limit &&
+			(limit == 0 || with_specials.front() == tokenizer.get_cls_id());
+	}
+	std::cout << "\nmax_length -5..3: " << (bounded ? "results stay within max_length" : "OVERFLOWS max_length") << std::endl;
 }
 
 void test_performance() {
@@ -207,17 +423,32 @@ void test_performance() {
 
 	std::cout << "Performance test with " << large_text.size() << " characters" << std::endl;
 
+	// One counter set per region, so each region is measured on its own
+	PerfCounters tokenize_counters, encode_counters, decode_counters;
+
 	// Test tokenization performance
 	auto start_time = std::chrono::high_resolution_clock::now();
+	auto tokenize_allocations = AllocationSnapshot::now();
+	tokenize_counters.start();
 	auto tokens = tokenizer.tokenize(large_text);
+	tokenize_counters.stop();
+	tokenize_allocations = AllocationSnapshot::now() - tokenize_allocations;
 	auto tokenize_time = std::chrono::high_resolution_clock::now();
 
 	// Test encoding performance
+	auto encode_allocations = AllocationSnapshot::now();
+	encode_counters.start();
 	auto token_ids = tokenizer.encode(large_text);
+	encode_counters.stop();
+	encode_allocations = AllocationSnapshot::now() - encode_allocations;
 	auto encode_time = std::chrono::high_resolution_clock::now();
 
 	// Test decoding performance
+	auto decode_allocations = AllocationSnapshot::now();
+	decode_counters.start();
 	auto decoded = tokenizer.decode(token_ids);
+	decode_counters.stop();
+	decode_allocations = AllocationSnapshot::now() - decode_allocations;
 	auto decode_time = std::chrono::high_resolution_clock::now();
 
 	// Calculate durations
@@ -236,8 +467,667 @@ void test_performance() {
 
 	std::cout << "  Total time:   " << std::fixed << std::setprecision(2) << total_time_ms << " ms" << std::endl;
 	std::cout << "  Throughput:   " << std::fixed << std::setprecision(2) << throughput_mb_s << " MB/s" << std::endl;
+
+#ifdef MTT_ALLOC_PROFILING
+	std::cout << "  Heap allocations:" << std::endl;
+	print_allocations("tokenize", tokenize_allocations, tokens.size());
+	print_allocations("encode", encode_allocations, tokens.size());
+	print_allocations("decode", decode_allocations, tokens.size());
+#else
+	std::cout << "  Heap allocations: not counted (configure with -DMTT_ALLOC_PROFILING=ON)" << std::endl;
+#endif
+
+	if (!tokenize_counters.available()) {
+		std::cout << "  Hardware counters: unavailable (perf_event_open: " << tokenize_counters.error() << ")" << std::endl;
+		return;
+	}
+	std::cout << "  Hardware counters (per input byte / per token):" << std::endl;
+	print_counters("tokenize", tokenize_counters, large_text.size(), tokens.size());
+	print_counters("encode", encode_counters, large_text.size(), tokens.size());
+	print_counters("decode", decode_counters, large_text.size(), tokens.size());
+}
+
+void test_streaming_tokenization() {
+	print_separator("STREAMING TOKENIZATION TEST");
+
+	TextTokenizer tokenizer;
+	tokenizer
+		.set_lowercase(true)
+		.set_split_on_punctuation(true)
+		.set_keep_punctuation(true);
+
+	// Mixed ASCII/UTF-8 text so chunk edges land inside tokens and multibyte sequences
+	std::string text;
+	for (int i = 0; i < 200; ++i) {
+		text += "Caf\xC3\xA9 na\xC3\xAFve, \xE4\xBD\xA0\xE5\xA5\xBD\xE4\xB8\x96\xE7\x95\x8C! ";
+		text += "Streaming   tokenizers\tkeep memory constant?! \xF0\x9F\x9A\x80\n";
+	}
+
+	auto expected = tokenizer.tokenize(text);
+
+	for (size_t chunk_size : { size_t(7), size_t(64), size_t(4096) }) {
+		std::istringstream in(text);
+		std::vector<std::string> streamed;
+		bool ok = tokenizer.tokenize_stream(in, [&](const std::string& token) {
+			streamed.push_back(token);
+		}, chunk_size);
+
+		std::cout << "Chunk size " << std::setw(4) << chunk_size << ": "
+			<< streamed.size() << " tokens, "
+			<< (ok && streamed == expected ? "matches tokenize()" : "MISMATCH with tokenize()")
+			<< std::endl;
+	}
+}
+
+void test_parallel_tokenization() {
+	print_separator("PARALLEL TOKENIZATION TEST");
+
+	TextTokenizer tokenizer;
+	tokenizer
+		.set_lowercase(true)
+		.set_split_on_punctuation(true)
+		.set_keep_punctuation(true);
+
+	std::string base_text = "Parallel tokenization splits one huge buffer, \xE4\xBD\xA0\xE5\xA5\xBD! Every core helps?! ";
+	std::string large_text;
+	while (large_text.size() < 4 * 1024 * 1024) {
+		large_text += base_text;
+	}
+
+	auto start_time = std::chrono::high_resolution_clock::now();
+	auto serial = tokenizer.tokenize(large_text);
+	auto serial_time = std::chrono::high_resolution_clock::now();
+	auto parallel = tokenizer.tokenize_parallel(large_text);
+	auto parallel_time = std::chrono::high_resolution_clock::now();
+
+	auto serial_duration = std::chrono::duration_cast<std::chrono::microseconds>(serial_time - start_time);
+	auto parallel_duration = std::chrono::duration_cast<std::chrono::microseconds>(parallel_time - serial_time);
+
+	std::cout << "Input: " << large_text.size() << " bytes, "
+		<< std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+	std::cout << "  Serial:   " << serial_duration.count() << " μs (" << serial.size() << " tokens)" << std::endl;
+	std::cout << "  Parallel: " << parallel_duration.count() << " μs (" << parallel.size() << " tokens)" << std::endl;
+	std::cout << "  Output " << (serial == parallel ? "identical to" : "DIFFERS from") << " serial tokenize()" << std::endl;
+
+	// Forcing more ranges than cores still has to give the same answer
+	auto forced = tokenizer.tokenize_parallel(large_text, 16);
+	std::cout << "  16 ranges " << (serial == forced ? "identical to" : "DIFFERS from") << " serial tokenize()" << std::endl;
+}
+
+void test_spsc_queue() {
+	print_separator("SPSC QUEUE TEST");
+
+	// A small ring forces both sides through the full and empty paths
+	SpscQueue<std::vector<int>> queue(8);
+	const int batches = 20000;
+
+	auto start_time = std::chrono::high_resolution_clock::now();
+	std::thread producer([&]() {
+		std::vector<std::vector<int>> pending;
+		for (int i = 0; i < batches; ++i) {
+			// Alternate single pushes with groups of four batched pushes
+			if (i % 8 < 4) {
+				queue.push(std::vector<int>{ i, -i });
+				continue;
+			}
+			pending.push_back(std::vector<int>{ i, -i });
+			if (pending.size() == 4 || i + 1 == batches) {
+				size_t pushed = 0;
+				while (pushed < pending.size()) {
+					pushed += queue.try_push_batch(pending.begin() + pushed, pending.size() - pushed);
+				}
+				pending.clear();
+			}
+		}
+		queue.close();
+	});
+
+	bool ordered = true;
+	int received = 0;
+	std::vector<std::vector<int>> popped;
+	std::vector<int> item;
+	while (true) {
+		popped.clear();
+		if (queue.try_pop_batch(std::back_inserter(popped), 5) == 0) {
+			if (!queue.pop(item)) break;
+			popped.push_back(std::move(item));
+		}
+		for (const auto& batch : popped) {
+			if (batch.size() != 2 || batch[0] != received || batch[1] != -received) ordered = false;
+			received++;
+		}
+	}
+	producer.join();
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::high_resolution_clock::now() - start_time);
+
+	std::cout << "Capacity: " << queue.capacity() << ", items: " << received << " in " << duration.count() << " μs" << std::endl;
+	std::cout << "  Order " << (ordered && received == batches ? "preserved" : "BROKEN") << std::endl;
 }
 
+void test_file_tokenization() {
+	print_separator("FILE TOKENIZATION TEST");
+
+	TextTokenizer tokenizer;
+	tokenizer
+		.set_lowercase(true)
+		.set_split_on_punctuation(true);
+
+	std::string text;
+	for (int i = 0; i < 1000; ++i) {
+		text += "Memory mapped files are scanned in place, without a copy.\n";
+	}
+
+	const std::string path = "tokenizer_file_test.txt";
+	{
+		std::ofstream out(path, std::ios::binary);
+		out << text;
+	}
+
+	std::vector<std::string> tokens;
+	if (!tokenizer.tokenize_file(path, tokens)) {
+		std::cout << "Failed to tokenize '" << path << "'" << std::endl;
+		return;
+	}
+
+	std::cout << "File: " << text.size() << " bytes, " << tokens.size() << " tokens" << std::endl;
+	std::cout << "  " << (tokens == tokenizer.tokenize(text) ? "Matches" : "DIFFERS from") << " in-memory tokenize()" << std::endl;
+
+	std::vector<int> ids;
+	std::cout << "  encode_file on missing file returns "
+		<< (tokenizer.encode_file("no_such_file.txt", ids) ? "true" : "false") << std::endl;
+
+	std::remove(path.c_str());
+}
+
+void test_token_dataset() {
+	print_separator("INDEXED TOKEN DATASET TEST");
+
+	TextTokenizer tokenizer;
+	std::vector<std::string> documents = {
+		"the quick brown fox jumps over the lazy dog",
+		"machine learning loves large datasets",
+		"",
+		"random access to any document in constant time"
+	};
+
+	tokenizer
+		.set_lowercase(true)
+		.build_vocab_from_text(documents, 1, 1000);
+
+	TokenDatasetWriter writer;
+	if (!writer.open("tokenizer_dataset_test", 2)) {
+		std::cout << "Failed to create dataset!" << std::endl;
+		return;
+	}
+	for (const auto& document : documents) {
+		writer.add_document(tokenizer, document);
+	}
+
+	// The first document again, arriving in two pieces
+	auto first_ids = tokenizer.encode(documents[0]);
+	size_t half = first_ids.size() / 2;
+	writer.append(std::vector<int>(first_ids.begin(), first_ids.begin() + half));
+	writer.append(std::vector<int>(first_ids.begin() + half, first_ids.end()));
+	writer.end_document();
+	documents.push_back(documents[0]);
+	writer.close();
+
+	// Ids are stored little-endian whatever the host byte order
+	unsigned char first_bytes[2] = {};
+	std::ifstream("tokenizer_dataset_test.bin", std::ios::binary).read(reinterpret_cast<char*>(first_bytes), 2);
+	bool little_endian = first_bytes[0] == (first_ids[0] & 0xFF) && first_bytes[1] == (first_ids[0] >> 8);
+
+	TokenDatasetReader reader;
+	if (!reader.open("tokenizer_dataset_test")) {
+		std::cout << "Failed to open dataset!" << std::endl;
+		return;
+	}
+
+	std::cout << "Documents: " << reader.size() << ", tokens: " << reader.token_count()
+		<< ", id width: " << reader.dtype_bytes() << " bytes" << std::endl;
+
+	bool all_match = true;
+	for (size_t n = reader.size(); n-- > 0; ) {
+		all_match = all_match && reader.document_ids(n) == tokenizer.encode(documents[n]);
+	}
+	std::cout << "  Documents " << (all_match ? "match" : "DIFFER from") << " encode() output" << std::endl;
+	std::cout << "  Byte order: " << (little_endian ? "little-endian" : "WRONG") << std::endl;
+
+#if defined(__cpp_lib_span)
+	auto view = reader.document<uint16_t>(3);
+	std::cout << "  Document 3 (zero-copy view): ";
+	for (uint16_t id : view) {
+		std::cout << tokenizer.get_token_by_id(id) << " ";
+	}
+	std::cout << std::endl;
+#endif
+
+	reader.close();
+	std::remove("tokenizer_dataset_test.bin");
+	std::remove("tokenizer_dataset_test.idx");
+}
+
+void test_jsonl_extraction() {
+	print_separator("JSONL TEXT EXTRACTION TEST");
+
+	TextTokenizer tokenizer;
+	tokenizer
+		.set_lowercase(true)
+		.set_split_on_punctuation(true);
+
+	std::string jsonl =
+		"{\"id\": 1, \"text\": \"Plain text is returned without a copy.\"}\n"
+		"{\"meta\": {\"text\": \"nested keys are ignored\"}, \"text\": \"Escapes: \\\"quoted\\\"\\nnew line, caf\\u00e9, \\ud83d\\ude80\"}\n"
+		"{\"id\": 3, \"title\": \"no text field\"}\n"
+		"{\"text\": [\"not\", \"a string\"]}\n";
+
+	JsonlTextExtractor extractor("text");
+	std::istringstream in(jsonl);
+	size_t count = extractor.for_each_text(in, [&](std::string_view text) {
+		std::cout << "Text: \"" << text << "\"" << std::endl;
+		std::cout << "  Tokens: " << tokenizer.count_tokens(text) << std::endl;
+	});
+
+	std::cout << "Extracted " << count << " records, skipped " << extractor.skipped_lines() << " lines" << std::endl;
+}
+
+void test_token_id_compression() {
+	print_separator("TOKEN ID COMPRESSION TEST");
+
+	TextTokenizer tokenizer;
+	if (!tokenizer.load_vocab("vocab.txt")) {
+		std::cout << "Cannot test compression without vocabulary!" << std::endl;
+		return;
+	}
+
+	tokenizer
+		.set_lowercase(true)
+		.set_split_on_punctuation(true)
+		.set_keep_punctuation(true);
+
+	std::string base_text = "Compressed token streams keep small ids small, and large ids still fit in four bytes. ";
+	std::string large_text;
+	for (int i = 0; i < 2000; ++i) {
+		large_text += base_text;
+	}
+
+	auto ids = tokenizer.encode(large_text);
+	auto encoded = TokenIdCodec::encode(ids, 4096);
+
+	TokenIdCodec codec;
+	if (!codec.open(encoded.data(), encoded.size())) {
+		std::cout << "Failed to open compressed ids!" << std::endl;
+		return;
+	}
+
+	std::vector<int> decoded;
+	auto start_time = std::chrono::high_resolution_clock::now();
+	codec.decode(decoded);
+	auto decode_time = std::chrono::high_resolution_clock::now();
+	auto decode_duration = std::chrono::duration_cast<std::chrono::microseconds>(decode_time - start_time);
+
+	std::cout << "Ids: " << ids.size() << " (" << ids.size() * sizeof(int) << " bytes raw, "
+		<< encoded.size() << " bytes compressed, " << codec.block_count() << " blocks)" << std::endl;
+	std::cout << "  Decode: " << decode_duration.count() << " μs, round-trip "
+		<< (decoded == ids ? "exact" : "MISMATCH") << std::endl;
+	std::cout << "  Random access id[12345] = " << codec.at(12345)
+		<< (codec.at(12345) == ids[12345] ? " (correct)" : " (WRONG)") << std::endl;
+
+	// Crafted headers: a count that wraps ceil(count / block_size) to zero blocks,
+	// and a count far larger than the payload could hold
+	auto wrapped = encoded;
+	uint64_t wrapped_count = UINT64_MAX - codec.block_size() + 2;
+	uint64_t zero_blocks = 0;
+	std::memcpy(wrapped.data() + 16, &wrapped_count, sizeof(wrapped_count));
+	std::memcpy(wrapped.data() + 24, &zero_blocks, sizeof(zero_blocks));
+
+	auto oversized = encoded;
+	uint64_t oversized_count = uint64_t(1) << 40;
+	uint64_t oversized_blocks = oversized_count / codec.block_size();
+	std::memcpy(oversized.data() + 16, &oversized_count, sizeof(oversized_count));
+	std::memcpy(oversized.data() + 24, &oversized_blocks, sizeof(oversized_blocks));
+
+	TokenIdCodec rejected;
+	bool malformed_rejected = !rejected.open(wrapped.data(), wrapped.size()) &&
+		!rejected.open(oversized.data(), oversized.size());
+	std::cout << "  Malformed headers " << (malformed_rejected ? "rejected" : "ACCEPTED") << std::endl;
+}
+
+void test_encode_cache() {
+	print_separator("ENCODE CACHE TEST");
+
+	TextTokenizer tokenizer;
+	tokenizer
+		.set_lowercase(true)
+		.set_split_on_punctuation(true)
+		.build_vocab_from_text({ "what is the weather like today in paris and london" });
+
+	auto cache = std::make_shared<EncodeCache>(1024 * 1024);
+	tokenizer.set_encode_cache(cache);
+
+	std::vector<std::string> queries = {
+		"What is the weather like today?",
+		"Weather in Paris",
+		"Weather in London",
+		"What is the weather like today?"
+	};
+
+	bool consistent = true;
+	auto start_time = std::chrono::high_resolution_clock::now();
+	for (int round = 0; round < 1000; ++round) {
+		for (const auto& query : queries) {
+			if (tokenizer.encode(query) != tokenizer.encode_uncached(query)) consistent = false;
+		}
+	}
+	auto end_time = std::chrono::high_resolution_clock::now();
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+
+	// A config change must never serve stale entries
+	auto before = tokenizer.encode("PARIS");
+	tokenizer.set_lowercase(false);
+	auto after = tokenizer.encode("PARIS");
+
+	// An identically configured tokenizer hits the same entries, and a
+	// setter that changes nothing keeps them valid
+	TextTokenizer twin;
+	twin
+		.set_lowercase(false)
+		.set_split_on_punctuation(true)
+		.build_vocab_from_text({ "what is the weather like today in paris and london" });
+	twin.set_encode_cache(cache);
+	twin.set_split_on_punctuation(true);
+	uint64_t hits_before = cache->stats().hits;
+	twin.encode("PARIS");
+	bool shared = twin.config_fingerprint() == tokenizer.config_fingerprint() && cache->stats().hits == hits_before + 1;
+
+	auto stats = cache->stats();
+	std::cout << "Queries: " << 4000 << " in " << duration.count() << " μs, results "
+		<< (consistent ? "match uncached encode" : "MISMATCH") << std::endl;
+	std::cout << "  Hits: " << stats.hits << ", misses: " << stats.misses << ", entries: " << stats.entries
+		<< ", bytes: " << stats.bytes << std::endl;
+	std::cout << "  After set_lowercase(false): " << (before != after ? "re-encoded" : "STALE") << std::endl;
+	std::cout << "  Identical config: " << (shared ? "shares cache entries" : "NOT SHARED") << std::endl;
+}
+
+void test_memory_usage() {
+	print_separator("MEMORY USAGE TEST");
+
+	TextTokenizer tokenizer;
+	if (!tokenizer.load_vocab("vocab.txt")) {
+		std::cout << "Cannot report vocabulary memory without vocabulary!" << std::endl;
+		return;
+	}
+	tokenizer.set_encode_cache(std::make_shared<EncodeCache>(1024 * 1024));
+	tokenizer.encode("memory accounting counts cached results too");
+
+	auto usage = tokenizer.memory_usage();
+	auto kib = [](size_t bytes) { return std::to_string((bytes + 512) / 1024) + " KiB"; };
+
+	std::cout << "Vocabulary: " << tokenizer.vocab_size() << " tokens" << std::endl;
+	std::cout << "  vocab_to_id_ buckets: " << kib(usage.vocab_buckets) << std::endl;
+	std::cout << "  vocab_to_id_ nodes:   " << kib(usage.vocab_nodes) << std::endl;
+	std::cout << "  vocab_to_id_ strings: " << kib(usage.vocab_strings) << std::endl;
+	std::cout << "  id_to_vocab_ table:   " << kib(usage.id_table) << std::endl;
+	std::cout << "  id_to_vocab_ strings: " << kib(usage.id_strings) << std::endl;
+	std::cout << "  encode cache:         " << kib(usage.encode_cache) << std::endl;
+	std::cout << "  Total:                " << kib(usage.total()) << " ("
+		<< usage.total() / tokenizer.vocab_size() << " bytes per token)" << std::endl;
+}
+
+void test_compressed_vocab() {
+	print_separator("COMPRESSED VOCABULARY TEST");
+
+	TextTokenizer tokenizer;
+	if (!tokenizer.load_vocab("vocab.txt")) {
+		std::cout << "Cannot test vocabulary compression without vocabulary!" << std::endl;
+		return;
+	}
+	tokenizer
+		.set_lowercase(true)
+		.set_split_on_punctuation(true)
+		.set_keep_punctuation(true);
+
+	std::string text = "Front-coded vocabularies trade a little lookup time for a much smaller footprint! ";
+	auto ids = tokenizer.encode(text);
+	auto decoded = tokenizer.decode(ids);
+	size_t before = tokenizer.memory_usage().total();
+
+	tokenizer.compress_vocab();
+	size_t after = tokenizer.memory_usage().total();
+	bool same = tokenizer.encode(text) == ids && tokenizer.decode(ids) == decoded;
+
+	std::cout << "Vocabulary: " << tokenizer.vocab_size() << " tokens, " << before << " -> " << after << " bytes" << std::endl;
+	std::cout << "  Encode/decode after compression: " << (same ? "unchanged" : "CHANGED") << std::endl;
+}
+
+void test_isa_kernels() {
+	print_separator("ISA KERNELS TEST");
+
+	std::cout << "Active kernels: " << Kernels::isa_name(Kernels::active_isa())
+		<< " (cap with MTT_ISA=scalar|v2|v3|v4)" << std::endl;
+
+	// Every supported level must agree with the scalar kernels, across
+	// lengths that exercise the 16/32/64-byte blocks and their tails
+	ByteSet set;
+	for (char c : std::string(" \t\n.,!?")) set.insert(static_cast<unsigned char>(c));
+	std::string base = "The QUICK brown Fox jumps over the LAZY dog, caf\xC3\xA9 na\xC3\xAFve! ";
+	auto scalar = Kernels::table_for(Kernels::IsaLevel::scalar);
+
+	for (auto level : { Kernels::IsaLevel::v2, Kernels::IsaLevel::v3, Kernels::IsaLevel::v4 }) {
+		if (!Kernels::cpu_supports(level)) {
+			std::cout << "  " << Kernels::isa_name(level) << ": not supported by this CPU" << std::endl;
+			continue;
+		}
+		auto kernels = Kernels::table_for(level);
+		bool same = true;
+		for (size_t length = 0; length <= 200; ++length) {
+			std::string text;
+			while (text.size() < length) text += base;
+			text.resize(length);
+			std::string expected(length, '\0'), actual(length, '\0');
+			for (size_t from = 0; from <= length; from += 7) {
+				same = same && kernels.find_special(text.data(), from, length, set) == scalar.find_special(text.data(), from, length, set);
+			}
+			same = same && kernels.lower_ascii(text.data(), length, &actual[0]) == scalar.lower_ascii(text.data(), length, &expected[0]);
+			for (unsigned char limit : { 0x80, 0xC3, 0xCC }) {
+				same = same && kernels.prefix_below(text.data(), length, limit) == scalar.prefix_below(text.data(), length, limit);
+			}
+			same = same && actual == expected;
+		}
+		std::cout << "  " << Kernels::isa_name(level) << ": " << (same ? "matches scalar" : "MISMATCH") << std::endl;
+	}
+}
+
+void test_unicode_boundaries() {
+	print_separator("UNICODE BOUNDARIES TEST");
+
+	std::cout << "Unicode tables: " << UnicodeTables::unicode_version << std::endl;
+
+	// Full-width comma, NBSP, ideographic space and curly quotes
+	std::string text = "\xE4\xBD\xA0\xE5\xA5\xBD\xEF\xBC\x8C\xE4\xB8\x96\xE7\x95\x8C a\xC2\xA0" "b"
+		"\xE3\x80\x80\xE2\x80\x9Cquoted\xE2\x80\x9D";
+	TextTokenizer splitter;
+	splitter.set_split_on_punctuation(true);
+	auto split = splitter.tokenize(text);
+	auto kept = TextTokenizer().tokenize(text);
+
+	std::cout << "Input: " << text << std::endl;
+	std::cout << "Split on punctuation (" << split.size() << "):";
+	for (const auto& token : split) std::cout << " '" << token << "'";
+	std::cout << std::endl;
+	std::cout << "Whitespace only (" << kept.size() << "):";
+	for (const auto& token : kept) std::cout << " '" << token << "'";
+	std::cout << std::endl;
+	std::cout << "count_tokens agrees: " << (splitter.count_tokens(text) == split.size() ? "yes" : "NO") << std::endl;
+}
+
+void test_case_folding() {
+	print_separator("CASE FOLDING TEST");
+
+	// Latin-1, Greek, Cyrillic, U+1E9E capital sharp s and U+212A Kelvin sign
+	TextTokenizer tokenizer;
+	tokenizer.set_lowercase(true);
+	std::string text = "\xC3\x89" "COLE \xCE\xA3\xCE\x9F\xCE\xA6\xCE\x99\xCE\x91 \xD0\x9C\xD0\x9E\xD0\xA1\xD0\x9A\xD0\x92\xD0\x90 "
+		"STRA\xE1\xBA\x9E" "E \xE2\x84\xAA" "ELVIN";
+
+	std::cout << "Input: " << text << std::endl;
+	std::cout << "Folded:";
+	for (const auto& token : tokenizer.tokenize(text)) std::cout << " '" << token << "'";
+	std::cout << std::endl;
+}
+
+void test_normalization() {
+	print_separator("UNICODE NORMALIZATION TEST");
+
+	// "café" with a precomposed e-acute and with e + U+0301, and the "fi" ligature
+	std::string composed = "caf\xC3\xA9";
+	std::string decomposed = "cafe\xCC\x81";
+	std::string ligature = "\xEF\xAC\x81le";
+
+	auto hex = [](const std::string& text) {
+		std::ostringstream out;
+		for (unsigned char c : text) out << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(c) << ' ';
+		return out.str();
+	};
+	std::cout << "NFC(decomposed): " << hex(TextTokenizer::normalize_unicode(decomposed, NormalizationForm::nfc)) << std::endl;
+	std::cout << "NFD(composed):   " << hex(TextTokenizer::normalize_unicode(composed, NormalizationForm::nfd)) << std::endl;
+	std::cout << "NFKC(ligature):  " << TextTokenizer::normalize_unicode(ligature, NormalizationForm::nfkc) << std::endl;
+
+	// Both spellings map to the same id once the tokenizer normalizes them
+	TextTokenizer tokenizer;
+	tokenizer.set_normalization(NormalizationForm::nfc);
+	auto tokens = tokenizer.tokenize(composed + " " + decomposed);
+	std::cout << "Same token after NFC: " << (tokens.size() == 2 && tokens[0] == tokens[1] ? "yes" : "NO") << std::endl;
+}
+
+void test_stage_stats() {
+	print_separator("STAGE STATS TEST");
+
+	if (!TokenizerStats::enabled) {
+		std::cout << "Stage stats compiled out (configure with -DMTT_ENABLE_STATS=ON)" << std::endl;
+		return;
+	}
+
+	TextTokenizer tokenizer;
+	if (!tokenizer.load_vocab("vocab.txt")) {
+		std::cout << "Cannot test stage stats without vocabulary!" << std::endl;
+		return;
+	}
+	tokenizer.set_lowercase(true).set_split_on_punctuation(true);
+
+	// Short calls are sampled sparsely; a large call is always timed
+	std::string text = "Stage timers sample the hot path, so the numbers are estimates. ";
+	std::string large;
+	while (large.size() < TokenizerStats::always_timed_bytes) large += text;
+	auto before = TokenizerStats::snapshot();
+	for (int i = 0; i < 20000; ++i) {
+		tokenizer.encode_sequence(text, 64);
+	}
+	tokenizer.encode(large);
+	auto delta = TokenizerStats::snapshot() - before;
+
+	auto report = [](const char* name, const TokenizerStageStats& stage) {
+		std::cout << "  " << name << ": " << stage.calls << " calls, " << stage.items << " items, "
+			<< stage.bytes << " bytes, " << stage.ns / 1000 << " us";
+		if (stage.calls) std::cout << " (" << stage.ns / stage.calls << " ns/call)";
+		std::cout << std::endl;
+	};
+	report("encode   ", delta.encode);
+	report("normalize", delta.normalize);
+	report("lookup   ", delta.lookup);
+	report("sequence ", delta.sequence);
+}
+
+#ifdef MTT_PMR
+void test_pmr_encoding() {
+	print_separator("PMR ARENA ENCODING TEST");
+
+	TextTokenizer tokenizer;
+	if (!tokenizer.load_vocab("vocab.txt")) {
+		std::cout << "Cannot test arena encoding without vocabulary!" << std::endl;
+		return;
+	}
+
+	tokenizer
+		.set_lowercase(true)
+		.set_split_on_punctuation(true);
+
+	std::string request = "Request-scoped arenas release every token and id with a single reset.";
+
+	// Everything produced for the request lives in this stack buffer
+	char buffer[16 * 1024];
+	std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+	auto tokens = tokenizer.tokenize(request, &arena);
+	auto ids = tokenizer.encode(request, &arena);
+	auto sequence = tokenizer.encode_sequence(request, &arena, 16);
+
+	auto heap_ids = tokenizer.encode(request);
+	bool same = std::equal(ids.begin(), ids.end(), heap_ids.begin(), heap_ids.end());
+
+	std::cout << "Tokens: " << tokens.size() << ", ids: " << ids.size() << ", sequence: " << sequence.size() << std::endl;
+	std::cout << "  Arena result " << (same ? "matches" : "DIFFERS FROM") << " heap encode" << std::endl;
+}
+#endif
+
+#ifdef MTT_COROUTINES
+// Fire-and-forget coroutine type, enough to drive the async API from main()
+struct DemoTask {
+	struct promise_type {
+		DemoTask get_return_object() { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+	};
+};
+
+DemoTask run_async_encoding(const TextTokenizer& tokenizer, const std::string& large_text,
+	const std::vector<std::string>& batch, std::promise<void>& done) {
+	auto caller = std::this_thread::get_id();
+
+	auto short_ids = co_await tokenizer.async_encode("short requests stay inline");
+	std::cout << "Short input: " << short_ids.size() << " ids, resumed on "
+		<< (std::this_thread::get_id() == caller ? "calling thread" : "worker thread") << std::endl;
+
+	auto long_ids = co_await tokenizer.async_encode(large_text);
+	std::cout << "Long input:  " << long_ids.size() << " ids, resumed on "
+		<< (std::this_thread::get_id() == caller ? "calling thread" : "worker thread")
+		<< (long_ids == tokenizer.encode(large_text) ? ", matches encode()" : ", DIFFERS from encode()") << std::endl;
+
+	auto batch_ids = co_await tokenizer.async_encode_batch(batch);
+	size_t total = 0;
+	for (const auto& ids : batch_ids) {
+		total += ids.size();
+	}
+	std::cout << "Batch:       " << batch_ids.size() << " texts, " << total << " ids" << std::endl;
+
+	done.set_value();
+}
+
+void test_async_encoding() {
+	print_separator("ASYNC (COROUTINE) ENCODING TEST");
+
+	TextTokenizer tokenizer;
+	tokenizer
+		.set_lowercase(true)
+		.set_split_on_punctuation(true)
+		.build_vocab_from_text({ "coroutines keep the event loop responsive while long inputs are encoded" });
+
+	std::string large_text;
+	for (int i = 0; i < 2000; ++i) {
+		large_text += "Coroutines keep the event loop responsive, while long inputs are encoded! ";
+	}
+	std::vector<std::string> batch(64, large_text.substr(0, 1000));
+
+	std::promise<void> done;
+	auto finished = done.get_future();
+	run_async_encoding(tokenizer, large_text, batch, done);
+	finished.wait();
+}
+#endif
+
 void test_edge_cases() {
 	print_separator("EDGE CASES TEST");
 
@@ -289,16 +1179,47 @@ void test_edge_cases() {
 	}
 }
 
-int main()
+int main(int argc, char* argv[])
 {
 	std::cout << "Vocabulary Tokenizer Demo" << std::endl;
 	std::cout << "=======================================" << std::endl;
 
+	// --performance [runs]: only the performance workload (PGO training and
+	// the speedup report use this)
+	if (argc > 1 && std::string(argv[1]) == "--performance") {
+		int runs = argc > 2 ? std::max(1, std::atoi(argv[2])) : 1;
+		for (int i = 0; i < runs; ++i) {
+			test_performance();
+		}
+		return 0;
+	}
+
 	test_basic_tokenization();
 	test_distilbert_vocab_loading();
 	test_encoding_decoding();
 	test_sequence_encoding();
 	test_performance();
+	test_streaming_tokenization();
+	test_parallel_tokenization();
+	test_spsc_queue();
+	test_file_tokenization();
+	test_token_dataset();
+	test_jsonl_extraction();
+	test_token_id_compression();
+	test_encode_cache();
+	test_memory_usage();
+	test_compressed_vocab();
+	test_isa_kernels();
+	test_unicode_boundaries();
+	test_case_folding();
+	test_normalization();
+	test_stage_stats();
+#ifdef MTT_PMR
+	test_pmr_encoding();
+#endif
+#ifdef MTT_COROUTINES
+	test_async_encoding();
+#endif
 	test_edge_cases();
 
 	std::cout << "Demo completed!" << std::endl;
@@ -38,468 +38,4367 @@
 #include <unordered_set>
 #include <unordered_map>
 #include <algorithm>
+#include <iterator>
+#include <type_traits>
 #include <cctype>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <cstring>
+#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+
+#include "Modern-Text-Tokenizer-Unicode.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MTT_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MTT_X86 1
+#include <tmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define MTT_X86_64 1
+#include <immintrin.h>
+#endif
+
+// Per-function ISA targets, so SIMD kernels can be used on CPUs that support
+// them without building the whole program for that ISA
+#if defined(MTT_X86) && (defined(__GNUC__) || defined(__clang__))
+#define MTT_TARGET(isa) __attribute__((target(isa)))
+#else
+#define MTT_TARGET(isa)
+#endif
+
+// Keeps rarely taken paths out of their caller's hot code
+#if defined(__GNUC__) || defined(__clang__)
+#define MTT_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define MTT_NOINLINE __declspec(noinline)
+#else
+#define MTT_NOINLINE
+#endif
+
+#if __has_include(<span>)
+#include <span>
+#endif
+
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#if defined(__cpp_lib_memory_resource)
+#define MTT_PMR 1
+#endif
+#endif
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define MTT_COROUTINES 1
+#include <coroutine>
+#include <exception>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MTT_POSIX 1
+#include <unistd.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <signal.h>
+#endif
+
+#if defined(__linux__)
+#define MTT_LINUX 1
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <ctime>
+#endif
+
+// Hot-path instrumentation (see TokenizerStats). Compiled out entirely
+// unless MTT_ENABLE_STATS is defined.
+#ifdef MTT_ENABLE_STATS
+#define MTT_STAGE_TIMER(stage, bytes) ::MecanikDev::TokenizerStats::StageTimer mtt_stage_timer_(::MecanikDev::TokenizerStats::stage, bytes)
+#define MTT_STAGE_ITEMS(n) mtt_stage_timer_.add_items(n)
+#define MTT_TOKEN_SAMPLED(...) ::MecanikDev::TokenizerStats::with_token_sampler([&](const auto& mtt_token_sampler_) { __VA_ARGS__; })
+#define MTT_SAMPLED_TIMER(stage) [[maybe_unused]] auto mtt_sampled_timer_ = mtt_token_sampler_.time(::MecanikDev::TokenizerStats::stage)
+#else
+#define MTT_STAGE_TIMER(stage, bytes) ((void)0)
+#define MTT_STAGE_ITEMS(n) ((void)0)
+#define MTT_TOKEN_SAMPLED(...) __VA_ARGS__
+#define MTT_SAMPLED_TIMER(stage) ((void)0)
+#endif
 
 namespace MecanikDev
 {
-	class TextTokenizer
+	// Small helpers shared by several components
+	namespace detail
+	{
+		inline bool host_is_little_endian() {
+			const uint16_t probe = 1;
+			unsigned char first;
+			std::memcpy(&first, &probe, 1);
+			return first == 1;
+		}
+
+		// Unsigned little-endian integers of 1-8 bytes, whatever the host byte order
+		inline void store_le(unsigned char* dst, uint64_t value, size_t bytes) {
+			for (size_t b = 0; b < bytes; ++b) {
+				dst[b] = static_cast<unsigned char>(value >> (8 * b));
+			}
+		}
+
+		inline uint64_t load_le(const unsigned char* src, size_t bytes) {
+			uint64_t value = 0;
+			for (size_t b = 0; b < bytes; ++b) {
+				value |= static_cast<uint64_t>(src[b]) << (8 * b);
+			}
+			return value;
+		}
+
+		// Index of the lowest set bit of a non-zero mask
+		inline unsigned count_trailing_zeros(uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+			return static_cast<unsigned>(__builtin_ctzll(mask));
+#elif defined(_MSC_VER) && defined(MTT_X86_64)
+			unsigned long index;
+			_BitScanForward64(&index, mask);
+			return static_cast<unsigned>(index);
+#else
+			unsigned n = 0;
+			while ((mask & 1u) == 0) {
+				mask >>= 1;
+				n++;
+			}
+			return n;
+#endif
+		}
+
+		// Encode cp as UTF-8 into out (at least 4 bytes); returns the length
+		inline size_t encode_utf8(char32_t cp, char* out) {
+			if (cp < 0x80) {
+				out[0] = static_cast<char>(cp);
+				return 1;
+			}
+			if (cp < 0x800) {
+				out[0] = static_cast<char>(0xC0 | (cp >> 6));
+				out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+				return 2;
+			}
+			if (cp < 0x10000) {
+				out[0] = static_cast<char>(0xE0 | (cp >> 12));
+				out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+				out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+				return 3;
+			}
+			out[0] = static_cast<char>(0xF0 | (cp >> 18));
+			out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+			out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+			return 4;
+		}
+
+		inline void append_utf8(std::string& out, char32_t cp) {
+			char bytes[4];
+			out.append(bytes, encode_utf8(cp, bytes));
+		}
+	}
+
+	struct TokenizerStageStats {
+		uint64_t calls = 0;	// API calls, or for per-token stages the estimated token count
+		uint64_t items = 0;	// tokens produced or looked up
+		uint64_t bytes = 0;	// input bytes
+		uint64_t ns = 0;	// estimated time spent, from sampled measurements
+	};
+
+	// Process-wide totals of the instrumented stages. Subtract two snapshots
+	// taken some time apart to get rates for that interval.
+	struct TokenizerStatsSnapshot {
+		TokenizerStageStats tokenize;	// tokenize() calls: scanning + normalization
+		TokenizerStageStats normalize;	// per token
+		TokenizerStageStats encode;	// encode() calls: scanning + normalization + lookup
+		TokenizerStageStats lookup;	// per token vocabulary lookups
+		TokenizerStageStats sequence;	// encode_sequence special-token assembly
+
+		TokenizerStatsSnapshot operator-(const TokenizerStatsSnapshot& earlier) const {
+			TokenizerStatsSnapshot delta;
+			const TokenizerStageStats* a[] = { &tokenize, &normalize, &encode, &lookup, &sequence };
+			const TokenizerStageStats* b[] = { &earlier.tokenize, &earlier.normalize, &earlier.encode, &earlier.lookup, &earlier.sequence };
+			TokenizerStageStats* d[] = { &delta.tokenize, &delta.normalize, &delta.encode, &delta.lookup, &delta.sequence };
+			for (int i = 0; i < 5; ++i) {
+				d[i]->calls = a[i]->calls - b[i]->calls;
+				d[i]->items = a[i]->items - b[i]->items;
+				d[i]->bytes = a[i]->bytes - b[i]->bytes;
+				d[i]->ns = a[i]->ns - b[i]->ns;
+			}
+			return delta;
+		}
+	};
+
+	// Stage timers and counters behind MTT_ENABLE_STATS. Every thread counts
+	// into its own block with plain (uncontended, relaxed) stores; snapshot()
+	// sums the live blocks plus the totals of threads that have exited.
+	// To stay under 1% of a short encode call, calls below always_timed_bytes
+	// are recorded one in call_sample_interval and scaled up, and per-token
+	// stages are timed only inside one such call in token_call_interval (and
+	// in large calls, one token in token_sample_interval). Any other call
+	// costs a thread-local increment and a branch. All figures are estimates.
+	class TokenizerStats
 	{
+	public:
+		enum Stage { tokenize, normalize, encode, lookup, sequence, stage_count };
+
+#ifdef MTT_ENABLE_STATS
+		static constexpr bool enabled = true;
+#else
+		static constexpr bool enabled = false;
+#endif
+
 	private:
-		std::unordered_set<char> delimiters_;
-		bool lowercase_;
-		bool keep_punctuation_;
-		bool split_on_punctuation_;
+		struct Counters {
+			std::atomic<uint64_t> calls{ 0 };
+			std::atomic<uint64_t> items{ 0 };
+			std::atomic<uint64_t> bytes{ 0 };
+			std::atomic<uint64_t> ns{ 0 };
+		};
 
-		// Vocabulary support
-		std::unordered_map<std::string, int> vocab_to_id_;
-		std::vector<std::string> id_to_vocab_;
-		std::string unk_token_;
-		std::string pad_token_;
-		std::string cls_token_;
-		std::string sep_token_;
-		bool use_vocab_;
-		int unk_id_;
-		int pad_id_;
-		int cls_id_;
-		int sep_id_;
+		struct ThreadBlock {
+			Counters stages[stage_count];
+		};
 
-		// UTF-8 helper functions
-		static bool is_utf8_start(unsigned char c) {
-			return (c & 0x80) == 0 || (c & 0xE0) == 0xC0 ||
-				(c & 0xF0) == 0xE0 || (c & 0xF8) == 0xF0;
+		// Sampling state. Trivial types, so using them needs no thread_local
+		// initialization guard; the registered block is only touched when a
+		// sample is recorded.
+		static inline thread_local uint32_t call_ticks_[stage_count] = {};
+		static inline thread_local uint32_t token_weight_ = 0;	// set during a token-sampling call
+
+		struct Registry {
+			std::mutex mutex;
+			std::vector<ThreadBlock*> live;
+			uint64_t retired[stage_count][4] = {};
+		};
+
+		// Never destroyed: pool threads may exit during static destruction
+		static Registry& registry() {
+			static Registry* instance = new Registry();
+			return *instance;
 		}
 
-		static size_t utf8_char_length(unsigned char c) {
-			if ((c & 0x80) == 0) return 1;      // 0xxxxxxx
-			if ((c & 0xE0) == 0xC0) return 2;   // 110xxxxx
-			if ((c & 0xF0) == 0xE0) return 3;   // 1110xxxx
-			if ((c & 0xF8) == 0xF0) return 4;   // 11110xxx
-			// Invalid, treat as single byte
-			return 1;
+		struct ThreadRegistration {
+			ThreadBlock block;
+
+			ThreadRegistration() {
+				Registry& r = registry();
+				std::lock_guard<std::mutex> lock(r.mutex);
+				r.live.push_back(&block);
+			}
+
+			~ThreadRegistration() {
+				Registry& r = registry();
+				std::lock_guard<std::mutex> lock(r.mutex);
+				for (int s = 0; s < stage_count; ++s) {
+					r.retired[s][0] += block.stages[s].calls.load(std::memory_order_relaxed);
+					r.retired[s][1] += block.stages[s].items.load(std::memory_order_relaxed);
+					r.retired[s][2] += block.stages[s].bytes.load(std::memory_order_relaxed);
+					r.retired[s][3] += block.stages[s].ns.load(std::memory_order_relaxed);
+				}
+				r.live.erase(std::remove(r.live.begin(), r.live.end(), &block), r.live.end());
+			}
+		};
+
+		static ThreadBlock& local() {
+			thread_local ThreadRegistration registration;
+			return registration.block;
 		}
 
-		// Check if character is ASCII punctuation
-		static bool is_ascii_punct(char c) {
-			return std::ispunct(static_cast<unsigned char>(c));
+		// Only the owning thread writes, so a load + store is enough
+		static void add(std::atomic<uint64_t>& counter, uint64_t n) {
+			counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
 		}
 
-		// Safe lowercase for ASCII
-		static char to_ascii_lower(char c) {
-			return std::tolower(static_cast<unsigned char>(c));
+		static uint64_t now_ns() {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
 		}
 
-		// Normalize a token (lowercase if enabled)
-		std::string normalize_token(std::string_view token) const {
-			if (!lowercase_) {
-				return std::string(token);
+		// Cost of one clock read, subtracted from every sample so short
+		// per-token stages are not dominated by the measurement itself
+		static uint64_t clock_overhead_ns() {
+			static const uint64_t overhead = [] {
+				uint64_t best = ~0ull;
+				for (int i = 0; i < 64; ++i) {
+					uint64_t a = now_ns();
+					uint64_t b = now_ns();
+					best = std::min(best, b - a);
+				}
+				return best;
+			}();
+			return overhead;
+		}
+
+		static uint64_t elapsed_since(uint64_t start) {
+			uint64_t elapsed = now_ns() - start;
+			uint64_t overhead = clock_overhead_ns();
+			return elapsed > overhead ? elapsed - overhead : 0;
+		}
+
+	public:
+		static constexpr uint32_t call_sample_interval = 1024;
+		static constexpr uint32_t token_call_interval = 8192;	// a multiple of call_sample_interval
+		static constexpr uint32_t token_sample_interval = 1024;	// inside calls of always_timed_bytes or more
+		static constexpr size_t always_timed_bytes = 64 * 1024;
+
+		// Times one API call; calls on inputs below always_timed_bytes are
+		// sampled. Calls of stages that run per-token work (tokenize, encode)
+		// also decide whether per-token stages are sampled inside them. All
+		// decisions are made out of line, on one call in
+		// call_sample_interval / 2, so an ordinary call only bumps a counter.
+		class StageTimer
+		{
+		private:
+			Stage stage_;
+			bool sampled_ = false;
+			uint64_t items_ = 0;
+			// Set by begin()
+			uint32_t weight_;
+			uint64_t bytes_;
+			uint64_t start_;
+
+			MTT_NOINLINE void begin(size_t bytes, uint32_t tick) {
+				uint32_t token_weight = 0;
+				weight_ = 0;
+				bytes_ = bytes;
+				if (bytes >= always_timed_bytes) {
+					weight_ = 1;
+					token_weight = 1;
+				}
+				else if (tick % call_sample_interval == 0) {
+					weight_ = call_sample_interval;
+				}
+				else if (tick % token_call_interval == call_sample_interval / 2) {
+					// Never a timed call, so token timing does not inflate it
+					token_weight = token_call_interval;
+				}
+				if (token_weight && (stage_ == tokenize || stage_ == encode)) {
+					token_weight_ = token_weight;
+					sampled_ = true;
+				}
+				if (weight_) {
+					sampled_ = true;
+					start_ = now_ns();
+				}
 			}
 
-			std::string result;
-			result.reserve(token.size());
+			MTT_NOINLINE void finish() {
+				token_weight_ = 0;
+				if (!weight_) return;
+				uint64_t elapsed = elapsed_since(start_);
+				Counters& counters = local().stages[stage_];
+				add(counters.ns, elapsed * weight_);
+				add(counters.calls, weight_);
+				add(counters.bytes, bytes_ * weight_);
+				add(counters.items, items_ * weight_);
+			}
 
-			for (size_t i = 0; i < token.size(); ) {
-				unsigned char c = token[i];
+		public:
+			StageTimer(Stage stage, size_t bytes) : stage_(stage) {
+				uint32_t tick = ++call_ticks_[stage];
+				if (bytes >= always_timed_bytes || tick % (call_sample_interval / 2) == 0) {
+					begin(bytes, tick);
+				}
+			}
+
+			StageTimer(const StageTimer&) = delete;
+			StageTimer& operator=(const StageTimer&) = delete;
+
+			~StageTimer() {
+				if (sampled_) finish();
+			}
+
+			void add_items(size_t n) { items_ += n; }
+		};
 
-				if ((c & 0x80) == 0) {
-					// ASCII character - safe to lowercase
-					result += to_ascii_lower(c);
-					i++;
+		// Times one per-token operation; inert unless constructed with a weight
+		class SampledTimer
+		{
+		private:
+			Counters* counters_ = nullptr;
+			uint64_t weight_;	// set only when counters_ is
+			uint64_t start_;
+
+		public:
+			SampledTimer(Stage stage, uint64_t weight) {
+				if (weight) {
+					counters_ = &local().stages[stage];
+					weight_ = weight;
+					start_ = now_ns();
 				}
-				else {
-					// Multi-byte UTF-8 - copy as-is
-					size_t len = utf8_char_length(c);
-					for (size_t j = 0; j < len && i + j < token.size(); j++) {
-						result += token[i + j];
-					}
-					i += len;
+			}
+
+			SampledTimer(const SampledTimer&) = delete;
+			SampledTimer& operator=(const SampledTimer&) = delete;
+
+			~SampledTimer() {
+				if (counters_) {
+					add(counters_->ns, elapsed_since(start_) * weight_);
+					add(counters_->calls, weight_);
+				}
+			}
+		};
+
+		// Per-token timing inside a token-sampling call: every token of a
+		// sampled small call, one in token_sample_interval of a large call
+		class TokenSampler
+		{
+		private:
+			uint32_t call_weight_;
+			mutable uint32_t ticks_[stage_count] = {};
+
+		public:
+			explicit TokenSampler(uint32_t call_weight) : call_weight_(call_weight) {}
+
+			SampledTimer time(Stage stage) const {
+				if (call_weight_ > 1) return SampledTimer(stage, call_weight_);
+				return SampledTimer(stage, ++ticks_[stage] % token_sample_interval == 0 ? token_sample_interval : 0);
+			}
+		};
+
+		struct NullSampler {
+			struct Timer {};
+			Timer time(Stage) const { return {}; }
+		};
+
+		template<typename Fn>
+		MTT_NOINLINE static void run_token_sampled(Fn& fn) {
+			fn(TokenSampler(token_weight_));
+		}
+
+		// Runs fn(sampler) once: with a TokenSampler inside a token-sampling
+		// call, else with a NullSampler whose timers compile to nothing. The
+		// token loop is instantiated twice and the instrumented copy is kept
+		// out of line, so the hot copy is compiled as if stats were off.
+		template<typename Fn>
+		static void with_token_sampler(Fn&& fn) {
+			if (token_weight_) {
+				run_token_sampled(fn);
+			}
+			else {
+				fn(NullSampler());
+			}
+		}
+
+		// Totals over all threads so far (all zero when compiled out)
+		static TokenizerStatsSnapshot snapshot() {
+			TokenizerStatsSnapshot result;
+#ifdef MTT_ENABLE_STATS
+			TokenizerStageStats* out[] = { &result.tokenize, &result.normalize, &result.encode, &result.lookup, &result.sequence };
+			Registry& r = registry();
+			std::lock_guard<std::mutex> lock(r.mutex);
+			for (int s = 0; s < stage_count; ++s) {
+				out[s]->calls = r.retired[s][0];
+				out[s]->items = r.retired[s][1];
+				out[s]->bytes = r.retired[s][2];
+				out[s]->ns = r.retired[s][3];
+				for (const ThreadBlock* block : r.live) {
+					out[s]->calls += block->stages[s].calls.load(std::memory_order_relaxed);
+					out[s]->items += block->stages[s].items.load(std::memory_order_relaxed);
+					out[s]->bytes += block->stages[s].bytes.load(std::memory_order_relaxed);
+					out[s]->ns += block->stages[s].ns.load(std::memory_order_relaxed);
 				}
 			}
+#endif
 			return result;
 		}
+	};
 
-		// Check if we should split at this position
-		bool should_split_at(char c) const {
-			return delimiters_.count(c) > 0 ||
-				(split_on_punctuation_ && is_ascii_punct(c));
+	// Read-only view of a whole file. On POSIX systems a regular file is
+	// mmap'ed so the tokenizer scans the page cache directly; pipes and other
+	// non-regular files, and every file elsewhere, are read into an owned
+	// buffer.
+	class MappedFile
+	{
+	private:
+		const char* data_ = nullptr;
+		size_t size_ = 0;
+		bool mapped_ = false;
+		bool open_ = false;
+		std::string buffer_;
+
+#ifdef MTT_POSIX
+		bool read_all(int fd) {
+			char chunk[64 * 1024];
+			for (;;) {
+				ssize_t n = ::read(fd, chunk, sizeof(chunk));
+				if (n == 0) return true;
+				if (n < 0) {
+					if (errno == EINTR) continue;
+					return false;
+				}
+				buffer_.append(chunk, static_cast<size_t>(n));
+			}
 		}
+#endif
 
 	public:
-		TextTokenizer()
-			: delimiters_{ ' ', '\t', '\n', '\r', '\f', '\v' }
-			, lowercase_(false)
-			, keep_punctuation_(false)
-			, split_on_punctuation_(false)
-			, unk_token_("[UNK]")
-			, pad_token_("[PAD]")
-			, cls_token_("[CLS]")
-			, sep_token_("[SEP]")
-			, use_vocab_(false)
-			, unk_id_(-1)
-			, pad_id_(-1)
-			, cls_id_(-1)
-			, sep_id_(-1) {
+		MappedFile() = default;
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		MappedFile(MappedFile&& other) noexcept {
+			*this = std::move(other);
 		}
 
-		// Configuration methods
-		TextTokenizer& set_lowercase(bool enable) {
-			lowercase_ = enable;
+		MappedFile& operator=(MappedFile&& other) noexcept {
+			if (this != &other) {
+				close();
+				buffer_ = std::move(other.buffer_);
+				mapped_ = other.mapped_;
+				open_ = other.open_;
+				size_ = other.size_;
+				data_ = mapped_ ? other.data_ : buffer_.data();
+				other.data_ = nullptr;
+				other.size_ = 0;
+				other.mapped_ = false;
+				other.open_ = false;
+			}
 			return *this;
 		}
 
-		TextTokenizer& set_keep_punctuation(bool enable) {
-			keep_punctuation_ = enable;
-			return *this;
+		~MappedFile() {
+			close();
+		}
+
+		// Map a file read-only. sequential hints the kernel to read ahead
+		// aggressively; huge_pages asks for transparent huge pages where the
+		// kernel supports them for file mappings (best effort).
+		bool open(const std::string& path, bool sequential = true, bool huge_pages = false) {
+			close();
+#ifdef MTT_POSIX
+			int fd = ::open(path.c_str(), O_RDONLY);
+			if (fd < 0) return false;
+
+			struct stat st;
+			if (::fstat(fd, &st) != 0) {
+				::close(fd);
+				return false;
+			}
+
+			// Pipes, FIFOs and character devices report no usable size (and
+			// neither do procfs files), so read those into the buffer instead
+			if (!S_ISREG(st.st_mode) || st.st_size == 0) {
+				bool ok = read_all(fd);
+				::close(fd);
+				if (!ok) {
+					buffer_.clear();
+					return false;
+				}
+				data_ = buffer_.data();
+				size_ = buffer_.size();
+				open_ = true;
+				return true;
+			}
+
+			size_ = static_cast<size_t>(st.st_size);
+			void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (addr == MAP_FAILED) {
+				::close(fd);
+				size_ = 0;
+				return false;
+			}
+			data_ = static_cast<const char*>(addr);
+			mapped_ = true;
+
+			if (sequential) {
+				::madvise(addr, size_, MADV_SEQUENTIAL);
+			}
+#ifdef MADV_HUGEPAGE
+			if (huge_pages) {
+				::madvise(addr, size_, MADV_HUGEPAGE);
+			}
+#else
+			(void)huge_pages;
+#endif
+			::close(fd);
+#else
+			(void)sequential;
+			(void)huge_pages;
+			std::ifstream file(path, std::ios::binary);
+			if (!file.is_open()) return false;
+
+			std::ostringstream contents;
+			contents << file.rdbuf();
+			buffer_ = contents.str();
+			data_ = buffer_.data();
+			size_ = buffer_.size();
+#endif
+			open_ = true;
+			return true;
+		}
+
+		void close() {
+#ifdef MTT_POSIX
+			if (mapped_) {
+				::munmap(const_cast<char*>(data_), size_);
+			}
+#endif
+			buffer_.clear();
+			data_ = nullptr;
+			size_ = 0;
+			mapped_ = false;
+			open_ = false;
+		}
+
+		bool is_open() const { return open_; }
+		const char* data() const { return data_; }
+		size_t size() const { return size_; }
+		std::string_view view() const { return std::string_view(data_ ? data_ : "", size_); }
+	};
+
+	// Small fixed-size worker pool used by the async API and the tokenizer
+	// daemon. Jobs run in FIFO order; an idle pool costs nothing but
+	// sleeping threads.
+	class TokenizerThreadPool
+	{
+	private:
+		std::mutex mutex_;
+		std::condition_variable cv_;
+		std::deque<std::function<void()>> jobs_;
+		std::vector<std::thread> workers_;
+		bool stopping_ = false;
+
+	public:
+		explicit TokenizerThreadPool(unsigned threads = 0) {
+			if (threads == 0) {
+				threads = std::max(1u, std::thread::hardware_concurrency());
+			}
+			for (unsigned t = 0; t < threads; ++t) {
+				workers_.emplace_back([this]() {
+					for (;;) {
+						std::function<void()> job;
+						{
+							std::unique_lock<std::mutex> lock(mutex_);
+							cv_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+							if (jobs_.empty()) return;
+							job = std::move(jobs_.front());
+							jobs_.pop_front();
+						}
+						job();
+					}
+				});
+			}
+		}
+
+		TokenizerThreadPool(const TokenizerThreadPool&) = delete;
+		TokenizerThreadPool& operator=(const TokenizerThreadPool&) = delete;
+
+		~TokenizerThreadPool() {
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				stopping_ = true;
+			}
+			cv_.notify_all();
+			for (auto& worker : workers_) {
+				worker.join();
+			}
+		}
+
+		size_t size() const { return workers_.size(); }
+
+		void submit(std::function<void()> job) {
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				jobs_.push_back(std::move(job));
+			}
+			cv_.notify_one();
+		}
+
+		// Process-wide pool shared by all tokenizers, created on first use
+		static TokenizerThreadPool& shared() {
+			static TokenizerThreadPool pool;
+			return pool;
+		}
+	};
+
+	// Sharded LRU cache of encode results, for workloads that see the same
+	// texts over and over (search queries, prompts). Entries are keyed by a
+	// 64-bit hash of the text mixed with the tokenizer's config fingerprint;
+	// the text itself is stored too and compared on every hit, so a hash
+	// collision is only ever a miss. The byte budget is split evenly across
+	// shards, each guarded by its own mutex. Thread-safe; one cache can be
+	// shared by several tokenizers.
+	class EncodeCache
+	{
+	public:
+		struct Stats {
+			uint64_t hits = 0;
+			uint64_t misses = 0;
+			uint64_t insertions = 0;
+			uint64_t evictions = 0;
+			size_t entries = 0;
+			size_t bytes = 0;
+		};
+
+	private:
+		struct Entry {
+			uint64_t key;
+			uint64_t fingerprint;
+			std::string text;
+			std::vector<int> ids;
+			size_t bytes;
+		};
+
+		struct alignas(64) Shard {
+			std::mutex mutex;
+			std::list<Entry> lru;	// most recently used first
+			std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+			size_t bytes = 0;
+			uint64_t hits = 0;
+			uint64_t misses = 0;
+			uint64_t insertions = 0;
+			uint64_t evictions = 0;
+		};
+
+		std::vector<Shard> shards_;
+		size_t shard_budget_;
+
+		static uint64_t mix(uint64_t h) {
+			h ^= h >> 33;
+			h *= 0xFF51AFD7ED558CCDULL;
+			h ^= h >> 33;
+			h *= 0xC4CEB9FE1A85EC53ULL;
+			h ^= h >> 33;
+			return h;
+		}
+
+		static uint64_t key_for(std::string_view text, uint64_t fingerprint) {
+			return hash(text, mix(fingerprint));
+		}
+
+		Shard& shard_for(uint64_t key) {
+			return shards_[(key >> 32) % shards_.size()];
+		}
+
+		// Approximate heap cost of an entry: payloads plus list and index nodes
+		static size_t entry_bytes(const std::string& text, const std::vector<int>& ids) {
+			return sizeof(Entry) + text.capacity() + ids.capacity() * sizeof(int) + 4 * sizeof(void*) + 32;
+		}
+
+		void unlink(Shard& shard, std::list<Entry>::iterator it) {
+			shard.bytes -= it->bytes;
+			shard.index.erase(it->key);
+			shard.lru.erase(it);
+		}
+
+	public:
+		explicit EncodeCache(size_t byte_budget = 64 * 1024 * 1024, size_t shards = 16)
+			: shards_(std::max<size_t>(shards, 1)), shard_budget_(byte_budget / std::max<size_t>(shards, 1)) {
+		}
+
+		EncodeCache(const EncodeCache&) = delete;
+		EncodeCache& operator=(const EncodeCache&) = delete;
+
+		// 64-bit hash of text, 8 bytes per step
+		static uint64_t hash(std::string_view text, uint64_t seed = 0) {
+			const uint64_t k = 0x9E3779B97F4A7C15ULL;
+			uint64_t h = seed ^ (text.size() * k);
+			const char* p = text.data();
+			size_t n = text.size();
+
+			for (; n >= 8; p += 8, n -= 8) {
+				uint64_t word;
+				std::memcpy(&word, p, 8);
+				h = (h ^ mix(word * k)) * k;
+			}
+			if (n > 0) {
+				uint64_t word = 0;
+				std::memcpy(&word, p, n);
+				h = (h ^ mix(word * k)) * k;
+			}
+			return mix(h);
+		}
+
+		// Copy the cached ids for text into ids (any vector-like container);
+		// false on a miss
+		template<typename Ids>
+		bool lookup(std::string_view text, uint64_t fingerprint, Ids& ids) {
+			uint64_t key = key_for(text, fingerprint);
+			Shard& shard = shard_for(key);
+			std::lock_guard<std::mutex> lock(shard.mutex);
+
+			auto found = shard.index.find(key);
+			if (found == shard.index.end() || found->second->fingerprint != fingerprint || found->second->text != text) {
+				shard.misses++;
+				return false;
+			}
+
+			shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+			ids.assign(found->second->ids.begin(), found->second->ids.end());
+			shard.hits++;
+			return true;
+		}
+
+		// Insert (or replace) the ids for text, evicting least recently used
+		// entries until the shard fits its budget. Entries larger than a whole
+		// shard are not cached.
+		template<typename Ids>
+		void insert(std::string_view text, uint64_t fingerprint, const Ids& ids) {
+			uint64_t key = key_for(text, fingerprint);
+			Entry entry{ key, fingerprint, std::string(text), std::vector<int>(ids.begin(), ids.end()), 0 };
+			entry.bytes = entry_bytes(entry.text, entry.ids);
+			if (entry.bytes > shard_budget_) return;
+
+			Shard& shard = shard_for(key);
+			std::lock_guard<std::mutex> lock(shard.mutex);
+
+			auto found = shard.index.find(key);
+			if (found != shard.index.end()) {
+				unlink(shard, found->second);
+			}
+			while (!shard.lru.empty() && shard.bytes + entry.bytes > shard_budget_) {
+				unlink(shard, std::prev(shard.lru.end()));
+				shard.evictions++;
+			}
+
+			shard.bytes += entry.bytes;
+			shard.lru.push_front(std::move(entry));
+			shard.index[key] = shard.lru.begin();
+			shard.insertions++;
+		}
+
+		void clear() {
+			for (auto& shard : shards_) {
+				std::lock_guard<std::mutex> lock(shard.mutex);
+				shard.lru.clear();
+				shard.index.clear();
+				shard.bytes = 0;
+			}
+		}
+
+		Stats stats() {
+			Stats total;
+			for (auto& shard : shards_) {
+				std::lock_guard<std::mutex> lock(shard.mutex);
+				total.hits += shard.hits;
+				total.misses += shard.misses;
+				total.insertions += shard.insertions;
+				total.evictions += shard.evictions;
+				total.entries += shard.lru.size();
+				total.bytes += shard.bytes;
+			}
+			return total;
+		}
+
+		size_t byte_budget() const { return shard_budget_ * shards_.size(); }
+		size_t shard_count() const { return shards_.size(); }
+
+		// Approximate total footprint: entries plus shard and index overhead
+		size_t memory_usage() {
+			size_t total = sizeof(*this) + shards_.capacity() * sizeof(Shard);
+			for (auto& shard : shards_) {
+				std::lock_guard<std::mutex> lock(shard.mutex);
+				total += shard.bytes + shard.index.bucket_count() * sizeof(void*);
+			}
+			return total;
+		}
+	};
+
+	// Read-only vocabulary in front-coded form, for very large vocabularies
+	// where a hash map plus a vector of strings costs tens of MB. Tokens are
+	// sorted and grouped into blocks of block_size entries; each entry stores
+	// only the suffix that differs from its predecessor, followed by its id.
+	// token -> id binary-searches the block heads and scans one block without
+	// rebuilding strings; id -> token goes through an id -> rank table and
+	// decodes at most block_size entries.
+	// Entry layout: varint shared_prefix, varint suffix_size, suffix, varint id
+	class CompressedVocabulary
+	{
+	private:
+		static constexpr size_t block_size = 16;
+
+		std::vector<uint8_t> data_;
+		std::vector<uint32_t> block_offsets_;
+		std::vector<uint32_t> ranks_;	// id -> position in sorted order
+
+		static void put_varint(std::vector<uint8_t>& out, uint32_t value) {
+			while (value >= 0x80) {
+				out.push_back(static_cast<uint8_t>(value | 0x80));
+				value >>= 7;
+			}
+			out.push_back(static_cast<uint8_t>(value));
+		}
+
+		static uint32_t get_varint(const uint8_t*& p) {
+			uint32_t value = 0;
+			for (int shift = 0; ; shift += 7) {
+				uint8_t byte = *p++;
+				value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0) return value;
+			}
+		}
+
+		// First token of a block (stored with no shared prefix)
+		std::string_view block_head(size_t block) const {
+			const uint8_t* p = data_.data() + block_offsets_[block];
+			get_varint(p);
+			uint32_t size = get_varint(p);
+			return std::string_view(reinterpret_cast<const char*>(p), size);
+		}
+
+		size_t block_entries(size_t block) const {
+			return std::min(block_size, ranks_.size() - block * block_size);
+		}
+
+	public:
+		// Build from an id -> token table. Duplicate tokens resolve to the
+		// highest id, like repeated insertions into a map.
+		void build(const std::vector<std::string>& id_to_token) {
+			std::vector<uint32_t> order(id_to_token.size());
+			for (size_t i = 0; i < order.size(); ++i) {
+				order[i] = static_cast<uint32_t>(i);
+			}
+			std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+				int c = id_to_token[a].compare(id_to_token[b]);
+				return c != 0 ? c < 0 : a > b;
+			});
+
+			data_.clear();
+			block_offsets_.clear();
+			ranks_.assign(order.size(), 0);
+
+			std::string_view previous;
+			for (size_t rank = 0; rank < order.size(); ++rank) {
+				std::string_view token = id_to_token[order[rank]];
+				size_t shared = 0;
+				if (rank % block_size == 0) {
+					block_offsets_.push_back(static_cast<uint32_t>(data_.size()));
+				}
+				else {
+					size_t limit = std::min(previous.size(), token.size());
+					while (shared < limit && previous[shared] == token[shared]) shared++;
+				}
+
+				put_varint(data_, static_cast<uint32_t>(shared));
+				put_varint(data_, static_cast<uint32_t>(token.size() - shared));
+				data_.insert(data_.end(), token.begin() + shared, token.end());
+				put_varint(data_, order[rank]);
+
+				ranks_[order[rank]] = static_cast<uint32_t>(rank);
+				previous = token;
+			}
+
+			data_.shrink_to_fit();
+			block_offsets_.shrink_to_fit();
+		}
+
+		void clear() {
+			data_ = {};
+			block_offsets_ = {};
+			ranks_ = {};
+		}
+
+		size_t size() const { return ranks_.size(); }
+
+		// Find the id of token; false if it is not in the vocabulary
+		bool find(std::string_view token, int& id) const {
+			if (block_offsets_.empty()) return false;
+
+			// Last block whose head sorts before token
+			size_t lo = 0, hi = block_offsets_.size();
+			while (hi - lo > 1) {
+				size_t mid = (lo + hi) / 2;
+				if (block_head(mid) < token) lo = mid;
+				else hi = mid;
+			}
+
+			// Walk the block tracking how much of token the current entry
+			// matches. Entries increase, so an entry sharing less with its
+			// predecessor than the predecessor shared with token is already
+			// past it, and one sharing more is still before it.
+			const uint8_t* p = data_.data() + block_offsets_[lo];
+			size_t matched = 0;
+			for (size_t i = 0, n = block_entries(lo); i < n; ++i) {
+				size_t shared = get_varint(p);
+				size_t suffix_size = get_varint(p);
+				const char* suffix = reinterpret_cast<const char*>(p);
+				p += suffix_size;
+				uint32_t entry_id = get_varint(p);
+
+				if (i > 0 && shared < matched) return false;
+				if (i > 0 && shared > matched) continue;
+
+				size_t k = 0;
+				while (k < suffix_size && matched + k < token.size() && suffix[k] == token[matched + k]) k++;
+
+				if (k == suffix_size && matched + k == token.size()) {
+					id = static_cast<int>(entry_id);
+					return true;
+				}
+				if (k < suffix_size && (matched + k == token.size() ||
+					static_cast<unsigned char>(suffix[k]) > static_cast<unsigned char>(token[matched + k]))) {
+					return false;	// entry sorts after token
+				}
+				matched += k;
+			}
+
+			// token sorts after every entry of the block; it can only be the next head
+			if (lo + 1 < block_offsets_.size() && block_head(lo + 1) == token) {
+				const uint8_t* q = data_.data() + block_offsets_[lo + 1];
+				get_varint(q);
+				q += get_varint(q);
+				id = static_cast<int>(get_varint(q));
+				return true;
+			}
+			return false;
+		}
+
+		// Rebuild the token for id into out; false for ids out of range
+		bool token_into(int id, std::string& out) const {
+			if (id < 0 || static_cast<size_t>(id) >= ranks_.size()) return false;
+
+			size_t rank = ranks_[id];
+			const uint8_t* p = data_.data() + block_offsets_[rank / block_size];
+			out.clear();
+			for (size_t i = 0; i <= rank % block_size; ++i) {
+				size_t shared = get_varint(p);
+				size_t suffix_size = get_varint(p);
+				out.resize(shared);
+				out.append(reinterpret_cast<const char*>(p), suffix_size);
+				p += suffix_size;
+				get_varint(p);
+			}
+			return true;
+		}
+
+		size_t memory_usage() const {
+			return data_.capacity() + block_offsets_.capacity() * sizeof(uint32_t) + ranks_.capacity() * sizeof(uint32_t);
+		}
+	};
+
+	// Set of ASCII bytes the scanner splits on: a 256-entry table for scalar
+	// code plus a nibble bitmap for the SIMD kernels (a byte b < 0x80 is in
+	// the set iff bit b >> 4 of nibbles[b & 15] is set)
+	struct ByteSet {
+		bool contains[256] = {};
+		alignas(16) uint8_t nibbles[16] = {};
+
+		void insert(unsigned char c) {
+			contains[c] = true;
+			if (c < 0x80) nibbles[c & 15] |= static_cast<uint8_t>(1u << (c >> 4));
+		}
+	};
+
+	// Scanner, lowercase, normalization quick-check and vocabulary hash
+	// kernels in several x86-64 ISA levels, selected once per process from
+	// CPUID. The MTT_ISA environment variable (scalar, v2, v3 or v4) caps the
+	// level for testing; it never raises it above what the CPU supports.
+	namespace Kernels
+	{
+		// v2: SSSE3 + SSE4.2, v3: AVX2, v4: AVX-512BW
+		enum class IsaLevel { scalar, v2, v3, v4 };
+
+		inline const char* isa_name(IsaLevel level) {
+			switch (level) {
+			case IsaLevel::v2: return "v2";
+			case IsaLevel::v3: return "v3";
+			case IsaLevel::v4: return "v4";
+			default: return "scalar";
+			}
+		}
+
+		// First index >= from whose byte is non-ASCII or in set, or n
+		inline size_t find_special_scalar(const char* data, size_t from, size_t n, const ByteSet& set) {
+			for (; from < n; ++from) {
+				unsigned char c = data[from];
+				if ((c & 0x80) != 0 || set.contains[c]) break;
+			}
+			return from;
+		}
+
+		// Copies the leading ASCII run of src to dst with A-Z lowercased and
+		// returns its length
+		inline size_t lower_ascii_scalar(const char* src, size_t n, char* dst) {
+			size_t i = 0;
+			for (; i < n; ++i) {
+				unsigned char c = src[i];
+				if ((c & 0x80) != 0) break;
+				dst[i] = static_cast<char>(static_cast<unsigned>(c - 'A') < 26 ? c | 0x20 : c);
+			}
+			return i;
+		}
+
+		// Length of the leading run of bytes below limit
+		inline size_t prefix_below_scalar(const char* data, size_t n, unsigned char limit) {
+			size_t i = 0;
+			while (i < n && static_cast<unsigned char>(data[i]) < limit) ++i;
+			return i;
+		}
+
+		inline size_t hash_scalar(const char* data, size_t n) {
+			return std::hash<std::string_view>{}(std::string_view(data, n));
+		}
+
+#ifdef MTT_X86_64
+		MTT_TARGET("ssse3")
+		inline size_t find_special_v2(const char* data, size_t from, size_t n, const ByteSet& set) {
+			const __m128i nibbles = _mm_load_si128(reinterpret_cast<const __m128i*>(set.nibbles));
+			const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+			const __m128i low = _mm_set1_epi8(0x0F);
+			for (; from + 16 <= n; from += 16) {
+				__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + from));
+				__m128i row = _mm_shuffle_epi8(nibbles, _mm_and_si128(bytes, low));
+				__m128i bit = _mm_shuffle_epi8(bits, _mm_and_si128(_mm_srli_epi16(bytes, 4), low));
+				__m128i outside = _mm_cmpeq_epi8(_mm_and_si128(row, bit), _mm_setzero_si128());
+				unsigned mask = (_mm_movemask_epi8(outside) ^ 0xFFFFu) | _mm_movemask_epi8(bytes);
+				if (mask) return from + detail::count_trailing_zeros(mask);
+			}
+			return find_special_scalar(data, from, n, set);
+		}
+
+		MTT_TARGET("avx2")
+		inline size_t find_special_v3(const char* data, size_t from, size_t n, const ByteSet& set) {
+			const __m256i nibbles = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(set.nibbles)));
+			const __m256i bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0,
+				1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+			const __m256i low = _mm256_set1_epi8(0x0F);
+			for (; from + 32 <= n; from += 32) {
+				__m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + from));
+				__m256i row = _mm256_shuffle_epi8(nibbles, _mm256_and_si256(bytes, low));
+				__m256i bit = _mm256_shuffle_epi8(bits, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), low));
+				__m256i outside = _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), _mm256_setzero_si256());
+				uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(outside)) | static_cast<uint32_t>(_mm256_movemask_epi8(bytes));
+				if (mask) return from + detail::count_trailing_zeros(mask);
+			}
+			return find_special_v2(data, from, n, set);
+		}
+
+		// Same 16 bytes in every lane. The zero-masking form with a full mask
+		// is the same instruction, but unlike _mm512_broadcast_i32x4 its GCC
+		// header does not pass an undefined vector that trips -Wuninitialized.
+		MTT_TARGET("avx512f")
+		inline __m512i broadcast_lanes(__m128i v) {
+			return _mm512_maskz_broadcast_i32x4(0xFFFF, v);
+		}
+
+		MTT_TARGET("avx512f,avx512bw")
+		inline size_t find_special_v4(const char* data, size_t from, size_t n, const ByteSet& set) {
+			const __m512i nibbles = broadcast_lanes(_mm_load_si128(reinterpret_cast<const __m128i*>(set.nibbles)));
+			const __m512i bits = broadcast_lanes(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0));
+			const __m512i low = _mm512_set1_epi8(0x0F);
+			for (; from + 64 <= n; from += 64) {
+				__m512i bytes = _mm512_loadu_si512(data + from);
+				__m512i row = _mm512_shuffle_epi8(nibbles, _mm512_and_si512(bytes, low));
+				__m512i bit = _mm512_shuffle_epi8(bits, _mm512_and_si512(_mm512_srli_epi16(bytes, 4), low));
+				uint64_t mask = _mm512_test_epi8_mask(row, bit) | _mm512_movepi8_mask(bytes);
+				if (mask) return from + detail::count_trailing_zeros(mask);
+			}
+			return find_special_v3(data, from, n, set);
+		}
+
+		MTT_TARGET("ssse3")
+		inline size_t lower_ascii_v2(const char* src, size_t n, char* dst) {
+			const __m128i shift = _mm_set1_epi8(static_cast<char>(0x80 - 'A'));
+			const __m128i limit = _mm_set1_epi8(static_cast<char>(-128 + 26));
+			const __m128i case_bit = _mm_set1_epi8(0x20);
+			size_t i = 0;
+			for (; i + 16 <= n; i += 16) {
+				__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				if (_mm_movemask_epi8(bytes)) break;
+				__m128i upper = _mm_cmplt_epi8(_mm_add_epi8(bytes, shift), limit);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_or_si128(bytes, _mm_and_si128(upper, case_bit)));
+			}
+			return i + lower_ascii_scalar(src + i, n - i, dst + i);
+		}
+
+		MTT_TARGET("avx2")
+		inline size_t lower_ascii_v3(const char* src, size_t n, char* dst) {
+			const __m256i shift = _mm256_set1_epi8(static_cast<char>(0x80 - 'A'));
+			const __m256i limit = _mm256_set1_epi8(static_cast<char>(-128 + 26));
+			const __m256i case_bit = _mm256_set1_epi8(0x20);
+			size_t i = 0;
+			for (; i + 32 <= n; i += 32) {
+				__m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				if (_mm256_movemask_epi8(bytes)) break;
+				__m256i upper = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(bytes, shift));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_or_si256(bytes, _mm256_and_si256(upper, case_bit)));
+			}
+			return i + lower_ascii_v2(src + i, n - i, dst + i);
+		}
+
+		MTT_TARGET("avx512f,avx512bw")
+		inline size_t lower_ascii_v4(const char* src, size_t n, char* dst) {
+			const __m512i first = _mm512_set1_epi8('A');
+			const __m512i range = _mm512_set1_epi8(26);
+			const __m512i case_bit = _mm512_set1_epi8(0x20);
+			size_t i = 0;
+			for (; i + 64 <= n; i += 64) {
+				__m512i bytes = _mm512_loadu_si512(src + i);
+				if (_mm512_movepi8_mask(bytes)) break;
+				__mmask64 upper = _mm512_cmplt_epu8_mask(_mm512_sub_epi8(bytes, first), range);
+				_mm512_storeu_si512(dst + i, _mm512_mask_blend_epi8(upper, bytes, _mm512_or_si512(bytes, case_bit)));
+			}
+			return i + lower_ascii_v3(src + i, n - i, dst + i);
+		}
+
+		inline size_t prefix_below_v2(const char* data, size_t n, unsigned char limit) {
+			const __m128i bound = _mm_set1_epi8(static_cast<char>(limit));
+			size_t i = 0;
+			for (; i + 16 <= n; i += 16) {
+				__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(bytes, bound), bytes));
+				if (mask) return i + detail::count_trailing_zeros(mask);
+			}
+			return i + prefix_below_scalar(data + i, n - i, limit);
+		}
+
+		MTT_TARGET("avx2")
+		inline size_t prefix_below_v3(const char* data, size_t n, unsigned char limit) {
+			const __m256i bound = _mm256_set1_epi8(static_cast<char>(limit));
+			size_t i = 0;
+			for (; i + 32 <= n; i += 32) {
+				__m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+				uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(bytes, bound), bytes)));
+				if (mask) return i + detail::count_trailing_zeros(mask);
+			}
+			return i + prefix_below_v2(data + i, n - i, limit);
+		}
+
+		MTT_TARGET("avx512f,avx512bw")
+		inline size_t prefix_below_v4(const char* data, size_t n, unsigned char limit) {
+			const __m512i bound = _mm512_set1_epi8(static_cast<char>(limit));
+			size_t i = 0;
+			for (; i + 64 <= n; i += 64) {
+				uint64_t mask = _mm512_cmpge_epu8_mask(_mm512_loadu_si512(data + i), bound);
+				if (mask) return i + detail::count_trailing_zeros(mask);
+			}
+			return i + prefix_below_v3(data + i, n - i, limit);
+		}
+
+		// CRC32C over 8-byte words, scrambled so the low bits are usable on
+		// their own. Only used within one process, so it needs no portability.
+		MTT_TARGET("sse4.2")
+		inline size_t hash_crc32(const char* data, size_t n) {
+			uint64_t crc = n;
+			size_t i = 0;
+			for (; i + 8 <= n; i += 8) {
+				uint64_t word;
+				std::memcpy(&word, data + i, 8);
+				crc = _mm_crc32_u64(crc, word);
+			}
+			if (i < n) {
+				uint64_t word = 0;
+				std::memcpy(&word, data + i, n - i);
+				crc = _mm_crc32_u64(crc, word);
+			}
+			return static_cast<size_t>(crc * 0x9E3779B97F4A7C15ull);
+		}
+
+		inline bool cpu_supports(IsaLevel level) {
+#if defined(__GNUC__) || defined(__clang__)
+			switch (level) {
+			case IsaLevel::v2: return __builtin_cpu_supports("ssse3") && __builtin_cpu_supports("sse4.2");
+			case IsaLevel::v3: return cpu_supports(IsaLevel::v2) && __builtin_cpu_supports("avx2");
+			case IsaLevel::v4: return cpu_supports(IsaLevel::v3) && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+			default: return true;
+			}
+#elif defined(_MSC_VER)
+			int leaf1[4], leaf7[4];
+			__cpuid(leaf1, 1);
+			__cpuidex(leaf7, 7, 0);
+			bool v2 = (leaf1[2] & (1 << 9)) != 0 && (leaf1[2] & (1 << 20)) != 0;
+			// The OS must save the YMM (and for AVX-512 the ZMM) state
+			uint64_t xcr0 = (leaf1[2] & (1 << 27)) != 0 ? _xgetbv(0) : 0;
+			bool v3 = v2 && (xcr0 & 0x6) == 0x6 && (leaf7[1] & (1 << 5)) != 0;
+			bool v4 = v3 && (xcr0 & 0xE6) == 0xE6 && (leaf7[1] & (1 << 16)) != 0 && (leaf7[1] & (1 << 30)) != 0;
+			switch (level) {
+			case IsaLevel::v2: return v2;
+			case IsaLevel::v3: return v3;
+			case IsaLevel::v4: return v4;
+			default: return true;
+			}
+#else
+			return level == IsaLevel::scalar;
+#endif
+		}
+#else
+		inline bool cpu_supports(IsaLevel level) {
+			return level == IsaLevel::scalar;
+		}
+#endif
+
+		struct Table {
+			IsaLevel level;
+			size_t(*find_special)(const char* data, size_t from, size_t n, const ByteSet& set);
+			size_t(*lower_ascii)(const char* src, size_t n, char* dst);
+			size_t(*prefix_below)(const char* data, size_t n, unsigned char limit);
+			size_t(*hash)(const char* data, size_t n);
+		};
+
+		// Kernels of the given level, or of the highest supported level below it
+		inline Table table_for(IsaLevel level) {
+			while (level != IsaLevel::scalar && !cpu_supports(level)) {
+				level = static_cast<IsaLevel>(static_cast<int>(level) - 1);
+			}
+			switch (level) {
+#ifdef MTT_X86_64
+			case IsaLevel::v4: return { level, find_special_v4, lower_ascii_v4, prefix_below_v4, hash_crc32 };
+			case IsaLevel::v3: return { level, find_special_v3, lower_ascii_v3, prefix_below_v3, hash_crc32 };
+			case IsaLevel::v2: return { level, find_special_v2, lower_ascii_v2, prefix_below_v2, hash_crc32 };
+#endif
+			default: return { IsaLevel::scalar, find_special_scalar, lower_ascii_scalar, prefix_below_scalar, hash_scalar };
+			}
+		}
+
+		inline IsaLevel requested_level() {
+#if defined(_MSC_VER)
+#pragma warning(suppress: 4996)
+#endif
+			const char* value = std::getenv("MTT_ISA");
+			if (value == nullptr) return IsaLevel::v4;
+			std::string_view name(value);
+			if (name == "scalar") return IsaLevel::scalar;
+			if (name == "v2") return IsaLevel::v2;
+			if (name == "v3") return IsaLevel::v3;
+			return IsaLevel::v4;
+		}
+
+		// The process-wide kernels. Never changes once selected, so hashes
+		// stay consistent for the lifetime of every vocabulary map.
+		inline const Table& active() {
+			static const Table table = table_for(requested_level());
+			return table;
+		}
+
+		inline IsaLevel active_isa() {
+			return active().level;
+		}
+	}
+
+	// Approximate heap footprint of a TextTokenizer, by structure. Node sizes
+	// assume a typical node-based unordered_map (next pointer, cached hash,
+	// value); allocator rounding is not included.
+	struct TokenizerMemoryUsage {
+		size_t object = 0;			// sizeof(TextTokenizer)
+		size_t vocab_buckets = 0;	// vocab_to_id_ bucket array
+		size_t vocab_nodes = 0;		// vocab_to_id_ nodes
+		size_t vocab_strings = 0;	// heap text of vocab_to_id_ keys (beyond SSO)
+		size_t id_table = 0;		// id_to_vocab_ array of std::string
+		size_t id_strings = 0;		// heap text of id_to_vocab_ entries (beyond SSO)
+		size_t special_tokens = 0;	// heap text of the special token names
+		size_t compressed_vocab = 0;	// CompressedVocabulary, after compress_vocab()
+		size_t encode_cache = 0;	// attached EncodeCache (may be shared)
+
+		size_t total() const {
+			return object + vocab_buckets + vocab_nodes + vocab_strings + id_table + id_strings +
+				special_tokens + compressed_vocab + encode_cache;
+		}
+	};
+
+	// Unicode normalization form applied to tokens (UAX #15)
+	enum class NormalizationForm { none, nfc, nfd, nfkc };
+
+	// Parse "none", "nfc", "nfd" or "nfkc" (command-line options)
+	inline bool parse_normalization_form(std::string_view name, NormalizationForm& form) {
+		if (name == "none") form = NormalizationForm::none;
+		else if (name == "nfc") form = NormalizationForm::nfc;
+		else if (name == "nfd") form = NormalizationForm::nfd;
+		else if (name == "nfkc") form = NormalizationForm::nfkc;
+		else return false;
+		return true;
+	}
+
+	class TextTokenizer
+	{
+	private:
+		ByteSet delimiters_;
+		ByteSet split_set_;	// delimiters_ plus punctuation when split_on_punctuation_
+		bool lowercase_;
+		NormalizationForm normalization_;
+		bool keep_punctuation_;
+		bool split_on_punctuation_;
+
+		// Hashes std::string and std::string_view alike, so tokens can be
+		// looked up without materializing a std::string
+		struct VocabHash {
+			using is_transparent = void;
+			size_t operator()(std::string_view token) const {
+				return Kernels::active().hash(token.data(), token.size());
+			}
+		};
+
+		// Vocabulary support
+		std::unordered_map<std::string, int, VocabHash, std::equal_to<>> vocab_to_id_;
+		std::vector<std::string> id_to_vocab_;
+		// When compressed_vocab_ is set, the vocabulary lives only in
+		// compressed_ and both maps above are empty
+		CompressedVocabulary compressed_;
+		bool compressed_vocab_ = false;
+		std::string unk_token_;
+		std::string pad_token_;
+		std::string cls_token_;
+		std::string sep_token_;
+		bool use_vocab_;
+		int unk_id_;
+		int pad_id_;
+		int cls_id_;
+		int sep_id_;
+
+		// Async API: inputs below this many bytes are encoded inline
+		size_t async_inline_threshold_;
+
+		// Optional encode result cache. config_fingerprint_ hashes everything
+		// that affects encode output, so identically configured tokenizers
+		// share entries and entries of any other config can never be hit.
+		std::shared_ptr<EncodeCache> encode_cache_;
+		uint64_t vocab_hash_ = 0;
+		uint64_t config_fingerprint_ = 0;
+
+		void config_changed() {
+			const int64_t fields[] = { lowercase_, keep_punctuation_, split_on_punctuation_,
+				static_cast<int>(normalization_), use_vocab_, unk_id_, pad_id_, cls_id_, sep_id_ };
+			uint64_t h = EncodeCache::hash(std::string_view(reinterpret_cast<const char*>(fields), sizeof(fields)), vocab_hash_);
+			h = EncodeCache::hash(std::string_view(reinterpret_cast<const char*>(delimiters_.contains), sizeof(delimiters_.contains)), h);
+			for (const std::string* token : { &unk_token_, &pad_token_, &cls_token_, &sep_token_ }) {
+				h = EncodeCache::hash(*token, h);
+			}
+			config_fingerprint_ = h;
+		}
+
+		// Hash the vocabulary in id order, then refresh the fingerprint
+		void vocab_changed() {
+			uint64_t h = id_to_vocab_.size();
+			for (const auto& token : id_to_vocab_) {
+				h = EncodeCache::hash(token, h);
+			}
+			vocab_hash_ = h;
+			config_changed();
+		}
+
+		// UTF-8 helper functions
+		static bool is_utf8_start(unsigned char c) {
+			return (c & 0x80) == 0 || (c & 0xE0) == 0xC0 ||
+				(c & 0xF0) == 0xE0 || (c & 0xF8) == 0xF0;
+		}
+
+		static size_t utf8_char_length(unsigned char c) {
+			if ((c & 0x80) == 0) return 1;      // 0xxxxxxx
+			if ((c & 0xE0) == 0xC0) return 2;   // 110xxxxx
+			if ((c & 0xF0) == 0xE0) return 3;   // 1110xxxx
+			if ((c & 0xF8) == 0xF0) return 4;   // 11110xxx
+			// Invalid, treat as single byte
+			return 1;
+		}
+
+		// Decode the UTF-8 sequence starting at text[i]. False for truncated,
+		// overlong or otherwise malformed sequences.
+		static bool decode_utf8(std::string_view text, size_t i, char32_t& cp, size_t& len) {
+			unsigned char c = text[i];
+			len = utf8_char_length(c);
+			if (len == 1 || i + len > text.size()) return false;
+
+			cp = c & (0x7F >> len);
+			for (size_t k = 1; k < len; ++k) {
+				unsigned char next = text[i + k];
+				if ((next & 0xC0) != 0x80) return false;
+				cp = (cp << 6) | (next & 0x3F);
+			}
+			static const char32_t min_cp[] = { 0, 0, 0x80, 0x800, 0x10000 };
+			return cp >= min_cp[len] && cp <= 0x10FFFF;
+		}
+
+		// Malformed bytes pass through normalization as these pseudo code
+		// points: no decomposition, combining class 0, never composed
+		static constexpr char32_t malformed_byte = 0x110000;
+
+		// Hangul syllables decompose and compose algorithmically
+		static constexpr char32_t hangul_first = 0xAC00, jamo_l = 0x1100, jamo_v = 0x1161, jamo_t = 0x11A7;
+		static constexpr char32_t jamo_l_count = 19, jamo_v_count = 21, jamo_t_count = 28, hangul_count = 11172;
+
+		// Quick-check flags that fail form
+		static uint8_t quick_check_reject(NormalizationForm form) {
+			switch (form) {
+			case NormalizationForm::nfc: return static_cast<uint8_t>(UnicodeTables::nfc_no | UnicodeTables::nfc_maybe);
+			case NormalizationForm::nfkc: return static_cast<uint8_t>(UnicodeTables::nfkc_no | UnicodeTables::nfkc_maybe);
+			default: return UnicodeTables::nfd_no;
+			}
+		}
+
+		// Length of the leading part of text that is already in form and
+		// ends before a starter that later text cannot combine with, so only
+		// the rest needs normalizing. Bytes that cannot start a character
+		// with a quick check other than Yes are skipped with the SIMD kernel.
+		static size_t normalized_prefix(std::string_view text, NormalizationForm form) {
+			const uint8_t reject = quick_check_reject(form);
+			const unsigned char safe = form == NormalizationForm::nfc ? UnicodeTables::nfc_safe_byte :
+				form == NormalizationForm::nfkc ? UnicodeTables::nfkc_safe_byte : UnicodeTables::nfd_safe_byte;
+			const auto prefix_below = Kernels::active().prefix_below;
+
+			size_t i = 0;
+			size_t last_starter = 0;
+			uint8_t last_ccc = 0;
+			while (i < text.size()) {
+				size_t run = prefix_below(text.data() + i, text.size() - i, safe);
+				if (run > 0) {
+					// Only starters below the safe byte; remember the last one
+					i += run;
+					last_starter = i - 1;
+					while (last_starter > i - run && (static_cast<unsigned char>(text[last_starter]) & 0xC0) == 0x80) {
+						last_starter--;
+					}
+					last_ccc = 0;
+					if (i >= text.size()) break;
+				}
+
+				char32_t cp;
+				size_t len;
+				if (!decode_utf8(text, i, cp, len)) {
+					last_starter = i++;
+					last_ccc = 0;
+					continue;
+				}
+				uint16_t info = UnicodeTables::normalization_info(cp);
+				uint8_t ccc = static_cast<uint8_t>(info);
+				if (((info >> 8) & reject) != 0 || (ccc != 0 && last_ccc > ccc)) return last_starter;
+				if (ccc == 0) last_starter = i;
+				last_ccc = ccc;
+				i += len;
+			}
+			return text.size();
+		}
+
+		// Append the full decomposition of cp to buffer, keeping combining
+		// marks in canonical order
+		static void append_decomposition(char32_t cp, bool compat, std::u32string& buffer) {
+			char32_t hangul[3];
+			const char32_t* parts = &cp;
+			size_t count = 1;
+			if (cp - hangul_first < hangul_count) {
+				char32_t index = cp - hangul_first;
+				hangul[0] = jamo_l + index / (jamo_v_count * jamo_t_count);
+				hangul[1] = jamo_v + index % (jamo_v_count * jamo_t_count) / jamo_t_count;
+				hangul[2] = jamo_t + index % jamo_t_count;
+				parts = hangul;
+				count = hangul[2] == jamo_t ? 2 : 3;
+			}
+			else if ((UnicodeTables::normalization_info(cp) >> 8) & (compat ? UnicodeTables::nfkd_no : UnicodeTables::nfd_no)) {
+				const char32_t* mapping;
+				size_t length = UnicodeTables::decomposition(cp, compat, mapping);
+				if (length > 0) {
+					parts = mapping;
+					count = length;
+				}
+			}
+
+			for (size_t k = 0; k < count; ++k) {
+				uint8_t ccc = UnicodeTables::combining_class(parts[k]);
+				size_t at = buffer.size();
+				buffer.push_back(parts[k]);
+				if (ccc == 0) continue;
+				// Stable insertion before marks of a higher class
+				while (at > 0 && UnicodeTables::combining_class(buffer[at - 1]) > ccc) {
+					buffer[at] = buffer[at - 1];
+					at--;
+				}
+				buffer[at] = parts[k];
+			}
+		}
+
+		// Primary composite of first and second (Hangul included), or 0
+		static char32_t compose_pair(char32_t first, char32_t second) {
+			if (first - jamo_l < jamo_l_count && second - jamo_v < jamo_v_count) {
+				return hangul_first + ((first - jamo_l) * jamo_v_count + (second - jamo_v)) * jamo_t_count;
+			}
+			if (first - hangul_first < hangul_count && (first - hangul_first) % jamo_t_count == 0 &&
+				second - jamo_t - 1 < jamo_t_count - 1) {
+				return first + (second - jamo_t);
+			}
+			if (first >= malformed_byte || second >= malformed_byte) return 0;
+			return UnicodeTables::composition(first, second);
+		}
+
+		// Canonical composition of a decomposed, canonically ordered buffer
+		static void compose(std::u32string& buffer) {
+			if (buffer.empty()) return;
+			size_t starter = 0;
+			// A leading non-starter has nothing to compose with
+			int last_ccc = UnicodeTables::combining_class(buffer[0]) == 0 ? 0 : 256;
+			size_t out = 1;
+			for (size_t i = 1; i < buffer.size(); ++i) {
+				char32_t cp = buffer[i];
+				uint16_t info = UnicodeTables::normalization_info(cp);
+				int ccc = static_cast<uint8_t>(info);
+				// Only NFC quick check Maybe characters compose with a previous one
+				char32_t composite = ((info >> 8) & UnicodeTables::nfc_maybe) && (last_ccc < ccc || last_ccc == 0) ?
+					compose_pair(buffer[starter], cp) : 0;
+				if (composite != 0) {
+					buffer[starter] = composite;
+					continue;
+				}
+				if (ccc == 0) starter = out;
+				last_ccc = ccc;
+				buffer[out++] = cp;
+			}
+			buffer.resize(out);
+		}
+
+		// True if a span to normalize on its own can start at text[i]: ASCII,
+		// a malformed byte, or a starter that passes the quick check
+		static bool is_stable_boundary(std::string_view text, size_t i, uint8_t reject) {
+			char32_t cp;
+			size_t len;
+			if ((static_cast<unsigned char>(text[i]) & 0x80) == 0 || !decode_utf8(text, i, cp, len)) return true;
+			uint16_t info = UnicodeTables::normalization_info(cp);
+			return static_cast<uint8_t>(info) == 0 && ((info >> 8) & reject) == 0;
+		}
+
+		// Append text normalized to form to out, given that the first done
+		// bytes need no change (see normalized_prefix). Only the spans that
+		// fail the quick check, from their last starter up to the next
+		// stable boundary, are decomposed, reordered and (for NFC and NFKC)
+		// recomposed; the text between them is copied.
+		template<typename String>
+		static void append_normalized(std::string_view text, size_t done, NormalizationForm form, String& out) {
+			thread_local std::u32string buffer;
+			const uint8_t reject = quick_check_reject(form);
+			const bool compat = form == NormalizationForm::nfkc;
+			char bytes[4];
+
+			while (true) {
+				out.append(text.data(), done);
+				if (done == text.size()) return;
+				text.remove_prefix(done);
+
+				buffer.clear();
+				size_t i = 0;
+				do {
+					char32_t cp;
+					size_t len;
+					if ((static_cast<unsigned char>(text[i]) & 0x80) == 0) {
+						buffer.push_back(static_cast<unsigned char>(text[i++]));
+					}
+					else if (decode_utf8(text, i, cp, len)) {
+						append_decomposition(cp, compat, buffer);
+						i += len;
+					}
+					else {
+						buffer.push_back(malformed_byte + static_cast<unsigned char>(text[i++]));
+					}
+				} while (i < text.size() && !is_stable_boundary(text, i, reject));
+				if (form != NormalizationForm::nfd) compose(buffer);
+
+				for (char32_t cp : buffer) {
+					if (cp >= malformed_byte) {
+						out.push_back(static_cast<char>(cp - malformed_byte));
+					}
+					else {
+						out.append(bytes, detail::encode_utf8(cp, bytes));
+					}
+				}
+				text.remove_prefix(i);
+				done = normalized_prefix(text, form);
+			}
+		}
+
+		// Check if character is ASCII punctuation
+		static bool is_ascii_punct(char c) {
+			return std::ispunct(static_cast<unsigned char>(c));
+		}
+
+		// Normalize a token (Unicode normalization, then lowercase and
+		// case-fold, as enabled)
+		std::string normalize_token(std::string_view token) const {
+			std::string result;
+			normalize_token_into(token, result);
+			return result;
+		}
+
+		// Normalize a token into an existing buffer (reuses its capacity).
+		// String is std::string or std::pmr::string.
+		template<typename String>
+		void normalize_token_into(std::string_view token, String& result) const {
+			result.clear();
+			if (normalization_ != NormalizationForm::none) {
+				size_t done = normalized_prefix(token, normalization_);
+				if (done < token.size()) {
+					if (!lowercase_) {
+						append_normalized(token, done, normalization_, result);
+						return;
+					}
+					thread_local std::string normalized;
+					normalized.clear();
+					append_normalized(token, done, normalization_, normalized);
+					lowercase_into(normalized, result);
+					return;
+				}
+			}
+			if (!lowercase_) {
+				result.append(token.data(), token.size());
+				return;
+			}
+			lowercase_into(token, result);
+		}
+
+		// Lowercase token into an empty result: ASCII with the SIMD kernel,
+		// everything else with Unicode simple case folding
+		template<typename String>
+		void lowercase_into(std::string_view token, String& result) const {
+			// Pure ASCII - lowercased in bulk
+			result.resize(token.size());
+			const auto lower_ascii = Kernels::active().lower_ascii;
+			size_t i = lower_ascii(token.data(), token.size(), result.data());
+			if (i == token.size()) return;
+
+			// Folding can change the byte length of a character (U+017F to
+			// 's', U+023A to U+2C65), so result always has room for the rest
+			// of the token copied as-is and grows only when a fold does
+			size_t o = i;
+			while (i < token.size()) {
+				// Two-byte Latin, Greek, Cyrillic or Armenian folding to
+				// another two-byte character - straight from the direct table
+				unsigned char c = token[i];
+				char32_t direct = 0;
+				if (c >= 0xC2 && static_cast<uint32_t>(c) < 0xC0 + (UnicodeTables::fold_direct_limit >> 6) && i + 1 < token.size() &&
+					(static_cast<unsigned char>(token[i + 1]) & 0xC0) == 0x80) {
+					direct = UnicodeTables::fold_direct[(((c & 0x1F) << 6) | (token[i + 1] & 0x3F)) - 0x80];
+				}
+				if (direct >= 0x80 && direct < 0x800) {
+					result[o] = static_cast<char>(0xC0 | (direct >> 6));
+					result[o + 1] = static_cast<char>(0x80 | (direct & 0x3F));
+					i += 2;
+					o += 2;
+				}
+				else {
+					// Other multi-byte UTF-8 - simple case folding; malformed
+					// sequences and characters without a folding are copied as-is
+					char32_t cp = 0;
+					size_t len;
+					char32_t folded = decode_utf8(token, i, cp, len) ? UnicodeTables::simple_fold(cp) : cp;
+					len = std::min(len, token.size() - i);
+					if (folded == cp) {
+						std::memcpy(result.data() + o, token.data() + i, len);
+						i += len;
+						o += len;
+					}
+					else {
+						char bytes[4];
+						size_t folded_len = detail::encode_utf8(folded, bytes);
+						i += len;
+						if (o + folded_len + (token.size() - i) > result.size()) {
+							result.resize(o + folded_len + (token.size() - i));
+						}
+						std::memcpy(result.data() + o, bytes, folded_len);
+						o += folded_len;
+					}
+				}
+
+				// ASCII run - lowercased in bulk
+				size_t run = lower_ascii(token.data() + i, token.size() - i, result.data() + o);
+				i += run;
+				o += run;
+			}
+			result.resize(o);
+		}
+
+		// Check if we should split at this position
+		bool should_split_at(char c) const {
+			return split_set_.contains[static_cast<unsigned char>(c)];
+		}
+
+		// Byte length of the character at text[i], whether it splits tokens
+		// and whether it is punctuation kept as its own token. Non-ASCII
+		// characters are classified with the Unicode tables; malformed
+		// sequences never split.
+		struct CharInfo {
+			size_t length;
+			bool split;
+			bool keep;
+		};
+
+		CharInfo char_info(std::string_view text, size_t i) const {
+			unsigned char c = text[i];
+			if ((c & 0x80) == 0) {
+				return { 1, should_split_at(c), keep_punctuation_ && is_ascii_punct(c) };
+			}
+
+			size_t len = utf8_char_length(c);
+			if (len == 1 || i + len > text.size()) return { len, false, false };
+
+			// Most characters are neither whitespace nor punctuation, so look
+			// the class up first and validate the sequence only if it matters
+			char32_t cp = c & (0x7F >> len);
+			for (size_t k = 1; k < len; ++k) {
+				cp = (cp << 6) | (static_cast<unsigned char>(text[i + k]) & 0x3F);
+			}
+			auto cls = UnicodeTables::char_class(cp);
+			if (cls == UnicodeTables::other) return { len, false, false };
+
+			char32_t decoded;
+			if (!decode_utf8(text, i, decoded, len)) return { len, false, false };
+			bool punct = cls == UnicodeTables::punctuation;
+			return { len, cls == UnicodeTables::whitespace || (punct && split_on_punctuation_), punct && keep_punctuation_ };
+		}
+
+		// First position at or after i that is ASCII, the end of text, or
+		// possibly Unicode whitespace (or punctuation, if split_punctuation).
+		// Kept branch-light: one table load and a bit test per character.
+		static size_t skip_unicode_word(std::string_view text, size_t i, bool split_punctuation) {
+			const uint64_t punctuation = split_punctuation ? ~uint64_t(0) : 0;
+			while (i < text.size()) {
+				unsigned char c = text[i];
+				if ((c & 0x80) == 0) break;
+				size_t len = utf8_char_length(c);
+				if (len > 1 && i + len <= text.size()) {
+					// All bytes but the last pick the block of 64 code points
+					uint32_t block = c & (0x7F >> len);
+					for (size_t k = 1; k + 1 < len; ++k) {
+						block = (block << 6) | (static_cast<unsigned char>(text[i + k]) & 0x3F);
+					}
+					uint8_t index = UnicodeTables::block_index(block);
+					uint64_t split = UnicodeTables::whitespace_masks[index] | (UnicodeTables::punctuation_masks[index] & punctuation);
+					if ((split >> (static_cast<unsigned char>(text[i + len - 1]) & 0x3F)) & 1) break;
+				}
+				i += len;
+			}
+			return i;
+		}
+
+		void update_split_set() {
+			split_set_ = delimiters_;
+			if (split_on_punctuation_) {
+				for (int c = 0; c < 0x80; ++c) {
+					if (is_ascii_punct(static_cast<char>(c))) split_set_.insert(static_cast<unsigned char>(c));
+				}
+			}
+		}
+
+		// Core scanner: calls emit(std::string_view) for every raw token in order
+		template<typename Emit>
+		void scan_tokens(std::string_view text, Emit&& emit) const {
+			const auto find_special = Kernels::active().find_special;
+			size_t start = 0;
+			size_t i = 0;
+
+			while (i < text.size()) {
+				unsigned char c = text[i];
+
+				// ASCII word character - skip the rest of the ASCII word in bulk
+				if ((c & 0x80) == 0 && !should_split_at(c)) {
+					i = find_special(text.data(), i + 1, text.size(), split_set_);
+					continue;
+				}
+
+				// Skip a run of multibyte characters that cannot split
+				if ((c & 0x80) != 0) {
+					size_t next = skip_unicode_word(text, i, split_on_punctuation_);
+					if (next != i) {
+						i = next;
+						continue;
+					}
+				}
+
+				// Delimiter, or a UTF-8 multibyte character
+				CharInfo ch = char_info(text, i);
+				if (!ch.split) {
+					i += ch.length;
+					continue;
+				}
+
+				// Add token if we have content
+				if (i > start) {
+					auto token_view = text.substr(start, i - start);
+					if (!token_view.empty()) {
+						emit(token_view);
+					}
+				}
+
+				// Add punctuation as separate token if keeping it
+				if (ch.keep) {
+					emit(text.substr(i, ch.length));
+				}
+
+				// Skip whitespace, find next non-delimiter
+				while (i < text.size() && (ch = char_info(text, i)).split) {
+					// If we're keeping punctuation, add each punct char
+					if (ch.keep && i > start + (i - start > 0 ? 1 : 0)) {
+						emit(text.substr(i, ch.length));
+					}
+					i += ch.length;
+				}
+				start = i;
+			}
+
+			// Add final token if any
+			if (start < text.size()) {
+				auto token_view = text.substr(start);
+				if (!token_view.empty()) {
+					emit(token_view);
+				}
+			}
+		}
+
+		// True if the text can be cut right before position k without changing
+		// the token sequence: k must follow a delimiter (ASCII or Unicode) and
+		// start a token at a valid UTF-8 lead byte, and no malformed lead byte
+		// shortly before may make the scanner jump over the delimiter.
+		bool is_token_boundary(std::string_view text, size_t k) const {
+			if (k == 0 || k >= text.size()) return false;
+
+			unsigned char next = text[k];
+			if ((next & 0xC0) == 0x80 || char_info(text, k).split) return false;
+
+			// Start of the character that ends at k - 1
+			size_t prev = k - 1;
+			while (prev > 0 && k - prev < 4 && (static_cast<unsigned char>(text[prev]) & 0xC0) == 0x80) {
+				prev--;
+			}
+			CharInfo ch = char_info(text, prev);
+			if (!ch.split || prev + ch.length != k) return false;
+
+			for (size_t back = 1; back <= 3 && back <= prev; ++back) {
+				unsigned char c = text[prev - back];
+				if ((c & 0x80) != 0 && utf8_char_length(c) > back) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// Last token boundary in text at or after from, or 0 if there is none
+		size_t find_last_token_boundary(std::string_view text, size_t from = 1) const {
+			if (from == 0) from = 1;
+			for (size_t k = text.size(); k-- > from; ) {
+				if (is_token_boundary(text, k)) return k;
+			}
+			return 0;
+		}
+
+		// Id of a normalized token, unk_id_ if it is not in the vocabulary
+		int lookup_id(std::string_view token) const {
+			if (compressed_vocab_) {
+				int id;
+				return compressed_.find(token, id) ? id : unk_id_;
+			}
+#if defined(__cpp_lib_generic_unordered_lookup)
+			auto it = vocab_to_id_.find(token);
+#else
+			auto it = vocab_to_id_.find(std::string(token));
+#endif
+			return it != vocab_to_id_.end() ? it->second : unk_id_;
+		}
+
+		// Token text for an id into out; false for ids outside the vocabulary
+		bool token_for_id(int id, std::string& out) const {
+			if (compressed_vocab_) {
+				return compressed_.token_into(id, out);
+			}
+			if (id < 0 || id >= static_cast<int>(id_to_vocab_.size())) return false;
+			out = id_to_vocab_[id];
+			return true;
+		}
+
+		void reset_vocab() {
+			vocab_to_id_.clear();
+			id_to_vocab_.clear();
+			compressed_.clear();
+			compressed_vocab_ = false;
+			vocab_hash_ = 0;
+			config_changed();
+		}
+
+		// Shared body of encode and its pmr overload. Tokens are normalized into
+		// one reused buffer (or not at all without lowercasing or Unicode
+		// normalization) and looked up in place, so no per-token strings are
+		// created.
+		template<typename Ids, typename String>
+		void encode_into(std::string_view text, Ids& ids, String& buffer) const {
+			if (!use_vocab_) {
+				// If no vocabulary, just return indices based on order
+				int index = 0;
+				scan_tokens(text, [&](std::string_view) { ids.push_back(index++); });
+				return;
+			}
+
+			MTT_TOKEN_SAMPLED(scan_tokens(text, [&](std::string_view token_view) {
+				if (!lowercase_ && normalization_ == NormalizationForm::none) {
+					MTT_SAMPLED_TIMER(lookup);
+					ids.push_back(lookup_id(token_view));
+					return;
+				}
+				{
+					MTT_SAMPLED_TIMER(normalize);
+					normalize_token_into(token_view, buffer);
+				}
+				MTT_SAMPLED_TIMER(lookup);
+				ids.push_back(lookup_id(buffer));
+			}));
+		}
+
+		// Wrap encoded ids in [CLS] ... [SEP] and truncate to max_length.
+		// The result never exceeds max_length (negative counts as 0); a limit
+		// too small for both special tokens keeps [CLS] and drops [SEP].
+		// The result uses the allocator of token_ids.
+		template<typename Ids>
+		Ids finish_sequence(Ids token_ids, int max_length, bool add_special_tokens) const {
+			MTT_STAGE_TIMER(sequence, 0);
+			MTT_STAGE_ITEMS(token_ids.size());
+			size_t limit = static_cast<size_t>(std::max(max_length, 0));
+			if (!add_special_tokens || !use_vocab_) {
+				// Truncate if necessary
+				if (token_ids.size() > limit) {
+					token_ids.resize(limit);
+				}
+				return token_ids;
+			}
+
+			Ids result(token_ids.get_allocator());
+			size_t specials = (cls_id_ >= 0 ? 1 : 0) + (sep_id_ >= 0 ? 1 : 0);
+			size_t available = limit > specials ? limit - specials : 0;
+
+			// Add CLS token at beginning
+			if (cls_id_ >= 0) {
+				result.push_back(cls_id_);
+			}
+
+			// Add tokens (truncate if necessary)
+			result.insert(result.end(), token_ids.begin(), token_ids.begin() + std::min(token_ids.size(), available));
+
+			// Add SEP token at end
+			if (sep_id_ >= 0) {
+				result.push_back(sep_id_);
+			}
+
+			if (result.size() > limit) {
+				result.resize(limit);
+			}
+			return result;
+		}
+
+		// Shared chunk loop behind tokenize_stream/tokenize_fd. read_some(dst, n)
+		// returns the number of bytes read, 0 at end of input, or -1 on error.
+		// Everything after the last token boundary of a chunk is carried over,
+		// so tokens and split UTF-8 sequences survive chunk edges.
+		template<typename ReadSome, typename Sink>
+		bool stream_tokens(ReadSome&& read_some, Sink& sink, size_t chunk_size) const {
+			if (chunk_size == 0) chunk_size = 64 * 1024;
+
+			std::string buffer;
+			std::string token;
+			size_t carry = 0;
+			bool ok = true;
+
+			auto deliver = [&](std::string_view token_view) {
+				normalize_token_into(token_view, token);
+				sink(static_cast<const std::string&>(token));
+			};
+
+			for (;;) {
+				if (buffer.size() < carry + chunk_size) {
+					buffer.resize(carry + chunk_size);
+				}
+
+				std::ptrdiff_t got = read_some(&buffer[carry], chunk_size);
+				if (got <= 0) {
+					ok = got == 0;
+					break;
+				}
+
+				// The carry was already searched; only its last few bytes can
+				// turn into a boundary now that the next character is known
+				std::string_view data(buffer.data(), carry + static_cast<size_t>(got));
+				size_t cut = find_last_token_boundary(data, carry > 3 ? carry - 3 : 1);
+				if (cut == 0) {
+					if (data.size() < max_stream_carry) {
+						// A single token spans the whole chunk, keep reading
+						carry = data.size();
+						continue;
+					}
+					// Cut the oversized token before its last lead byte so
+					// no UTF-8 sequence is split
+					cut = data.size() - 1;
+					while (cut > 1 && (static_cast<unsigned char>(data[cut]) & 0xC0) == 0x80) {
+						cut--;
+					}
+				}
+
+				scan_tokens(data.substr(0, cut), deliver);
+				carry = data.size() - cut;
+				std::memmove(&buffer[0], buffer.data() + cut, carry);
+			}
+
+			scan_tokens(std::string_view(buffer.data(), carry), deliver);
+			return ok;
+		}
+
+	public:
+		TextTokenizer()
+			: lowercase_(false)
+			, normalization_(NormalizationForm::none)
+			, keep_punctuation_(false)
+			, split_on_punctuation_(false)
+			, unk_token_("[UNK]")
+			, pad_token_("[PAD]")
+			, cls_token_("[CLS]")
+			, sep_token_("[SEP]")
+			, use_vocab_(false)
+			, unk_id_(-1)
+			, pad_id_(-1)
+			, cls_id_(-1)
+			, sep_id_(-1)
+			, async_inline_threshold_(4096) {
+			for (char c : { ' ', '\t', '\n', '\r', '\f', '\v' }) {
+				delimiters_.insert(static_cast<unsigned char>(c));
+			}
+			update_split_set();
+			config_changed();
+		}
+
+		// Configuration methods
+		TextTokenizer& set_lowercase(bool enable) {
+			lowercase_ = enable;
+			config_changed();
+			return *this;
+		}
+
+		// Normalize tokens to NFC, NFD or NFKC before lowercasing and lookup
+		TextTokenizer& set_normalization(NormalizationForm form) {
+			normalization_ = form;
+			config_changed();
+			return *this;
+		}
+
+		TextTokenizer& set_keep_punctuation(bool enable) {
+			keep_punctuation_ = enable;
+			config_changed();
+			return *this;
+		}
+
+		TextTokenizer& set_split_on_punctuation(bool enable) {
+			split_on_punctuation_ = enable;
+			update_split_set();
+			config_changed();
+			return *this;
+		}
+
+		TextTokenizer& add_delimiter(char delim) {
+			delimiters_.insert(static_cast<unsigned char>(delim));
+			update_split_set();
+			config_changed();
+			return *this;
+		}
+
+		TextTokenizer& add_delimiters(const std::string& delims) {
+			for (char c : delims) {
+				delimiters_.insert(static_cast<unsigned char>(c));
+			}
+			update_split_set();
+			config_changed();
+			return *this;
+		}
+
+		// Vocabulary configuration methods
+		TextTokenizer& set_special_tokens(const std::string& unk = "[UNK]",
+			const std::string& pad = "[PAD]",
+			const std::string& cls = "[CLS]",
+			const std::string& sep = "[SEP]") {
+			unk_token_ = unk;
+			pad_token_ = pad;
+			cls_token_ = cls;
+			sep_token_ = sep;
+			config_changed();
+			return *this;
+		}
+
+		// Load vocabulary from file
+		bool load_vocab(const std::string& vocab_file) {
+			std::ifstream file(vocab_file);
+			if (!file.is_open()) {
+				return false;
+			}
+
+			reset_vocab();
+
+			std::string token;
+			int id = 0;
+
+			while (std::getline(file, token)) {
+				// Remove trailing whitespace
+				token.erase(token.find_last_not_of(" \t\r\n") + 1);
+
+				if (!token.empty()) {
+					vocab_to_id_[token] = id;
+					id_to_vocab_.push_back(token);
+
+					// Store special token IDs
+					if (token == unk_token_) unk_id_ = id;
+					else if (token == pad_token_) pad_id_ = id;
+					else if (token == cls_token_) cls_id_ = id;
+					else if (token == sep_token_) sep_id_ = id;
+
+					id++;
+				}
+			}
+
+			use_vocab_ = true;
+			vocab_changed();
+			return true;
+		}
+
+		// Create vocabulary from tokenized text
+		TextTokenizer& build_vocab_from_text(const std::vector<std::string>& texts,
+			int min_frequency = 1,
+			int max_vocab_size = 50000) {
+			std::unordered_map<std::string, int> token_counts;
+
+			// Count token frequencies
+			for (const auto& text : texts) {
+				auto tokens = tokenize(text);
+				for (const auto& token : tokens) {
+					token_counts[token]++;
+				}
+			}
+
+			// Sort by frequency
+			std::vector<std::pair<std::string, int>> sorted_tokens;
+			for (const auto& pair : token_counts) {
+				if (pair.second >= min_frequency) {
+					sorted_tokens.push_back(pair);
+				}
+			}
+
+			std::sort(sorted_tokens.begin(), sorted_tokens.end(),
+				[](const auto& a, const auto& b) {
+					return a.second > b.second;
+				});
+
+			// Build vocabulary
+			reset_vocab();
+
+			// Add special tokens first
+			std::vector<std::string> special_tokens = { pad_token_, unk_token_, cls_token_, sep_token_ };
+			for (const auto& token : special_tokens) {
+				if (vocab_to_id_.find(token) == vocab_to_id_.end()) {
+					int id = static_cast<int>(id_to_vocab_.size());
+					vocab_to_id_[token] = id;
+					id_to_vocab_.push_back(token);
+
+					if (token == unk_token_) unk_id_ = id;
+					else if (token == pad_token_) pad_id_ = id;
+					else if (token == cls_token_) cls_id_ = id;
+					else if (token == sep_token_) sep_id_ = id;
+				}
+			}
+
+			// Add regular tokens
+			int added = 0;
+			for (const auto& pair : sorted_tokens) {
+				if (vocab_to_id_.find(pair.first) == vocab_to_id_.end() &&
+					added < max_vocab_size - static_cast<int>(special_tokens.size())) {
+					int id = static_cast<int>(id_to_vocab_.size());
+					vocab_to_id_[pair.first] = id;
+					id_to_vocab_.push_back(pair.first);
+					added++;
+				}
+			}
+
+			use_vocab_ = true;
+			vocab_changed();
+			return *this;
+		}
+
+		// Save vocabulary to file
+		bool save_vocab(const std::string& vocab_file) const {
+			if (!use_vocab_) return false;
+
+			std::ofstream file(vocab_file);
+			if (!file.is_open()) return false;
+
+			std::string token;
+			for (int id = 0; id < static_cast<int>(vocab_size()); ++id) {
+				token_for_id(id, token);
+				file << token << "\n";
+			}
+
+			return true;
+		}
+
+		// Switch the loaded vocabulary to the front-coded representation
+		// (see CompressedVocabulary): several times smaller, slightly slower
+		// lookups. Encode/decode results are unchanged. Loading or building a
+		// vocabulary afterwards returns to the uncompressed form.
+		TextTokenizer& compress_vocab() {
+			if (!use_vocab_ || compressed_vocab_) return *this;
+
+			compressed_.build(id_to_vocab_);
+			compressed_vocab_ = true;
+			std::unordered_map<std::string, int, VocabHash, std::equal_to<>>().swap(vocab_to_id_);
+			std::vector<std::string>().swap(id_to_vocab_);
+			return *this;
+		}
+
+		bool is_vocab_compressed() const { return compressed_vocab_; }
+
+		// Main tokenization method
+		std::vector<std::string> tokenize(std::string_view text) const {
+			MTT_STAGE_TIMER(tokenize, text.size());
+			std::vector<std::string> tokens;
+			MTT_TOKEN_SAMPLED(scan_tokens(text, [&](std::string_view token_view) {
+				MTT_SAMPLED_TIMER(normalize);
+				tokens.push_back(normalize_token(token_view));
+			}));
+			MTT_STAGE_ITEMS(tokens.size());
+			return tokens;
+		}
+
+		// First position at or after from where text can be cut without changing
+		// the tokens (see tokenize_parallel), or text.size() if there is none.
+		// Useful for splitting large inputs into independently encodable pieces.
+		size_t find_next_token_boundary(std::string_view text, size_t from) const {
+			for (size_t k = std::max<size_t>(from, 1); k < text.size(); ++k) {
+				if (is_token_boundary(text, k)) return k;
+			}
+			return text.size();
+		}
+
+		// Parallel tokenization of a single large buffer. The text is cut into
+		// num_threads ranges (0 = hardware concurrency), each cut moved forward to
+		// the next token boundary, and the ranges are tokenized concurrently.
+		// The result is identical to tokenize(text).
+		std::vector<std::string> tokenize_parallel(std::string_view text, unsigned num_threads = 0) const {
+			// Below this many bytes per range, thread start-up costs more than it saves
+			constexpr size_t min_range_size = 64 * 1024;
+
+			if (num_threads == 0) {
+				num_threads = std::max(1u, std::thread::hardware_concurrency());
+			}
+			num_threads = static_cast<unsigned>(std::min<size_t>(num_threads, text.size() / min_range_size));
+			if (num_threads <= 1) {
+				return tokenize(text);
+			}
+
+			// Boundary-aligned cut points; duplicates collapse when a token spans ranges
+			std::vector<size_t> cuts = { 0 };
+			for (unsigned t = 1; t < num_threads; ++t) {
+				size_t target = std::max(cuts.back() + 1, text.size() / num_threads * t);
+				size_t cut = find_next_token_boundary(text, target);
+				if (cut >= text.size()) break;
+				cuts.push_back(cut);
+			}
+			cuts.push_back(text.size());
+
+			size_t ranges = cuts.size() - 1;
+			std::vector<std::vector<std::string>> parts(ranges);
+			std::vector<std::thread> workers;
+			workers.reserve(ranges - 1);
+
+			for (size_t r = 1; r < ranges; ++r) {
+				workers.emplace_back([&, r]() {
+					parts[r] = tokenize(text.substr(cuts[r], cuts[r + 1] - cuts[r]));
+				});
+			}
+			parts[0] = tokenize(text.substr(0, cuts[1]));
+			for (auto& worker : workers) {
+				worker.join();
+			}
+
+			size_t total = 0;
+			for (const auto& part : parts) {
+				total += part.size();
+			}
+
+			std::vector<std::string> tokens = std::move(parts[0]);
+			tokens.reserve(total);
+			for (size_t r = 1; r < ranges; ++r) {
+				std::move(parts[r].begin(), parts[r].end(), std::back_inserter(tokens));
+			}
+			return tokens;
+		}
+
+		// Longest partial token carried between chunks while streaming; a
+		// longer token is cut into pieces of about this size
+		static constexpr size_t max_stream_carry = 1024 * 1024;
+
+		// Streaming tokenization: reads fixed-size chunks from the stream and
+		// hands every token to sink(const std::string&). Memory stays bounded by
+		// the chunk size plus max_stream_carry, whatever the input size; tokens
+		// longer than max_stream_carry are delivered in pieces.
+		// Returns false if the stream failed with a read error.
+		template<typename Sink>
+		bool tokenize_stream(std::istream& in, Sink&& sink, size_t chunk_size = 64 * 1024) const {
+			return stream_tokens([&in](char* dst, size_t n) -> std::ptrdiff_t {
+				in.read(dst, static_cast<std::streamsize>(n));
+				if (in.bad()) return -1;
+				return static_cast<std::ptrdiff_t>(in.gcount());
+			}, sink, chunk_size);
+		}
+
+#ifdef MTT_POSIX
+		// Streaming tokenization straight from a file descriptor (pipes, sockets, files)
+		template<typename Sink>
+		bool tokenize_fd(int fd, Sink&& sink, size_t chunk_size = 64 * 1024) const {
+			return stream_tokens([fd](char* dst, size_t n) -> std::ptrdiff_t {
+				for (;;) {
+					ssize_t got = ::read(fd, dst, n);
+					if (got >= 0) return static_cast<std::ptrdiff_t>(got);
+					if (errno != EINTR) return -1;
+				}
+			}, sink, chunk_size);
+		}
+#endif
+
+		// Attach a (possibly shared) encode cache; nullptr detaches it.
+		// encode, encode_sequence and everything built on them consult it.
+		TextTokenizer& set_encode_cache(std::shared_ptr<EncodeCache> cache) {
+			encode_cache_ = std::move(cache);
+			return *this;
+		}
+
+		const std::shared_ptr<EncodeCache>& encode_cache() const { return encode_cache_; }
+
+		// Hash of the settings that affect encode output (flags, delimiters,
+		// vocabulary, special tokens); equal fingerprints mean equal output
+		uint64_t config_fingerprint() const { return config_fingerprint_; }
+
+		// Tokenize and return token IDs
+		std::vector<int> encode(std::string_view text) const {
+			MTT_STAGE_TIMER(encode, text.size());
+			std::vector<int> ids;
+			if (!encode_cache_) {
+				ids = encode_uncached(text);
+			}
+			else if (!encode_cache_->lookup(text, config_fingerprint_, ids)) {
+				ids = encode_uncached(text);
+				encode_cache_->insert(text, config_fingerprint_, ids);
+			}
+			MTT_STAGE_ITEMS(ids.size());
+			return ids;
+		}
+
+		// encode without consulting the cache
+		std::vector<int> encode_uncached(std::string_view text) const {
+			std::vector<int> ids;
+			std::string buffer;
+			encode_into(text, ids, buffer);
+			return ids;
+		}
+
+#ifdef MTT_COROUTINES
+		// Awaitable returned by async_encode. Large inputs are encoded on the
+		// shared worker pool and the awaiting coroutine is resumed on the
+		// worker thread that finished the job; small inputs never leave the
+		// calling thread. The text must stay alive until the co_await completes.
+		class EncodeAwaitable
+		{
+		private:
+			const TextTokenizer* tokenizer_;
+			std::string_view text_;
+			TokenizerThreadPool* pool_;
+			std::vector<int> result_;
+			std::exception_ptr error_;
+
+		public:
+			EncodeAwaitable(const TextTokenizer* tokenizer, std::string_view text, TokenizerThreadPool* pool)
+				: tokenizer_(tokenizer), text_(text), pool_(pool) {
+			}
+
+			bool await_ready() {
+				if (text_.size() >= tokenizer_->async_inline_threshold_) return false;
+				result_ = tokenizer_->encode(text_);
+				return true;
+			}
+
+			void await_suspend(std::coroutine_handle<> handle) {
+				pool_->submit([this, handle]() {
+					try {
+						result_ = tokenizer_->encode(text_);
+					}
+					catch (...) {
+						error_ = std::current_exception();
+					}
+					handle.resume();
+				});
+			}
+
+			std::vector<int> await_resume() {
+				if (error_) std::rethrow_exception(error_);
+				return std::move(result_);
+			}
+		};
+
+		// Awaitable returned by async_encode_batch. Texts are spread over the
+		// pool workers; the last worker to finish resumes the coroutine.
+		class EncodeBatchAwaitable
+		{
+		private:
+			const TextTokenizer* tokenizer_;
+			const std::vector<std::string>* texts_;
+			TokenizerThreadPool* pool_;
+			std::vector<std::vector<int>> results_;
+			std::atomic<size_t> next_{ 0 };
+			std::atomic<size_t> pending_{ 0 };
+			std::mutex error_mutex_;
+			std::exception_ptr error_;
+
+			void run_jobs() {
+				for (size_t i = next_++; i < texts_->size(); i = next_++) {
+					try {
+						results_[i] = tokenizer_->encode((*texts_)[i]);
+					}
+					catch (...) {
+						std::lock_guard<std::mutex> lock(error_mutex_);
+						if (!error_) error_ = std::current_exception();
+					}
+				}
+			}
+
+		public:
+			EncodeBatchAwaitable(const TextTokenizer* tokenizer, const std::vector<std::string>& texts, TokenizerThreadPool* pool)
+				: tokenizer_(tokenizer), texts_(&texts), pool_(pool), results_(texts.size()) {
+			}
+
+			bool await_ready() {
+				if (texts_->empty()) return true;
+
+				size_t total = 0;
+				for (const auto& text : *texts_) {
+					total += text.size();
+				}
+				if (total >= tokenizer_->async_inline_threshold_) return false;
+
+				for (size_t i = 0; i < texts_->size(); ++i) {
+					results_[i] = tokenizer_->encode((*texts_)[i]);
+				}
+				return true;
+			}
+
+			void await_suspend(std::coroutine_handle<> handle) {
+				size_t jobs = std::min(texts_->size(), pool_->size());
+				pending_ = jobs;
+				for (size_t j = 0; j < jobs; ++j) {
+					pool_->submit([this, handle]() {
+						run_jobs();
+						if (--pending_ == 0) handle.resume();
+					});
+				}
+			}
+
+			std::vector<std::vector<int>> await_resume() {
+				if (error_) std::rethrow_exception(error_);
+				return std::move(results_);
+			}
+		};
+
+		// Inputs shorter than this (in bytes, summed over a batch) are encoded
+		// inline by the async API to avoid the thread hop
+		TextTokenizer& set_async_inline_threshold(size_t bytes) {
+			async_inline_threshold_ = bytes;
+			return *this;
+		}
+
+		// co_await tokenizer.async_encode(text) -> std::vector<int>
+		EncodeAwaitable async_encode(std::string_view text,
+			TokenizerThreadPool& pool = TokenizerThreadPool::shared()) const {
+			return EncodeAwaitable(this, text, &pool);
+		}
+
+		// co_await tokenizer.async_encode_batch(texts) -> one id vector per text
+		EncodeBatchAwaitable async_encode_batch(const std::vector<std::string>& texts,
+			TokenizerThreadPool& pool = TokenizerThreadPool::shared()) const {
+			return EncodeBatchAwaitable(this, texts, &pool);
+		}
+#endif
+
+		// Tokenize a whole file without copying it into a std::string first:
+		// the file is mapped read-only and scanned in place
+		bool tokenize_file(const std::string& path, std::vector<std::string>& tokens,
+			bool huge_pages = false) const {
+			MappedFile file;
+			if (!file.open(path, true, huge_pages)) {
+				return false;
+			}
+			tokens = tokenize(file.view());
+			return true;
+		}
+
+		// Encode a whole file to token IDs straight from the mapping
+		bool encode_file(const std::string& path, std::vector<int>& ids,
+			bool huge_pages = false) const {
+			MappedFile file;
+			if (!file.open(path, true, huge_pages)) {
+				return false;
+			}
+			ids = encode(file.view());
+			return true;
+		}
+
+		// Decode token IDs back to text
+		std::string decode(const std::vector<int>& ids) const {
+			if (!use_vocab_) return "";
+
+			std::ostringstream result;
+			std::string compressed_token;
+			bool first = true;
+
+			for (int id : ids) {
+				if (id >= 0 && id < static_cast<int>(vocab_size())) {
+					if (compressed_vocab_) {
+						compressed_.token_into(id, compressed_token);
+					}
+					const std::string& token = compressed_vocab_ ? compressed_token : id_to_vocab_[id];
+
+					// Skip special tokens in output (except for debugging)
+					if (token == pad_token_) continue;
+
+					if (!first) result << " ";
+					result << token;
+					first = false;
+				}
+			}
+
+			return result.str();
+		}
+
+		// Encode with special tokens for sequence classification
+		std::vector<int> encode_sequence(std::string_view text,
+			int max_length = 512,
+			bool add_special_tokens = true) const {
+			return finish_sequence(encode(text), max_length, add_special_tokens);
+		}
+
+#ifdef MTT_PMR
+		// Allocator-aware overloads: every vector and string of the result (and
+		// every scratch buffer) comes from resource, so request-scoped arenas
+		// such as std::pmr::monotonic_buffer_resource can free them all at once
+		std::pmr::vector<std::pmr::string> tokenize(std::string_view text, std::pmr::memory_resource* resource) const {
+			MTT_STAGE_TIMER(tokenize, text.size());
+			std::pmr::vector<std::pmr::string> tokens(resource);
+			MTT_TOKEN_SAMPLED(scan_tokens(text, [&](std::string_view token_view) {
+				MTT_SAMPLED_TIMER(normalize);
+				tokens.emplace_back();
+				normalize_token_into(token_view, tokens.back());
+			}));
+			MTT_STAGE_ITEMS(tokens.size());
+			return tokens;
+		}
+
+		std::pmr::vector<int> encode(std::string_view text, std::pmr::memory_resource* resource) const {
+			MTT_STAGE_TIMER(encode, text.size());
+			std::pmr::vector<int> ids(resource);
+			if (!encode_cache_ || !encode_cache_->lookup(text, config_fingerprint_, ids)) {
+				std::pmr::string buffer(resource);
+				encode_into(text, ids, buffer);
+				if (encode_cache_) {
+					encode_cache_->insert(text, config_fingerprint_, ids);
+				}
+			}
+			MTT_STAGE_ITEMS(ids.size());
+			return ids;
+		}
+
+		std::pmr::vector<int> encode_sequence(std::string_view text, std::pmr::memory_resource* resource,
+			int max_length = 512,
+			bool add_special_tokens = true) const {
+			return finish_sequence(encode(text, resource), max_length, add_special_tokens);
+		}
+#endif
+
+		// Get vocabulary size
+		size_t vocab_size() const {
+			if (!use_vocab_) return 0;
+			return compressed_vocab_ ? compressed_.size() : id_to_vocab_.size();
+		}
+
+		// Get special token IDs
+		int get_unk_id() const { return unk_id_; }
+		int get_pad_id() const { return pad_id_; }
+		int get_cls_id() const { return cls_id_; }
+		int get_sep_id() const { return sep_id_; }
+
+		std::string get_token_by_id(int id) const {
+			std::string token;
+			if (!use_vocab_ || !token_for_id(id, token)) {
+				return "[INVALID]";
+			}
+			return token;
+		}
+
+		// Check if using vocabulary
+		bool has_vocab() const { return use_vocab_; }
+
+		// Memory footprint broken down by structure (see TokenizerMemoryUsage)
+		TokenizerMemoryUsage memory_usage() const {
+			auto string_heap = [](const std::string& s) -> size_t {
+				return s.capacity() > std::string().capacity() ? s.capacity() + 1 : 0;
+			};
+			auto node_size = [](size_t value_size) -> size_t {
+				size_t bytes = sizeof(void*) + value_size + sizeof(size_t);
+				return (bytes + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+			};
+
+			TokenizerMemoryUsage usage;
+			usage.object = sizeof(*this);
+
+			usage.vocab_buckets = vocab_to_id_.bucket_count() * sizeof(void*);
+			usage.vocab_nodes = vocab_to_id_.size() * node_size(sizeof(std::pair<const std::string, int>));
+			for (const auto& entry : vocab_to_id_) {
+				usage.vocab_strings += string_heap(entry.first);
+			}
+
+			usage.id_table = id_to_vocab_.capacity() * sizeof(std::string);
+			for (const auto& token : id_to_vocab_) {
+				usage.id_strings += string_heap(token);
+			}
+
+			usage.special_tokens = string_heap(unk_token_) + string_heap(pad_token_) +
+				string_heap(cls_token_) + string_heap(sep_token_);
+
+			usage.compressed_vocab = compressed_.memory_usage();
+			if (encode_cache_) {
+				usage.encode_cache = encode_cache_->memory_usage();
+			}
+			return usage;
+		}
+
+		// Normalize text to NFC, NFD or NFKC. Already normalized text (all
+		// ASCII, say) is found by the quick check and copied unchanged.
+		static std::string normalize_unicode(std::string_view text, NormalizationForm form) {
+			std::string result;
+			append_normalized(text, form == NormalizationForm::none ? text.size() : normalized_prefix(text, form), form, result);
+			return result;
+		}
+
+		// Convenience method for simple whitespace tokenization
+		static std::vector<std::string> simple_split(std::string_view text) {
+			return TextTokenizer().tokenize(text);
+		}
+
+		// Method to get token count without storing tokens
+		size_t count_tokens(std::string_view text) const {
+			size_t count = 0;
+			scan_tokens(text, [&](std::string_view) { count++; });
+			return count;
+		}
+	};
+
+	// Indexed binary token dataset, two files per dataset, all little-endian:
+	//  <prefix>.bin  flat stream of uint16 or uint32 token ids
+	//  <prefix>.idx  header, then uint64 token offsets and uint64 lengths per document
+	// The reader maps both files, so document N is an O(1) lookup and a
+	// zero-copy view into the mapping.
+	struct TokenDatasetHeader {
+		char magic[8];
+		uint32_t version;
+		uint32_t dtype_bytes;
+		uint64_t document_count;
+		uint64_t token_count;
+	};
+
+	inline constexpr char token_dataset_magic[8] = { 'M', 'T', 'T', 'I', 'D', 'X', 0, 0 };
+	inline constexpr uint32_t token_dataset_version = 1;
+
+	class TokenDatasetWriter
+	{
+	private:
+		std::string prefix_;
+		std::ofstream bin_;
+		std::vector<uint64_t> offsets_;
+		std::vector<uint64_t> lengths_;
+		std::vector<unsigned char> buffer_;
+		uint64_t token_count_ = 0;
+		uint64_t document_start_ = 0;
+		uint32_t dtype_bytes_ = 2;
+		bool open_ = false;
+
+	public:
+		TokenDatasetWriter() = default;
+		TokenDatasetWriter(const TokenDatasetWriter&) = delete;
+		TokenDatasetWriter& operator=(const TokenDatasetWriter&) = delete;
+
+		~TokenDatasetWriter() {
+			close();
+		}
+
+		// Start a dataset; dtype_bytes is 2 (uint16 ids) or 4 (uint32 ids)
+		bool open(const std::string& prefix, int dtype_bytes = 2) {
+			close();
+			if (dtype_bytes != 2 && dtype_bytes != 4) return false;
+
+			bin_.open(prefix + ".bin", std::ios::binary | std::ios::trunc);
+			if (!bin_.is_open()) return false;
+
+			prefix_ = prefix;
+			dtype_bytes_ = static_cast<uint32_t>(dtype_bytes);
+			offsets_.clear();
+			lengths_.clear();
+			token_count_ = 0;
+			document_start_ = 0;
+			open_ = true;
+			return true;
+		}
+
+		// Append ids to the current document, for documents that arrive in
+		// pieces. Fails if an id does not fit the id width.
+		bool append(const std::vector<int>& ids) {
+			if (!open_) return false;
+
+			buffer_.resize(ids.size() * dtype_bytes_);
+			unsigned char* dst = buffer_.data();
+			for (int id : ids) {
+				if (id < 0 || (dtype_bytes_ == 2 && id > 0xFFFF)) return false;
+				if (dtype_bytes_ == 2) detail::store_le(dst, static_cast<uint32_t>(id), 2);
+				else detail::store_le(dst, static_cast<uint32_t>(id), 4);
+				dst += dtype_bytes_;
+			}
+
+			bin_.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+			if (!bin_) return false;
+
+			token_count_ += ids.size();
+			return true;
+		}
+
+		// Close the current document (possibly empty) and start the next
+		bool end_document() {
+			if (!open_) return false;
+			offsets_.push_back(document_start_);
+			lengths_.push_back(token_count_ - document_start_);
+			document_start_ = token_count_;
+			return true;
+		}
+
+		// Append one whole document
+		bool add_document(const std::vector<int>& ids) {
+			return append(ids) && end_document();
+		}
+
+		// Encode a text and append it as one document
+		bool add_document(const TextTokenizer& tokenizer, std::string_view text) {
+			return add_document(tokenizer.encode(text));
+		}
+
+		// Finish the .bin file and write the .idx file. Ids appended since
+		// the last end_document() form a final document.
+		bool close() {
+			if (!open_) return true;
+			if (token_count_ != document_start_) end_document();
+			open_ = false;
+
+			bin_.close();
+			if (bin_.fail()) return false;
+
+			std::ofstream idx(prefix_ + ".idx", std::ios::binary | std::ios::trunc);
+			if (!idx.is_open()) return false;
+
+			std::vector<unsigned char> index(sizeof(TokenDatasetHeader) + 2 * offsets_.size() * sizeof(uint64_t));
+			unsigned char* dst = index.data();
+			std::memcpy(dst, token_dataset_magic, sizeof(token_dataset_magic));
+			detail::store_le(dst + offsetof(TokenDatasetHeader, version), token_dataset_version, 4);
+			detail::store_le(dst + offsetof(TokenDatasetHeader, dtype_bytes), dtype_bytes_, 4);
+			detail::store_le(dst + offsetof(TokenDatasetHeader, document_count), offsets_.size(), 8);
+			detail::store_le(dst + offsetof(TokenDatasetHeader, token_count), token_count_, 8);
+			dst += sizeof(TokenDatasetHeader);
+			for (const auto* column : { &offsets_, &lengths_ }) {
+				for (uint64_t value : *column) {
+					detail::store_le(dst, value, 8);
+					dst += 8;
+				}
+			}
+
+			idx.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size()));
+			idx.close();
+			return !idx.fail();
+		}
+
+		size_t document_count() const { return offsets_.size(); }
+		uint64_t token_count() const { return token_count_; }
+	};
+
+	class TokenDatasetReader
+	{
+	private:
+		MappedFile bin_;
+		MappedFile idx_;
+		const unsigned char* offsets_ = nullptr;	// little-endian uint64 columns in idx_
+		const unsigned char* lengths_ = nullptr;
+		uint64_t document_count_ = 0;
+		uint64_t token_count_ = 0;
+		uint32_t dtype_bytes_ = 0;
+
+	public:
+		// Map <prefix>.bin and <prefix>.idx and validate the index against them
+		bool open(const std::string& prefix) {
+			close();
+			if (!idx_.open(prefix + ".idx", false) || !bin_.open(prefix + ".bin", false)) {
+				close();
+				return false;
+			}
+
+			if (idx_.size() < sizeof(TokenDatasetHeader)) {
+				close();
+				return false;
+			}
+			const unsigned char* index = reinterpret_cast<const unsigned char*>(idx_.data());
+			TokenDatasetHeader header;
+			std::memcpy(header.magic, index, sizeof(header.magic));
+			header.version = static_cast<uint32_t>(detail::load_le(index + offsetof(TokenDatasetHeader, version), 4));
+			header.dtype_bytes = static_cast<uint32_t>(detail::load_le(index + offsetof(TokenDatasetHeader, dtype_bytes), 4));
+			header.document_count = detail::load_le(index + offsetof(TokenDatasetHeader, document_count), 8);
+			header.token_count = detail::load_le(index + offsetof(TokenDatasetHeader, token_count), 8);
+
+			bool valid = std::memcmp(header.magic, token_dataset_magic, sizeof(header.magic)) == 0 &&
+				header.version == token_dataset_version &&
+				(header.dtype_bytes == 2 || header.dtype_bytes == 4) &&
+				header.document_count <= (idx_.size() - sizeof(header)) / (2 * sizeof(uint64_t)) &&
+				idx_.size() == sizeof(header) + header.document_count * 2 * sizeof(uint64_t) &&
+				bin_.size() == header.token_count * header.dtype_bytes;
+			if (!valid) {
+				close();
+				return false;
+			}
+
+			offsets_ = index + sizeof(header);
+			lengths_ = offsets_ + header.document_count * sizeof(uint64_t);
+			document_count_ = header.document_count;
+			for (uint64_t n = 0; n < header.document_count; ++n) {
+				uint64_t offset = document_offset(static_cast<size_t>(n));
+				if (offset > header.token_count || document_length(static_cast<size_t>(n)) > header.token_count - offset) {
+					close();
+					return false;
+				}
+			}
+
+			token_count_ = header.token_count;
+			dtype_bytes_ = header.dtype_bytes;
+			return true;
+		}
+
+		void close() {
+			bin_.close();
+			idx_.close();
+			offsets_ = nullptr;
+			lengths_ = nullptr;
+			document_count_ = 0;
+			token_count_ = 0;
+			dtype_bytes_ = 0;
+		}
+
+		bool is_open() const { return offsets_ != nullptr; }
+		size_t size() const { return static_cast<size_t>(document_count_); }
+		uint64_t token_count() const { return token_count_; }
+		int dtype_bytes() const { return static_cast<int>(dtype_bytes_); }
+		uint64_t document_offset(size_t n) const { return detail::load_le(offsets_ + n * sizeof(uint64_t), 8); }
+		uint64_t document_length(size_t n) const { return detail::load_le(lengths_ + n * sizeof(uint64_t), 8); }
+
+#if defined(__cpp_lib_span)
+		// Zero-copy view of document n. T must match the dataset id width
+		// (uint16_t or uint32_t); a mismatch, a bad index or a big-endian host
+		// (where the stored ids need swapping; use document_ids) gives an empty span.
+		template<typename T>
+		std::span<const T> document(size_t n) const {
+			static_assert(std::is_same_v<T, uint16_t> || std::is_same_v<T, uint32_t>,
+				"token datasets store uint16_t or uint32_t ids");
+			if (n >= document_count_ || sizeof(T) != dtype_bytes_ || !detail::host_is_little_endian()) return {};
+			const T* ids = reinterpret_cast<const T*>(bin_.data());
+			return std::span<const T>(ids + document_offset(n), static_cast<size_t>(document_length(n)));
+		}
+#endif
+
+		// Copy of document n as ints, whatever the id width
+		std::vector<int> document_ids(size_t n) const {
+			std::vector<int> ids;
+			if (n >= document_count_) return ids;
+
+			ids.resize(static_cast<size_t>(document_length(n)));
+			const unsigned char* src = reinterpret_cast<const unsigned char*>(bin_.data()) + document_offset(n) * dtype_bytes_;
+			for (size_t i = 0; i < ids.size(); ++i, src += dtype_bytes_) {
+				ids[i] = static_cast<int>(dtype_bytes_ == 2 ? detail::load_le(src, 2) : detail::load_le(src, 4));
+			}
+			return ids;
+		}
+	};
+
+	// Minimal streaming extractor for one string field of JSONL records, e.g.
+	// {"id": 7, "text": "..."}. It walks the top-level object, skips other
+	// values without building a DOM and unescapes only the wanted string.
+	// Values without escapes are returned as views into the line itself.
+	class JsonlTextExtractor
+	{
+	private:
+		std::string key_;
+		std::string value_;
+		std::string key_buffer_;
+		std::string line_;
+		size_t skipped_ = 0;
+
+		static bool is_json_space(char c) {
+			return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+		}
+
+		static const char* skip_space(const char* p, const char* end) {
+			while (p < end && is_json_space(*p)) p++;
+			return p;
+		}
+
+		// First '"' or '\\' in [p, end), or end
+		static const char* find_quote_or_backslash(const char* p, const char* end) {
+#ifdef MTT_SSE2
+			const __m128i quote = _mm_set1_epi8('"');
+			const __m128i backslash = _mm_set1_epi8('\\');
+			while (end - p >= 16) {
+				__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+				__m128i hits = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash));
+				int mask = _mm_movemask_epi8(hits);
+				if (mask != 0) {
+					return p + detail::count_trailing_zeros(static_cast<unsigned>(mask));
+				}
+				p += 16;
+			}
+#endif
+			while (p < end && *p != '"' && *p != '\\') p++;
+			return p;
+		}
+
+		static int hex_value(char c) {
+			if (c >= '0' && c <= '9') return c - '0';
+			if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+			if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+			return -1;
+		}
+
+		static bool parse_hex4(const char* p, const char* end, uint32_t& value) {
+			if (end - p < 4) return false;
+			value = 0;
+			for (int i = 0; i < 4; ++i) {
+				int digit = hex_value(p[i]);
+				if (digit < 0) return false;
+				value = (value << 4) | static_cast<uint32_t>(digit);
+			}
+			return true;
+		}
+
+		// Parse a string whose opening quote is at p[-1]. On success, p points
+		// past the closing quote and value is either a view into the input
+		// (no escapes) or into out (unescaped).
+		static bool parse_string(const char*& p, const char* end, std::string_view& value, std::string& out) {
+			const char* begin = p;
+			const char* hit = find_quote_or_backslash(p, end);
+			if (hit == end) return false;
+			if (*hit == '"') {
+				value = std::string_view(begin, static_cast<size_t>(hit - begin));
+				p = hit + 1;
+				return true;
+			}
+
+			out.assign(begin, hit);
+			p = hit;
+			for (;;) {
+				if (p == end) return false;
+				if (*p == '"') {
+					p++;
+					value = out;
+					return true;
+				}
+
+				// *p is a backslash
+				if (++p == end) return false;
+				char c = *p++;
+				switch (c) {
+				case '"': out += '"'; break;
+				case '\\': out += '\\'; break;
+				case '/': out += '/'; break;
+				case 'b': out += '\b'; break;
+				case 'f': out += '\f'; break;
+				case 'n': out += '\n'; break;
+				case 'r': out += '\r'; break;
+				case 't': out += '\t'; break;
+				case 'u': {
+					uint32_t cp;
+					if (!parse_hex4(p, end, cp)) return false;
+					p += 4;
+					if (cp >= 0xD800 && cp <= 0xDBFF) {
+						uint32_t low;
+						if (end - p >= 6 && p[0] == '\\' && p[1] == 'u' &&
+							parse_hex4(p + 2, end, low) && low >= 0xDC00 && low <= 0xDFFF) {
+							cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+							p += 6;
+						}
+						else {
+							cp = 0xFFFD;	// unpaired surrogate
+						}
+					}
+					else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+						cp = 0xFFFD;
+					}
+					detail::append_utf8(out, cp);
+					break;
+				}
+				default:
+					return false;
+				}
+
+				const char* next = find_quote_or_backslash(p, end);
+				if (next == end) return false;
+				out.append(p, next);
+				p = next;
+			}
+		}
+
+		// Skip any JSON value starting at p
+		static bool skip_value(const char*& p, const char* end, std::string& scratch) {
+			if (p == end) return false;
+
+			if (*p == '"') {
+				std::string_view ignored;
+				++p;
+				return parse_string(p, end, ignored, scratch);
+			}
+
+			if (*p == '{' || *p == '[') {
+				int depth = 0;
+				while (p < end) {
+					char c = *p;
+					if (c == '"') {
+						const char* q = p + 1;
+						for (;;) {
+							q = find_quote_or_backslash(q, end);
+							if (q == end) return false;
+							if (*q == '"') break;
+							q += 2;	// skip escaped character
+							if (q > end) return false;
+						}
+						p = q + 1;
+						continue;
+					}
+					if (c == '{' || c == '[') depth++;
+					else if (c == '}' || c == ']') {
+						if (--depth == 0) {
+							p++;
+							return true;
+						}
+					}
+					p++;
+				}
+				return false;
+			}
+
+			// Number, true, false or null
+			const char* begin = p;
+			while (p < end && *p != ',' && *p != '}' && *p != ']' && !is_json_space(*p)) p++;
+			return p > begin;
+		}
+
+	public:
+		explicit JsonlTextExtractor(std::string key = "text")
+			: key_(std::move(key)) {
+		}
+
+		const std::string& key() const { return key_; }
+
+		// Lines skipped by for_each_text (missing key, non-string value, bad JSON)
+		size_t skipped_lines() const { return skipped_; }
+
+		// Extract the configured field from one JSON object. The view stays
+		// valid until the next call or until line goes away.
+		bool extract(std::string_view line, std::string_view& value) {
+			const char* p = line.data();
+			const char* end = p + line.size();
+
+			p = skip_space(p, end);
+			if (p == end || *p != '{') return false;
+			p = skip_space(p + 1, end);
+			if (p < end && *p == '}') return false;
+
+			while (p < end) {
+				if (*p != '"') return false;
+				p++;
+
+				std::string_view name;
+				if (!parse_string(p, end, name, key_buffer_)) return false;
+
+				p = skip_space(p, end);
+				if (p == end || *p != ':') return false;
+				p = skip_space(p + 1, end);
+
+				if (name == key_) {
+					if (p == end || *p != '"') return false;
+					p++;
+					return parse_string(p, end, value, value_);
+				}
+
+				if (!skip_value(p, end, value_)) return false;
+
+				p = skip_space(p, end);
+				if (p == end || *p != ',') return false;
+				p = skip_space(p + 1, end);
+			}
+			return false;
+		}
+
+		// Call sink(std::string_view) with the field of every line in an
+		// in-memory JSONL buffer (e.g. a MappedFile view)
+		template<typename Sink>
+		size_t for_each_text(std::string_view jsonl, Sink&& sink) {
+			size_t count = 0;
+			while (!jsonl.empty()) {
+				size_t eol = jsonl.find('\n');
+				std::string_view line = jsonl.substr(0, eol);
+				jsonl.remove_prefix(eol == std::string_view::npos ? jsonl.size() : eol + 1);
+
+				std::string_view text;
+				if (extract(line, text)) {
+					sink(text);
+					count++;
+				}
+				else if (line.find_first_not_of(" \t\r") != std::string_view::npos) {
+					skipped_++;
+				}
+			}
+			return count;
+		}
+
+		// Same, reading the JSONL records line by line from a stream into a
+		// reused buffer
+		template<typename Sink>
+		size_t for_each_text(std::istream& in, Sink&& sink) {
+			size_t count = 0;
+			while (std::getline(in, line_)) {
+				std::string_view text;
+				if (extract(line_, text)) {
+					sink(text);
+					count++;
+				}
+				else if (line_.find_first_not_of(" \t\r") != std::string::npos) {
+					skipped_++;
+				}
+			}
+			return count;
+		}
+	};
+
+	// Stream-VByte style compression for token-id blocks. Every id takes 1-4
+	// bytes; a 2-bit length code per id is packed four to a control byte and
+	// stored ahead of the data bytes. Decoding uses one SSSE3 shuffle per four
+	// ids when the CPU has it.
+	//
+	// Container layout (host byte order):
+	//  header   magic "MTTSVB1", block size, id count, block count
+	//  offsets  uint64 per block, relative to the start of the block area
+	//  blocks   uint32 id count, uint32 data bytes, control bytes, data bytes
+	//  padding  16 zero bytes so the vector decoder never reads past the end
+	class TokenIdCodec
+	{
+	private:
+		struct Header {
+			char magic[8];
+			uint32_t block_size;
+			uint32_t reserved;
+			uint64_t count;
+			uint64_t block_count;
+		};
+
+		static constexpr char magic_[8] = { 'M', 'T', 'T', 'S', 'V', 'B', '1', 0 };
+		static constexpr size_t padding_ = 16;
+
+		// Shuffle masks and data lengths for every control byte
+		struct DecodeTables {
+			uint8_t shuffle[256][16];
+			uint8_t length[256];
+
+			constexpr DecodeTables() : shuffle(), length() {
+				for (int control = 0; control < 256; ++control) {
+					int src = 0;
+					for (int lane = 0; lane < 4; ++lane) {
+						int bytes = ((control >> (2 * lane)) & 3) + 1;
+						for (int b = 0; b < 4; ++b) {
+							shuffle[control][lane * 4 + b] = b < bytes ? static_cast<uint8_t>(src + b) : 0xFF;
+						}
+						src += bytes;
+					}
+					length[control] = static_cast<uint8_t>(src);
+				}
+			}
+		};
+
+		static const DecodeTables& tables() {
+			static constexpr DecodeTables instance;
+			return instance;
+		}
+
+		static uint32_t code_for(uint32_t value) {
+			if (value < (1u << 8)) return 0;
+			if (value < (1u << 16)) return 1;
+			if (value < (1u << 24)) return 2;
+			return 3;
+		}
+
+		static size_t decode_scalar(const uint8_t* control, const uint8_t* data, size_t count, int* out) {
+			const uint8_t* start = data;
+			for (size_t i = 0; i < count; ++i) {
+				uint32_t bytes = ((control[i / 4] >> (2 * (i % 4))) & 3) + 1;
+				uint32_t value = 0;
+				for (uint32_t b = 0; b < bytes; ++b) {
+					value |= static_cast<uint32_t>(data[b]) << (8 * b);
+				}
+				data += bytes;
+				out[i] = static_cast<int>(value);
+			}
+			return static_cast<size_t>(data - start);
+		}
+
+#ifdef MTT_X86
+		MTT_TARGET("ssse3")
+		static size_t decode_ssse3(const uint8_t* control, const uint8_t* data, size_t count, int* out) {
+			const DecodeTables& t = tables();
+			const uint8_t* start = data;
+			size_t groups = count / 4;
+			for (size_t g = 0; g < groups; ++g) {
+				uint8_t c = control[g];
+				__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+				__m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.shuffle[c]));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4 * g), _mm_shuffle_epi8(bytes, mask));
+				data += t.length[c];
+			}
+			size_t done = groups * 4;
+			data += decode_scalar(control + groups, data, count - done, out + done);
+			return static_cast<size_t>(data - start);
+		}
+
+		static bool cpu_has_ssse3() {
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_cpu_supports("ssse3");
+#elif defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 1);
+			return (info[2] & (1 << 9)) != 0;
+#else
+			return false;
+#endif
+		}
+#endif
+
+		static size_t decode_group_stream(const uint8_t* control, const uint8_t* data, size_t count, int* out) {
+#ifdef MTT_X86
+			static const bool use_ssse3 = cpu_has_ssse3();
+			if (use_ssse3) return decode_ssse3(control, data, count, out);
+#endif
+			return decode_scalar(control, data, count, out);
+		}
+
+		const uint8_t* data_ = nullptr;
+		size_t size_ = 0;
+		const uint64_t* offsets_ = nullptr;
+		const uint8_t* blocks_ = nullptr;
+		uint64_t count_ = 0;
+		uint64_t block_count_ = 0;
+		uint32_t block_size_ = 0;
+
+	public:
+		// Compress ids into a self-describing container
+		static std::vector<uint8_t> encode(const std::vector<int>& ids, uint32_t block_size = 4096) {
+			if (block_size == 0) block_size = 4096;
+			// Keep blocks a multiple of four so every block starts a new control byte
+			block_size = (block_size + 3) & ~3u;
+
+			uint64_t block_count = (ids.size() + block_size - 1) / block_size;
+			std::vector<uint8_t> out(sizeof(Header) + block_count * sizeof(uint64_t));
+
+			Header header;
+			std::memcpy(header.magic, magic_, sizeof(magic_));
+			header.block_size = block_size;
+			header.reserved = 0;
+			header.count = ids.size();
+			header.block_count = block_count;
+			std::memcpy(out.data(), &header, sizeof(header));
+
+			size_t block_area = out.size();
+			for (uint64_t b = 0; b < block_count; ++b) {
+				uint64_t offset = out.size() - block_area;
+				std::memcpy(out.data() + sizeof(Header) + b * sizeof(uint64_t), &offset, sizeof(offset));
+
+				size_t first = static_cast<size_t>(b * block_size);
+				uint32_t n = static_cast<uint32_t>(std::min<size_t>(block_size, ids.size() - first));
+				uint32_t control_bytes = (n + 3) / 4;
+
+				size_t block_start = out.size();
+				out.resize(block_start + 2 * sizeof(uint32_t) + control_bytes + 4 * static_cast<size_t>(n));
+				uint8_t* control = out.data() + block_start + 2 * sizeof(uint32_t);
+				uint8_t* data = control + control_bytes;
+				std::memset(control, 0, control_bytes);
+
+				for (uint32_t i = 0; i < n; ++i) {
+					uint32_t value = static_cast<uint32_t>(ids[first + i]);
+					uint32_t code = code_for(value);
+					control[i / 4] |= static_cast<uint8_t>(code << (2 * (i % 4)));
+					for (uint32_t byte = 0; byte <= code; ++byte) {
+						*data++ = static_cast<uint8_t>(value >> (8 * byte));
+					}
+				}
+
+				uint32_t data_bytes = static_cast<uint32_t>(data - (control + control_bytes));
+				std::memcpy(out.data() + block_start, &n, sizeof(n));
+				std::memcpy(out.data() + block_start + sizeof(uint32_t), &data_bytes, sizeof(data_bytes));
+				out.resize(block_start + 2 * sizeof(uint32_t) + control_bytes + data_bytes);
+			}
+
+			out.resize(out.size() + padding_, 0);
+			return out;
+		}
+
+		// Attach to an encoded container (e.g. a MappedFile). The memory must
+		// outlive the codec. Returns false if the container is malformed.
+		bool open(const void* data, size_t size) {
+			*this = TokenIdCodec();
+
+			Header header;
+			if (size < sizeof(header) + padding_) return false;
+			std::memcpy(&header, data, sizeof(header));
+			if (std::memcmp(header.magic, magic_, sizeof(magic_)) != 0 ||
+				header.block_size == 0 || header.block_size % 4 != 0 ||
+				header.block_count > (size - sizeof(header)) / sizeof(uint64_t)) {
+				return false;
+			}
+			// block_count must be exactly ceil(count / block_size); division keeps it overflow-safe
+			uint64_t full_blocks = header.count / header.block_size;
+			uint64_t needed_blocks = full_blocks + (header.count % header.block_size != 0 ? 1 : 0);
+			if (header.block_count != needed_blocks) return false;
+
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			size_t block_area = sizeof(header) + header.block_count * sizeof(uint64_t);
+			if (size - padding_ < block_area) return false;
+			size_t block_area_size = size - padding_ - block_area;
+			// Every id takes at least one data byte
+			if (header.count > block_area_size) return false;
+
+			// Validate every block once so decoding needs no further checks
+			for (uint64_t b = 0; b < header.block_count; ++b) {
+				uint64_t offset;
+				std::memcpy(&offset, bytes + sizeof(header) + b * sizeof(uint64_t), sizeof(offset));
+				if (offset > block_area_size || block_area_size - offset < 2 * sizeof(uint32_t)) return false;
+
+				uint32_t n, data_bytes;
+				std::memcpy(&n, bytes + block_area + offset, sizeof(n));
+				std::memcpy(&data_bytes, bytes + block_area + offset + sizeof(n), sizeof(data_bytes));
+
+				uint64_t expected = b + 1 < header.block_count ? header.block_size :
+					header.count - b * header.block_size;
+				uint64_t block_bytes = 2 * sizeof(uint32_t) + (n + 3) / 4 + static_cast<uint64_t>(data_bytes);
+				if (n != expected || data_bytes > 4ull * n || block_bytes > block_area_size - offset) return false;
+
+				// The length codes must account for exactly the stored data bytes
+				const uint8_t* control = bytes + block_area + offset + 2 * sizeof(uint32_t);
+				uint64_t coded = 0;
+				for (uint32_t g = 0; g < n / 4; ++g) {
+					coded += tables().length[control[g]];
+				}
+				for (uint32_t i = n / 4 * 4; i < n; ++i) {
+					coded += ((control[i / 4] >> (2 * (i % 4))) & 3) + 1;
+				}
+				if (coded != data_bytes) return false;
+			}
+
+			data_ = bytes;
+			size_ = size;
+			offsets_ = reinterpret_cast<const uint64_t*>(bytes + sizeof(header));
+			blocks_ = bytes + block_area;
+			count_ = header.count;
+			block_count_ = header.block_count;
+			block_size_ = header.block_size;
+			return true;
+		}
+
+		size_t size() const { return static_cast<size_t>(count_); }
+		size_t block_count() const { return static_cast<size_t>(block_count_); }
+		size_t block_size() const { return block_size_; }
+
+		// Decode one block into out (resized to the block's id count)
+		void decode_block(size_t block, std::vector<int>& out) const {
+			uint64_t offset;
+			std::memcpy(&offset, offsets_ + block, sizeof(offset));
+			const uint8_t* p = blocks_ + offset;
+
+			uint32_t n;
+			std::memcpy(&n, p, sizeof(n));
+			const uint8_t* control = p + 2 * sizeof(uint32_t);
+
+			out.resize(n);
+			decode_group_stream(control, control + (n + 3) / 4, n, out.data());
+		}
+
+		// Decode the whole container
+		void decode(std::vector<int>& out) const {
+			out.resize(static_cast<size_t>(count_));
+			for (size_t b = 0; b < block_count_; ++b) {
+				uint64_t offset;
+				std::memcpy(&offset, offsets_ + b, sizeof(offset));
+				const uint8_t* p = blocks_ + offset;
+
+				uint32_t n;
+				std::memcpy(&n, p, sizeof(n));
+				const uint8_t* control = p + 2 * sizeof(uint32_t);
+				decode_group_stream(control, control + (n + 3) / 4, n, out.data() + b * block_size_);
+			}
+		}
+
+		// Random access to a single id (decodes only the group prefix it needs)
+		int at(size_t index) const {
+			size_t block = index / block_size_;
+			size_t within = index % block_size_;
+
+			uint64_t offset;
+			std::memcpy(&offset, offsets_ + block, sizeof(offset));
+			const uint8_t* control = blocks_ + offset + 2 * sizeof(uint32_t);
+			uint32_t n;
+			std::memcpy(&n, blocks_ + offset, sizeof(n));
+
+			const DecodeTables& t = tables();
+			const uint8_t* data = control + (n + 3) / 4;
+			for (size_t g = 0; g < within / 4; ++g) {
+				data += t.length[control[g]];
+			}
+
+			int group[4];
+			decode_scalar(control + within / 4, data, within % 4 + 1, group);
+			return group[within % 4];
+		}
+	};
+
+	// Wait policies for the blocking queue operations. BusySpinWait never
+	// leaves the CPU (lowest latency, burns a core); BackoffWait spins briefly,
+	// then yields, then sleeps, which suits pipelines with I/O-bound stages.
+	inline void cpu_relax() {
+#if defined(MTT_SSE2)
+		_mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+		__asm__ __volatile__("yield");
+#endif
+	}
+
+	struct BusySpinWait {
+		void operator()() { cpu_relax(); }
+	};
+
+	struct BackoffWait {
+		unsigned rounds = 0;
+		unsigned sleep_us = 16;
+
+		void operator()() {
+			if (rounds < 64) {
+				cpu_relax();
+			}
+			else if (rounds < 128) {
+				std::this_thread::yield();
+			}
+			else {
+				// Doubling sleeps keep long idle waits from stealing CPU time
+				std::this_thread::sleep_for(std::chrono::microseconds(sleep_us));
+				sleep_us = std::min(sleep_us * 2, 1024u);
+			}
+			rounds++;
+		}
+	};
+
+	// Hardware destructive interference size, spelled out for toolchains that
+	// do not provide std::hardware_destructive_interference_size
+	inline constexpr size_t cache_line_size = 64;
+
+	// Bounded single-producer/single-consumer ring. Head and tail live on
+	// separate cache lines and each side caches the other's index, so the
+	// shared lines are only touched when the ring looks full or empty.
+	// T must be default-constructible and move-assignable.
+	template<typename T, typename Wait = BackoffWait>
+	class SpscQueue
+	{
+	private:
+		std::unique_ptr<T[]> slots_;
+		size_t mask_;
+
+		alignas(cache_line_size) std::atomic<size_t> head_{ 0 };	// next slot to pop
+		size_t cached_tail_ = 0;
+		alignas(cache_line_size) std::atomic<size_t> tail_{ 0 };	// next slot to push
+		size_t cached_head_ = 0;
+		alignas(cache_line_size) std::atomic<bool> closed_{ false };
+
+	public:
+		// Capacity is rounded up to a power of two
+		explicit SpscQueue(size_t capacity) {
+			size_t size = 2;
+			while (size < capacity) size <<= 1;
+			slots_.reset(new T[size]);
+			mask_ = size - 1;
+		}
+
+		SpscQueue(const SpscQueue&) = delete;
+		SpscQueue& operator=(const SpscQueue&) = delete;
+
+		size_t capacity() const { return mask_ + 1; }
+
+		bool try_push(T& value) {
+			size_t tail = tail_.load(std::memory_order_relaxed);
+			if (tail - cached_head_ > mask_) {
+				cached_head_ = head_.load(std::memory_order_acquire);
+				if (tail - cached_head_ > mask_) return false;
+			}
+			slots_[tail & mask_] = std::move(value);
+			tail_.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool try_push(T&& value) {
+			return try_push(value);
+		}
+
+		// Push up to count items from first; returns how many were pushed.
+		// All of them become visible to the consumer with a single store.
+		template<typename It>
+		size_t try_push_batch(It first, size_t count) {
+			size_t tail = tail_.load(std::memory_order_relaxed);
+			size_t free_slots = capacity() - (tail - cached_head_);
+			if (free_slots < count) {
+				cached_head_ = head_.load(std::memory_order_acquire);
+				free_slots = capacity() - (tail - cached_head_);
+			}
+			size_t n = std::min(count, free_slots);
+			for (size_t i = 0; i < n; ++i, ++first) {
+				slots_[(tail + i) & mask_] = std::move(*first);
+			}
+			if (n > 0) tail_.store(tail + n, std::memory_order_release);
+			return n;
+		}
+
+		bool try_pop(T& value) {
+			size_t head = head_.load(std::memory_order_relaxed);
+			if (head == cached_tail_) {
+				cached_tail_ = tail_.load(std::memory_order_acquire);
+				if (head == cached_tail_) return false;
+			}
+			value = std::move(slots_[head & mask_]);
+			head_.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Pop up to max_count items into out; returns how many were popped
+		template<typename OutIt>
+		size_t try_pop_batch(OutIt out, size_t max_count) {
+			size_t head = head_.load(std::memory_order_relaxed);
+			if (cached_tail_ - head < max_count) {
+				cached_tail_ = tail_.load(std::memory_order_acquire);
+			}
+			size_t n = std::min(max_count, cached_tail_ - head);
+			for (size_t i = 0; i < n; ++i, ++out) {
+				*out = std::move(slots_[(head + i) & mask_]);
+			}
+			if (n > 0) head_.store(head + n, std::memory_order_release);
+			return n;
+		}
+
+		// Blocking push: waits while the queue is full
+		void push(T value) {
+			Wait wait;
+			while (!try_push(value)) wait();
+		}
+
+		// Blocking pop: waits for an item; false once closed and drained
+		bool pop(T& value) {
+			Wait wait;
+			while (!try_pop(value)) {
+				if (closed_.load(std::memory_order_acquire)) return try_pop(value);
+				wait();
+			}
+			return true;
+		}
+
+		// Producer is done; consumers drain what is left and then stop
+		void close() { closed_.store(true, std::memory_order_release); }
+		bool is_closed() const { return closed_.load(std::memory_order_acquire); }
+	};
+
+	// Bounded multi-producer/multi-consumer ring (Vyukov's sequence-numbered
+	// cells). Producers and consumers each claim slots with one CAS on their
+	// own cache line; no locks are taken.
+	// T must be default-constructible and move-assignable.
+	template<typename T, typename Wait = BackoffWait>
+	class MpmcQueue
+	{
+	private:
+		struct Cell {
+			std::atomic<size_t> sequence;
+			T value;
+		};
+
+		std::unique_ptr<Cell[]> cells_;
+		size_t mask_;
+
+		alignas(cache_line_size) std::atomic<size_t> enqueue_pos_{ 0 };
+		alignas(cache_line_size) std::atomic<size_t> dequeue_pos_{ 0 };
+		alignas(cache_line_size) std::atomic<bool> closed_{ false };
+
+	public:
+		// Capacity is rounded up to a power of two
+		explicit MpmcQueue(size_t capacity) {
+			size_t size = 2;
+			while (size < capacity) size <<= 1;
+			cells_.reset(new Cell[size]);
+			for (size_t i = 0; i < size; ++i) {
+				cells_[i].sequence.store(i, std::memory_order_relaxed);
+			}
+			mask_ = size - 1;
+		}
+
+		MpmcQueue(const MpmcQueue&) = delete;
+		MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+		size_t capacity() const { return mask_ + 1; }
+
+		bool try_push(T& value) {
+			size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+			for (;;) {
+				Cell& cell = cells_[pos & mask_];
+				size_t sequence = cell.sequence.load(std::memory_order_acquire);
+				std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+				if (diff == 0) {
+					if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						cell.value = std::move(value);
+						cell.sequence.store(pos + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (diff < 0) {
+					return false;	// full
+				}
+				else {
+					pos = enqueue_pos_.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		bool try_push(T&& value) {
+			return try_push(value);
+		}
+
+		bool try_pop(T& value) {
+			size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+			for (;;) {
+				Cell& cell = cells_[pos & mask_];
+				size_t sequence = cell.sequence.load(std::memory_order_acquire);
+				std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+				if (diff == 0) {
+					if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						value = std::move(cell.value);
+						cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (diff < 0) {
+					return false;	// empty
+				}
+				else {
+					pos = dequeue_pos_.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		// Push up to count items from first; stops at the first full slot
+		template<typename It>
+		size_t try_push_batch(It first, size_t count) {
+			size_t n = 0;
+			for (; n < count && try_push(*first); ++n, ++first) {}
+			return n;
+		}
+
+		// Pop up to max_count items into out; stops when the queue is empty
+		template<typename OutIt>
+		size_t try_pop_batch(OutIt out, size_t max_count) {
+			size_t n = 0;
+			T value;
+			for (; n < max_count && try_pop(value); ++n, ++out) {
+				*out = std::move(value);
+			}
+			return n;
+		}
+
+		// Blocking push: waits while the queue is full
+		void push(T value) {
+			Wait wait;
+			while (!try_push(value)) wait();
+		}
+
+		// Blocking pop: waits for an item; false once closed and drained
+		bool pop(T& value) {
+			Wait wait;
+			while (!try_pop(value)) {
+				if (closed_.load(std::memory_order_acquire)) return try_pop(value);
+				wait();
+			}
+			return true;
+		}
+
+		// All producers are done; consumers drain what is left and then stop
+		void close() { closed_.store(true, std::memory_order_release); }
+		bool is_closed() const { return closed_.load(std::memory_order_acquire); }
+	};
+
+	// Wire protocol of the local tokenizer daemon (tokenizer-daemon). Every
+	// message is a fixed header followed by payload_bytes of payload, in host
+	// byte order since both ends run on the same machine.
+	//  encode / encode_sequence request: UTF-8 text
+	//  decode request:                   int32 ids
+	//  encode replies:                   int32 ids
+	//  decode reply:                     UTF-8 text
+	// encode_sequence packs max_length into arg and add_special_tokens into flags.
+	namespace DaemonProtocol
+	{
+		static_assert(sizeof(int) == sizeof(int32_t), "ids travel as int32");
+
+		inline constexpr uint32_t magic = 0x4454544D;	// "MTTD"
+		inline constexpr uint32_t max_payload_bytes = 256u * 1024 * 1024;
+
+		enum Op : uint8_t {
+			op_encode = 1,
+			op_decode = 2,
+			op_encode_sequence = 3,
+			op_vocab_size = 4
+		};
+
+		enum Status : uint8_t {
+			status_ok = 0,
+			status_bad_request = 1,
+			status_unknown_model = 2,
+			status_too_large = 3,
+			status_internal_error = 4
+		};
+
+		enum Flags : uint8_t {
+			flag_add_special_tokens = 1
+		};
+
+		struct Header {
+			uint32_t magic;
+			uint8_t op;
+			uint8_t status;	// reply only
+			uint8_t flags;
+			uint8_t model;	// index of the tokenizer loaded by the daemon
+			uint32_t request_id;
+			int32_t arg;
+			uint32_t payload_bytes;
+		};
+
+#ifdef MTT_POSIX
+		// Read/write exactly n bytes, retrying on EINTR and short transfers
+		inline bool read_all(int fd, void* dst, size_t n) {
+			char* p = static_cast<char*>(dst);
+			while (n > 0) {
+				ssize_t got = ::read(fd, p, n);
+				if (got > 0) {
+					p += got;
+					n -= static_cast<size_t>(got);
+				}
+				else if (got == 0 || errno != EINTR) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		inline bool write_all(int fd, const void* src, size_t n) {
+			const char* p = static_cast<const char*>(src);
+			while (n > 0) {
+#ifdef MSG_NOSIGNAL
+				ssize_t put = ::send(fd, p, n, MSG_NOSIGNAL);
+#else
+				ssize_t put = ::write(fd, p, n);
+#endif
+				if (put > 0) {
+					p += put;
+					n -= static_cast<size_t>(put);
+				}
+				else if (put < 0 && errno != EINTR) {
+					return false;
+				}
+			}
+			return true;
 		}
 
-		TextTokenizer& set_split_on_punctuation(bool enable) {
-			split_on_punctuation_ = enable;
-			return *this;
+		// Send header + payload as one message
+		inline bool send_message(int fd, Header header, const void* payload, size_t payload_bytes) {
+			header.magic = magic;
+			header.payload_bytes = static_cast<uint32_t>(payload_bytes);
+			std::string frame(sizeof(header) + payload_bytes, '\0');
+			std::memcpy(&frame[0], &header, sizeof(header));
+			if (payload_bytes > 0) {
+				std::memcpy(&frame[sizeof(header)], payload, payload_bytes);
+			}
+			return write_all(fd, frame.data(), frame.size());
 		}
+#endif
+	}
 
-		TextTokenizer& add_delimiter(char delim) {
-			delimiters_.insert(delim);
-			return *this;
+#ifdef MTT_POSIX
+	// Thin synchronous client for tokenizer-daemon. One request is in flight
+	// per client; use one client per thread.
+	class TokenizerClient
+	{
+	private:
+		int fd_ = -1;
+		uint32_t next_request_id_ = 1;
+		std::string payload_;
+
+		bool call(DaemonProtocol::Header request, const void* payload, size_t payload_bytes,
+			DaemonProtocol::Header& reply) {
+			if (fd_ < 0) return false;
+
+			request.request_id = next_request_id_++;
+			if (!DaemonProtocol::send_message(fd_, request, payload, payload_bytes) ||
+				!DaemonProtocol::read_all(fd_, &reply, sizeof(reply)) ||
+				reply.magic != DaemonProtocol::magic ||
+				reply.request_id != request.request_id ||
+				reply.payload_bytes > DaemonProtocol::max_payload_bytes) {
+				close();
+				return false;
+			}
+
+			payload_.resize(reply.payload_bytes);
+			if (reply.payload_bytes > 0 && !DaemonProtocol::read_all(fd_, &payload_[0], reply.payload_bytes)) {
+				close();
+				return false;
+			}
+			return reply.status == DaemonProtocol::status_ok;
 		}
 
-		TextTokenizer& add_delimiters(const std::string& delims) {
-			for (char c : delims) {
-				delimiters_.insert(c);
+		bool ids_from_payload(std::vector<int>& ids) const {
+			if (payload_.size() % sizeof(int32_t) != 0) return false;
+			ids.resize(payload_.size() / sizeof(int32_t));
+			if (!ids.empty()) {
+				std::memcpy(ids.data(), payload_.data(), payload_.size());
 			}
-			return *this;
+			return true;
 		}
 
-		// Vocabulary configuration methods
-		TextTokenizer& set_special_tokens(const std::string& unk = "[UNK]",
-			const std::string& pad = "[PAD]",
-			const std::string& cls = "[CLS]",
-			const std::string& sep = "[SEP]") {
-			unk_token_ = unk;
-			pad_token_ = pad;
-			cls_token_ = cls;
-			sep_token_ = sep;
-			return *this;
+	public:
+		TokenizerClient() = default;
+		TokenizerClient(const TokenizerClient&) = delete;
+		TokenizerClient& operator=(const TokenizerClient&) = delete;
+
+		~TokenizerClient() {
+			close();
 		}
 
-		// Load vocabulary from file
-		bool load_vocab(const std::string& vocab_file) {
-			std::ifstream file(vocab_file);
-			if (!file.is_open()) {
+		bool connect(const std::string& socket_path) {
+			close();
+
+			sockaddr_un addr;
+			std::memset(&addr, 0, sizeof(addr));
+			addr.sun_family = AF_UNIX;
+			if (socket_path.size() >= sizeof(addr.sun_path)) return false;
+			std::memcpy(addr.sun_path, socket_path.c_str(), socket_path.size() + 1);
+
+			fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+			if (fd_ < 0) return false;
+			if (::connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+				close();
 				return false;
 			}
+			return true;
+		}
 
-			vocab_to_id_.clear();
-			id_to_vocab_.clear();
-
-			std::string token;
-			int id = 0;
+		void close() {
+			if (fd_ >= 0) {
+				::close(fd_);
+				fd_ = -1;
+			}
+		}
 
-			while (std::getline(file, token)) {
-				// Remove trailing whitespace
-				token.erase(token.find_last_not_of(" \t\r\n") + 1);
+		bool is_connected() const { return fd_ >= 0; }
 
-				if (!token.empty()) {
-					vocab_to_id_[token] = id;
-					id_to_vocab_.push_back(token);
+		bool encode(std::string_view text, std::vector<int>& ids, uint8_t model = 0) {
+			DaemonProtocol::Header request = {};
+			request.op = DaemonProtocol::op_encode;
+			request.model = model;
+			DaemonProtocol::Header reply;
+			return call(request, text.data(), text.size(), reply) && ids_from_payload(ids);
+		}
 
-					// Store special token IDs
-					if (token == unk_token_) unk_id_ = id;
-					else if (token == pad_token_) pad_id_ = id;
-					else if (token == cls_token_) cls_id_ = id;
-					else if (token == sep_token_) sep_id_ = id;
+		bool encode_sequence(std::string_view text, std::vector<int>& ids, int max_length = 512,
+			bool add_special_tokens = true, uint8_t model = 0) {
+			DaemonProtocol::Header request = {};
+			request.op = DaemonProtocol::op_encode_sequence;
+			request.model = model;
+			request.arg = max_length;
+			request.flags = add_special_tokens ? DaemonProtocol::flag_add_special_tokens : 0;
+			DaemonProtocol::Header reply;
+			return call(request, text.data(), text.size(), reply) && ids_from_payload(ids);
+		}
 
-					id++;
-				}
-			}
+		bool decode(const std::vector<int>& ids, std::string& text, uint8_t model = 0) {
+			DaemonProtocol::Header request = {};
+			request.op = DaemonProtocol::op_decode;
+			request.model = model;
+			DaemonProtocol::Header reply;
+			if (!call(request, ids.data(), ids.size() * sizeof(int32_t), reply)) return false;
+			text = payload_;
+			return true;
+		}
 
-			use_vocab_ = true;
+		bool vocab_size(size_t& size, uint8_t model = 0) {
+			DaemonProtocol::Header request = {};
+			request.op = DaemonProtocol::op_vocab_size;
+			request.model = model;
+			DaemonProtocol::Header reply;
+			if (!call(request, nullptr, 0, reply)) return false;
+			size = static_cast<size_t>(static_cast<uint32_t>(reply.arg));
 			return true;
 		}
+	};
+#endif
 
-		// Create vocabulary from tokenized text
-		TextTokenizer& build_vocab_from_text(const std::vector<std::string>& texts,
-			int min_frequency = 1,
-			int max_vocab_size = 50000) {
-			std::unordered_map<std::string, int> token_counts;
+#ifdef MTT_LINUX
+	// Shared-memory transport of tokenizer-daemon (--shm). The daemon creates
+	// one POSIX shared memory segment with a slot per client; each slot holds
+	// a ring of request entries, and every entry has room for the request
+	// text and the response ids. Clients write text straight into the ring
+	// and read ids straight out of it, so nothing is copied through the
+	// kernel. Both sides spin briefly and then sleep on futexes living in the
+	// segment itself.
+	namespace SharedMemoryProtocol
+	{
+		static_assert(std::atomic<uint32_t>::is_always_lock_free, "futex words must be lock-free");
 
-			// Count token frequencies
-			for (const auto& text : texts) {
-				auto tokens = tokenize(text);
-				for (const auto& token : tokens) {
-					token_counts[token]++;
-				}
-			}
+		inline constexpr uint32_t magic = 0x5354544D;	// "MTTS"
+		inline constexpr uint32_t version = 1;
 
-			// Sort by frequency
-			std::vector<std::pair<std::string, int>> sorted_tokens;
-			for (const auto& pair : token_counts) {
-				if (pair.second >= min_frequency) {
-					sorted_tokens.push_back(pair);
-				}
-			}
+		struct SegmentHeader {
+			uint32_t magic;
+			uint32_t version;
+			uint32_t slot_count;
+			uint32_t ring_entries;
+			uint32_t text_capacity;	// bytes of text per entry
+			uint32_t ids_capacity;	// ids per entry
+			uint64_t slot_bytes;
+			uint64_t entry_bytes;
+			int32_t server_pid;
+			std::atomic<uint32_t> ready;	// set last, once the segment is initialized
+		};
 
-			std::sort(sorted_tokens.begin(), sorted_tokens.end(),
-				[](const auto& a, const auto& b) {
-					return a.second > b.second;
-				});
+		// Request/response indices increase forever; entry = index % ring_entries.
+		// The client owns request_tail and response_head, the server owns
+		// response_tail. *_signal are futex words bumped on every publish.
+		struct SlotHeader {
+			std::atomic<uint32_t> owner;	// client pid, 0 when free
+			alignas(cache_line_size) std::atomic<uint32_t> request_tail;
+			std::atomic<uint32_t> request_signal;
+			std::atomic<uint32_t> server_waiting;
+			alignas(cache_line_size) std::atomic<uint32_t> response_tail;
+			std::atomic<uint32_t> response_signal;
+			std::atomic<uint32_t> client_waiting;
+			alignas(cache_line_size) std::atomic<uint32_t> response_head;
+		};
 
-			// Build vocabulary
-			vocab_to_id_.clear();
-			id_to_vocab_.clear();
+		// Entry layout: EntryHeader, text[text_capacity], int32 ids[ids_capacity]
+		struct EntryHeader {
+			uint8_t op;	// DaemonProtocol::Op
+			uint8_t flags;	// DaemonProtocol::Flags
+			uint8_t model;
+			uint8_t status;	// DaemonProtocol::Status, set by the server
+			int32_t arg;
+			uint32_t text_bytes;
+			uint32_t id_count;
+		};
 
-			// Add special tokens first
-			std::vector<std::string> special_tokens = { pad_token_, unk_token_, cls_token_, sep_token_ };
-			for (const auto& token : special_tokens) {
-				if (vocab_to_id_.find(token) == vocab_to_id_.end()) {
-					int id = static_cast<int>(id_to_vocab_.size());
-					vocab_to_id_[token] = id;
-					id_to_vocab_.push_back(token);
+		inline size_t round_up(size_t n, size_t align) {
+			return (n + align - 1) / align * align;
+		}
 
-					if (token == unk_token_) unk_id_ = id;
-					else if (token == pad_token_) pad_id_ = id;
-					else if (token == cls_token_) cls_id_ = id;
-					else if (token == sep_token_) sep_id_ = id;
-				}
-			}
+		inline size_t entry_bytes(uint32_t text_capacity, uint32_t ids_capacity) {
+			return round_up(sizeof(EntryHeader) + round_up(text_capacity, 8) + ids_capacity * sizeof(int32_t), cache_line_size);
+		}
 
-			// Add regular tokens
-			int added = 0;
-			for (const auto& pair : sorted_tokens) {
-				if (vocab_to_id_.find(pair.first) == vocab_to_id_.end() &&
-					added < max_vocab_size - static_cast<int>(special_tokens.size())) {
-					int id = static_cast<int>(id_to_vocab_.size());
-					vocab_to_id_[pair.first] = id;
-					id_to_vocab_.push_back(pair.first);
-					added++;
-				}
-			}
+		inline size_t slot_bytes(uint32_t ring_entries, size_t entry_size) {
+			return round_up(sizeof(SlotHeader), cache_line_size) + ring_entries * entry_size;
+		}
 
-			use_vocab_ = true;
-			return *this;
+		inline size_t segment_bytes(uint32_t slot_count, size_t slot_size) {
+			return round_up(sizeof(SegmentHeader), cache_line_size) + slot_count * slot_size;
 		}
 
-		// Save vocabulary to file
-		bool save_vocab(const std::string& vocab_file) const {
-			if (!use_vocab_) return false;
+		inline SlotHeader* slot_at(void* segment, uint32_t slot) {
+			const SegmentHeader* header = static_cast<const SegmentHeader*>(segment);
+			return reinterpret_cast<SlotHeader*>(static_cast<char*>(segment) +
+				round_up(sizeof(SegmentHeader), cache_line_size) + slot * header->slot_bytes);
+		}
 
-			std::ofstream file(vocab_file);
-			if (!file.is_open()) return false;
+		inline EntryHeader* entry_at(const SegmentHeader* header, SlotHeader* slot, uint32_t index) {
+			return reinterpret_cast<EntryHeader*>(reinterpret_cast<char*>(slot) +
+				round_up(sizeof(SlotHeader), cache_line_size) + (index % header->ring_entries) * header->entry_bytes);
+		}
 
-			for (const auto& token : id_to_vocab_) {
-				file << token << "\n";
-			}
+		inline char* entry_text(EntryHeader* entry) {
+			return reinterpret_cast<char*>(entry + 1);
+		}
 
-			return true;
+		inline int32_t* entry_ids(const SegmentHeader* header, EntryHeader* entry) {
+			return reinterpret_cast<int32_t*>(entry_text(entry) + round_up(header->text_capacity, 8));
 		}
 
-		// Main tokenization method
-		std::vector<std::string> tokenize(std::string_view text) const {
-			std::vector<std::string> tokens;
+		// Sleep while *word == expected (shared, not process-private futex).
+		// Returns false on timeout.
+		inline bool futex_wait(std::atomic<uint32_t>* word, uint32_t expected, long timeout_ms) {
+			timespec timeout;
+			timeout.tv_sec = timeout_ms / 1000;
+			timeout.tv_nsec = (timeout_ms % 1000) * 1000000L;
+			long rc = ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+			return !(rc == -1 && errno == ETIMEDOUT);
+		}
 
-			size_t start = 0;
-			size_t i = 0;
+		inline void futex_wake(std::atomic<uint32_t>* word) {
+			::syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+		}
 
-			while (i < text.size()) {
-				unsigned char c = text[i];
+		inline bool process_alive(int32_t pid) {
+			return pid > 0 && (::kill(pid, 0) == 0 || errno != ESRCH);
+		}
+	}
 
-				// Handle UTF-8 multibyte characters
-				if ((c & 0x80) != 0) {
-					size_t char_len = utf8_char_length(c);
-					i += char_len;
-					continue;
-				}
+	// Client for the shared-memory transport. Up to ring_entries requests can
+	// be in flight; responses arrive in request order. The zero-copy calls
+	// (request_text / submit / wait_ids / release) let callers write text and
+	// read ids in place; encode/encode_sequence/decode wrap them for
+	// convenience. Use one client per thread.
+	class ShmTokenizerClient
+	{
+	private:
+		void* segment_ = nullptr;
+		size_t segment_size_ = 0;
+		SharedMemoryProtocol::SegmentHeader* header_ = nullptr;
+		SharedMemoryProtocol::SlotHeader* slot_ = nullptr;
+		uint32_t next_request_ = 0;
+		uint32_t response_head_ = 0;
 
-				// ASCII character - check if we should split
-				if (should_split_at(c)) {
-					// Add token if we have content
-					if (i > start) {
-						auto token_view = text.substr(start, i - start);
-						if (!token_view.empty()) {
-							tokens.push_back(normalize_token(token_view));
-						}
-					}
+		// Spin iterations before falling back to a futex sleep
+		static constexpr int spin_count_ = 256;
 
-					// Add punctuation as separate token if keeping it
-					if (keep_punctuation_ && is_ascii_punct(c)) {
-						tokens.push_back(normalize_token(text.substr(i, 1)));
-					}
+		SharedMemoryProtocol::EntryHeader* entry(uint32_t index) const {
+			return SharedMemoryProtocol::entry_at(header_, slot_, index);
+		}
 
-					// Skip whitespace, find next non-delimiter
-					while (i < text.size() && should_split_at(text[i])) {
-						// If we're keeping punctuation, add each punct char
-						if (keep_punctuation_ && is_ascii_punct(text[i]) &&
-							i > start + (i - start > 0 ? 1 : 0)) {
-							tokens.push_back(normalize_token(text.substr(i, 1)));
-						}
-						i++;
-					}
-					start = i;
-				}
-				else {
-					i++;
-				}
+		bool publish(uint8_t op, uint8_t flags, int32_t arg, uint8_t model, size_t text_bytes, size_t id_count) {
+			if (!slot_ || next_request_ - response_head_ >= header_->ring_entries ||
+				text_bytes > header_->text_capacity || id_count > header_->ids_capacity) {
+				return false;
 			}
 
-			// Add final token if any
-			if (start < text.size()) {
-				auto token_view = text.substr(start);
-				if (!token_view.empty()) {
-					tokens.push_back(normalize_token(token_view));
-				}
-			}
+			SharedMemoryProtocol::EntryHeader* e = entry(next_request_);
+			e->op = op;
+			e->flags = flags;
+			e->model = model;
+			e->status = 0;
+			e->arg = arg;
+			e->text_bytes = static_cast<uint32_t>(text_bytes);
+			e->id_count = static_cast<uint32_t>(id_count);
 
-			return tokens;
+			slot_->request_tail.store(++next_request_, std::memory_order_seq_cst);
+			slot_->request_signal.fetch_add(1, std::memory_order_seq_cst);
+			if (slot_->server_waiting.load(std::memory_order_seq_cst)) {
+				SharedMemoryProtocol::futex_wake(&slot_->request_signal);
+			}
+			return true;
 		}
 
-		// Tokenize and return token IDs
-		std::vector<int> encode(std::string_view text) const {
-			auto tokens = tokenize(text);
-			std::vector<int> ids;
-			ids.reserve(tokens.size());
+		// Wait until the oldest outstanding request has been answered
+		bool wait_response() {
+			if (!slot_ || response_head_ == next_request_) return false;
 
-			if (!use_vocab_) {
-				// If no vocabulary, just return indices based on order
-				for (size_t i = 0; i < tokens.size(); ++i) {
-					ids.push_back(static_cast<int>(i));
+			for (int spin = 0; ; ++spin) {
+				if (slot_->response_tail.load(std::memory_order_acquire) != response_head_) return true;
+				if (spin < spin_count_) {
+					cpu_relax();
+					continue;
 				}
-				return ids;
-			}
 
-			for (const auto& token : tokens) {
-				auto it = vocab_to_id_.find(token);
-				if (it != vocab_to_id_.end()) {
-					ids.push_back(it->second);
-				}
-				else {
-					ids.push_back(unk_id_);
+				slot_->client_waiting.store(1, std::memory_order_seq_cst);
+				uint32_t signal = slot_->response_signal.load(std::memory_order_seq_cst);
+				if (slot_->response_tail.load(std::memory_order_seq_cst) == response_head_ &&
+					!SharedMemoryProtocol::futex_wait(&slot_->response_signal, signal, 100) &&
+					!SharedMemoryProtocol::process_alive(header_->server_pid)) {
+					slot_->client_waiting.store(0, std::memory_order_relaxed);
+					return false;
 				}
+				slot_->client_waiting.store(0, std::memory_order_relaxed);
 			}
-
-			return ids;
 		}
 
-		// Decode token IDs back to text
-		std::string decode(const std::vector<int>& ids) const {
-			if (!use_vocab_) return "";
+	public:
+		ShmTokenizerClient() = default;
+		ShmTokenizerClient(const ShmTokenizerClient&) = delete;
+		ShmTokenizerClient& operator=(const ShmTokenizerClient&) = delete;
 
-			std::ostringstream result;
-			bool first = true;
+		~ShmTokenizerClient() {
+			close();
+		}
 
-			for (int id : ids) {
-				if (id >= 0 && id < static_cast<int>(id_to_vocab_.size())) {
-					const std::string& token = id_to_vocab_[id];
+		// Attach to the segment created by "tokenizer-daemon --shm name" and
+		// claim a free client slot
+		bool connect(const std::string& name) {
+			close();
 
-					// Skip special tokens in output (except for debugging)
-					if (token == pad_token_) continue;
+			int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+			if (fd < 0) return false;
 
-					if (!first) result << " ";
-					result << token;
-					first = false;
-				}
+			struct stat st;
+			if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SharedMemoryProtocol::SegmentHeader)) {
+				::close(fd);
+				return false;
 			}
 
-			return result.str();
-		}
+			segment_size_ = static_cast<size_t>(st.st_size);
+			segment_ = ::mmap(nullptr, segment_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			::close(fd);
+			if (segment_ == MAP_FAILED) {
+				segment_ = nullptr;
+				return false;
+			}
 
-		// Encode with special tokens for sequence classification
-		std::vector<int> encode_sequence(std::string_view text,
-			int max_length = 512,
-			bool add_special_tokens = true) const {
-			auto token_ids = encode(text);
+			header_ = static_cast<SharedMemoryProtocol::SegmentHeader*>(segment_);
+			bool valid = header_->ready.load(std::memory_order_acquire) == 1 &&
+				header_->magic == SharedMemoryProtocol::magic &&
+				header_->version == SharedMemoryProtocol::version &&
+				header_->ring_entries > 0 &&
+				header_->entry_bytes == SharedMemoryProtocol::entry_bytes(header_->text_capacity, header_->ids_capacity) &&
+				header_->slot_bytes == SharedMemoryProtocol::slot_bytes(header_->ring_entries, header_->entry_bytes) &&
+				segment_size_ >= SharedMemoryProtocol::segment_bytes(header_->slot_count, header_->slot_bytes);
+			if (!valid) {
+				close();
+				return false;
+			}
 
-			if (!add_special_tokens || !use_vocab_) {
-				// Truncate if necessary
-				if (static_cast<int>(token_ids.size()) > max_length) {
-					token_ids.resize(max_length);
+			uint32_t pid = static_cast<uint32_t>(::getpid());
+			for (uint32_t i = 0; i < header_->slot_count; ++i) {
+				SharedMemoryProtocol::SlotHeader* slot = SharedMemoryProtocol::slot_at(segment_, i);
+				uint32_t expected = 0;
+				if (slot->owner.compare_exchange_strong(expected, pid)) {
+					slot_ = slot;
+					next_request_ = slot->request_tail.load(std::memory_order_acquire);
+					response_head_ = next_request_;
+					return true;
 				}
-				return token_ids;
 			}
 
-			std::vector<int> result;
+			close();	// all slots taken
+			return false;
+		}
 
-			// Add CLS token at beginning
-			if (cls_id_ >= 0) {
-				result.push_back(cls_id_);
-				max_length--;
+		// Wait for outstanding responses, then give the slot back
+		void close() {
+			if (slot_) {
+				while (response_head_ != next_request_ && wait_response()) {
+					release();
+				}
+				slot_->owner.store(0, std::memory_order_release);
+				slot_ = nullptr;
 			}
-
-			// Add tokens (truncate if necessary)
-			int available_length = max_length - (sep_id_ >= 0 ? 1 : 0);
-			for (int i = 0; i < std::min(static_cast<int>(token_ids.size()), available_length); ++i) {
-				result.push_back(token_ids[i]);
+			if (segment_) {
+				::munmap(segment_, segment_size_);
+				segment_ = nullptr;
 			}
+			header_ = nullptr;
+		}
 
-			// Add SEP token at end
-			if (sep_id_ >= 0) {
-				result.push_back(sep_id_);
-			}
+		bool is_connected() const { return slot_ != nullptr; }
+		size_t max_in_flight() const { return header_ ? header_->ring_entries : 0; }
+		size_t text_capacity() const { return header_ ? header_->text_capacity : 0; }
+		size_t ids_capacity() const { return header_ ? header_->ids_capacity : 0; }
 
-			return result;
+		// Buffer for the next request's text, or nullptr if the ring is full
+		char* request_text() {
+			if (!slot_ || next_request_ - response_head_ >= header_->ring_entries) return nullptr;
+			return SharedMemoryProtocol::entry_text(entry(next_request_));
 		}
 
-		// Get vocabulary size
-		size_t vocab_size() const {
-			return use_vocab_ ? id_to_vocab_.size() : 0;
+		// Submit the text written to request_text() for encoding
+		bool submit_encode(size_t text_bytes, uint8_t model = 0) {
+			return publish(DaemonProtocol::op_encode, 0, 0, model, text_bytes, 0);
 		}
 
-		// Get special token IDs
-		int get_unk_id() const { return unk_id_; }
-		int get_pad_id() const { return pad_id_; }
-		int get_cls_id() const { return cls_id_; }
-		int get_sep_id() const { return sep_id_; }
-
-		std::string get_token_by_id(int id) const {
-			if (!use_vocab_ || id < 0 || id >= static_cast<int>(id_to_vocab_.size())) {
-				return "[INVALID]";
-			}
-			return id_to_vocab_[id];
+		bool submit_encode_sequence(size_t text_bytes, int max_length = 512,
+			bool add_special_tokens = true, uint8_t model = 0) {
+			return publish(DaemonProtocol::op_encode_sequence,
+				add_special_tokens ? DaemonProtocol::flag_add_special_tokens : 0, max_length, model, text_bytes, 0);
 		}
 
-		// Check if using vocabulary
-		bool has_vocab() const { return use_vocab_; }
+		// Wait for the oldest outstanding response and view its ids in place.
+		// The view stays valid until release().
+		bool wait_ids(const int32_t*& ids, size_t& count) {
+			if (!wait_response()) return false;
 
-		// Convenience method for simple whitespace tokenization
-		static std::vector<std::string> simple_split(std::string_view text) {
-			return TextTokenizer().tokenize(text);
+			SharedMemoryProtocol::EntryHeader* e = entry(response_head_);
+			ids = SharedMemoryProtocol::entry_ids(header_, e);
+			count = e->id_count;
+			return e->status == DaemonProtocol::status_ok;
 		}
 
-		// Method to get token count without storing tokens
-		size_t count_tokens(std::string_view text) const {
-			size_t count = 0;
-			size_t start = 0;
-			size_t i = 0;
+		// Hand the oldest response entry back to the ring
+		void release() {
+			if (slot_ && response_head_ != next_request_) {
+				slot_->response_head.store(++response_head_, std::memory_order_release);
+			}
+		}
 
-			while (i < text.size()) {
-				unsigned char c = text[i];
+		bool encode(std::string_view text, std::vector<int>& ids, uint8_t model = 0) {
+			char* buffer = request_text();
+			if (!buffer || text.size() > header_->text_capacity) return false;
+			std::memcpy(buffer, text.data(), text.size());
+			if (!submit_encode(text.size(), model)) return false;
 
-				if ((c & 0x80) != 0) {
-					i += utf8_char_length(c);
-					continue;
-				}
+			const int32_t* view;
+			size_t count;
+			bool ok = wait_ids(view, count);
+			if (ok) ids.assign(view, view + count);
+			release();
+			return ok;
+		}
 
-				if (should_split_at(c)) {
-					if (i > start) count++;
+		bool encode_sequence(std::string_view text, std::vector<int>& ids, int max_length = 512,
+			bool add_special_tokens = true, uint8_t model = 0) {
+			char* buffer = request_text();
+			if (!buffer || text.size() > header_->text_capacity) return false;
+			std::memcpy(buffer, text.data(), text.size());
+			if (!submit_encode_sequence(text.size(), max_length, add_special_tokens, model)) return false;
 
-					if (keep_punctuation_ && is_ascii_punct(c)) count++;
+			const int32_t* view;
+			size_t count;
+			bool ok = wait_ids(view, count);
+			if (ok) ids.assign(view, view + count);
+			release();
+			return ok;
+		}
 
-					while (i < text.size() && should_split_at(text[i])) {
-						if (keep_punctuation_ && is_ascii_punct(text[i]) &&
-							i > start + (i - start > 0 ? 1 : 0)) {
-							count++;
-						}
-						i++;
-					}
-					start = i;
-				}
-				else {
-					i++;
-				}
+		bool decode(const std::vector<int>& ids, std::string& text, uint8_t model = 0) {
+			if (!request_text() || ids.size() > header_->ids_capacity) return false;
+			SharedMemoryProtocol::EntryHeader* e = entry(next_request_);
+			if (!ids.empty()) {
+				std::memcpy(SharedMemoryProtocol::entry_ids(header_, e), ids.data(), ids.size() * sizeof(int32_t));
 			}
+			if (!publish(DaemonProtocol::op_decode, 0, 0, model, 0, ids.size())) return false;
+			if (!wait_response()) return false;
 
-			if (start < text.size()) count++;
-			return count;
+			e = entry(response_head_);
+			bool ok = e->status == DaemonProtocol::status_ok;
+			if (ok) text.assign(SharedMemoryProtocol::entry_text(e), e->text_bytes);
+			release();
+			return ok;
 		}
 	};
+#endif
 }
\ No newline at end of file
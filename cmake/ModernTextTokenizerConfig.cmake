@@ -0,0 +1,5 @@
+# Package configuration for find_package(ModernTextTokenizer)
+include(CMakeFindDependencyMacro)
+find_dependency(Threads)
+
+include("${CMAKE_CURRENT_LIST_DIR}/ModernTextTokenizerTargets.cmake")
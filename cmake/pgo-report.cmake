@@ -0,0 +1,84 @@
+# Builds the plain -O2 baseline and the two-stage PGO configuration from
+# CMakePresets.json, runs the demo's performance workload with both and
+# reports the speedup.
+#
+#   cmake -P cmake/pgo-report.cmake [-DRUNS=20] [-DGENERATOR="Unix Makefiles"]
+#
+# Expects vocab.txt in the source directory, like the demo itself.
+cmake_minimum_required(VERSION 3.19)
+
+get_filename_component(SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+if (NOT RUNS)
+  set(RUNS 20)
+endif()
+if (NOT EXISTS "${SOURCE_DIR}/vocab.txt")
+  message(FATAL_ERROR "vocab.txt not found in ${SOURCE_DIR}")
+endif()
+set(GENERATOR_ARGS)
+if (GENERATOR)
+  set(GENERATOR_ARGS -G "${GENERATOR}")
+endif()
+
+function(run_step)
+  execute_process(COMMAND ${ARGN} WORKING_DIRECTORY "${SOURCE_DIR}" COMMAND_ERROR_IS_FATAL ANY)
+endfunction()
+
+function(build_preset preset binary_dir target)
+  run_step(${CMAKE_COMMAND} --preset ${preset} ${GENERATOR_ARGS})
+  run_step(${CMAKE_COMMAND} --build "${binary_dir}" --target ${target})
+endfunction()
+
+# Best throughput over RUNS runs, in hundredths of MB/s
+function(measure binary result)
+  execute_process(COMMAND "${binary}" --performance ${RUNS}
+    WORKING_DIRECTORY "${SOURCE_DIR}"
+    OUTPUT_VARIABLE output
+    COMMAND_ERROR_IS_FATAL ANY)
+  string(REGEX MATCHALL "Throughput: +[0-9]+\\.[0-9][0-9]" lines "${output}")
+  set(best 0)
+  foreach (line IN LISTS lines)
+    string(REGEX REPLACE "Throughput: +" "" value "${line}")
+    string(REPLACE "." "" value "${value}")
+    string(REGEX REPLACE "^0+([0-9])" "\\1" value "${value}")
+    if (value GREATER best)
+      set(best ${value})
+    endif()
+  endforeach()
+  if (best EQUAL 0)
+    message(FATAL_ERROR "${binary} reported no throughput")
+  endif()
+  set(${result} ${best} PARENT_SCOPE)
+endfunction()
+
+function(format_hundredths value result)
+  math(EXPR whole "${value} / 100")
+  math(EXPR fraction "${value} % 100")
+  if (fraction LESS 10)
+    set(fraction "0${fraction}")
+  endif()
+  set(${result} "${whole}.${fraction}" PARENT_SCOPE)
+endfunction()
+
+set(BASELINE_DIR "${SOURCE_DIR}/out/build/linux-release-o2")
+set(PGO_DIR "${SOURCE_DIR}/out/build/linux-pgo")
+
+message(STATUS "Building -O2 baseline")
+build_preset(linux-release-o2 "${BASELINE_DIR}" Modern-Text-Tokenizer)
+
+message(STATUS "Building instrumented binary and collecting the profile")
+build_preset(linux-pgo-generate "${PGO_DIR}" pgo-train)
+
+message(STATUS "Building with the profile")
+build_preset(linux-pgo-use "${PGO_DIR}" Modern-Text-Tokenizer)
+
+message(STATUS "Measuring (best of ${RUNS} runs each)")
+measure("${BASELINE_DIR}/Modern-Text-Tokenizer" baseline)
+measure("${PGO_DIR}/Modern-Text-Tokenizer" pgo)
+
+math(EXPR speedup "${pgo} * 100 / ${baseline}")
+format_hundredths(${baseline} baseline_text)
+format_hundredths(${pgo} pgo_text)
+format_hundredths(${speedup} speedup_text)
+message(STATUS "-O2 baseline:  ${baseline_text} MB/s")
+message(STATUS "LTO + PGO:     ${pgo_text} MB/s")
+message(STATUS "Speedup:       ${speedup_text}x")
@@ -0,0 +1,449 @@
+﻿/*
+ * tokenize-corpus.cpp
+ * -------------------------------------
+ * Converts text corpora into binary token-id shards.
+ *
+ * Pipeline:
+ *  reader (maps input files, cuts them at token boundaries)
+ *    -> tokenizer workers (encode pieces concurrently)
+ *    -> ordered writer (reassembles pieces in input order, writes shards)
+ *
+ * The stages are connected by bounded lock-free queues, so reading overlaps
+ * with tokenization and memory stays flat no matter how large the corpus is.
+ *
+ * Usage:
+ *  tokenize-corpus --vocab vocab.txt --output shards/train [options] files...
+ *
+ * Shards are TokenDatasetWriter datasets <output>-00000.bin/.idx,
+ * <output>-00001.bin/.idx, ...: little-endian uint16 or uint32 token ids plus
+ * an index with one document per input file.
+ */
+
+#include "Modern-Text-Tokenizer.hpp"
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace MecanikDev;
+
+namespace
+{
+	struct Options {
+		std::string vocab_path;
+		std::string output_prefix;
+		std::vector<std::string> inputs;
+		unsigned threads = 0;
+		size_t chunk_bytes = 4 * 1024 * 1024;
+		size_t queue_depth = 0;
+		uint64_t shard_tokens = 256ull * 1024 * 1024;
+		int dtype_bytes = 0;
+		long long eod_id = -1;
+		bool lowercase = false;
+		NormalizationForm normalization = NormalizationForm::none;
+		bool split_on_punctuation = false;
+		bool keep_punctuation = false;
+		bool quiet = false;
+	};
+
+	// A piece of an input file, cut at a token boundary
+	struct WorkItem {
+		uint64_t seq = 0;
+		std::string_view text;
+		std::shared_ptr<MappedFile> file;	// keeps the mapping alive
+		bool end_of_document = false;
+	};
+
+	struct EncodedItem {
+		uint64_t seq = 0;
+		size_t bytes = 0;
+		std::vector<int> ids;
+		bool end_of_document = false;
+	};
+
+	// Rolls a TokenDatasetWriter over numbered datasets PREFIX-00000,
+	// PREFIX-00001, ... every shard_tokens ids. Each input file is one
+	// document; a document cut at a shard boundary continues as the first
+	// document of the next shard.
+	class ShardWriter
+	{
+	private:
+		std::string prefix_;
+		uint64_t shard_tokens_;
+		int dtype_bytes_;
+		TokenDatasetWriter dataset_;
+		bool open_ = false;
+		uint64_t in_shard_ = 0;
+		size_t shard_index_ = 0;
+		std::vector<int> piece_;
+
+	public:
+		uint64_t tokens_written = 0;
+		bool id_out_of_range = false;
+
+		ShardWriter(std::string prefix, uint64_t shard_tokens, int dtype_bytes)
+			: prefix_(std::move(prefix))
+			, shard_tokens_(std::max<uint64_t>(shard_tokens, 1))
+			, dtype_bytes_(dtype_bytes) {
+		}
+
+		size_t shard_count() const { return shard_index_; }
+
+		bool write(const std::vector<int>& ids, bool end_of_document) {
+			size_t pos = 0;
+			while (pos < ids.size()) {
+				if (!open_ || in_shard_ == shard_tokens_) {
+					if (!open_next()) return false;
+				}
+
+				size_t n = static_cast<size_t>(std::min<uint64_t>(ids.size() - pos, shard_tokens_ - in_shard_));
+				const std::vector<int>* chunk = &ids;
+				if (n != ids.size()) {
+					piece_.assign(ids.begin() + pos, ids.begin() + pos + n);
+					chunk = &piece_;
+				}
+				if (!dataset_.append(*chunk)) {
+					id_out_of_range = std::any_of(chunk->begin(), chunk->end(),
+						[&](int id) { return id < 0 || (dtype_bytes_ == 2 && id > 0xFFFF); });
+					return false;
+				}
+
+				pos += n;
+				in_shard_ += n;
+				tokens_written += n;
+			}
+
+			if (end_of_document) {
+				if (!open_ && !open_next()) return false;
+				dataset_.end_document();
+			}
+			return true;
+		}
+
+		bool close() {
+			if (!open_) return true;
+			open_ = false;
+			return dataset_.close();
+		}
+
+	private:
+		bool open_next() {
+			if (!close()) return false;
+
+			std::ostringstream name;
+			name << prefix_ << "-" << std::setw(5) << std::setfill('0') << shard_index_;
+			if (!dataset_.open(name.str(), dtype_bytes_)) {
+				std::cerr << "error: cannot create shard '" << name.str() << ".bin'" << std::endl;
+				return false;
+			}
+
+			open_ = true;
+			shard_index_++;
+			in_shard_ = 0;
+			return true;
+		}
+	};
+
+	void print_usage() {
+		std::cerr <<
+			"Usage: tokenize-corpus --vocab FILE --output PREFIX [options] FILE...\n"
+			"\n"
+			"Options:\n"
+			"  --vocab FILE          vocabulary file (one token per line)\n"
+			"  --output PREFIX       shard prefix, shards are PREFIX-00000.bin/.idx, ...\n"
+			"  --threads N           tokenizer worker threads (default: all cores)\n"
+			"  --chunk-mb N          size of the pieces handed to workers (default: 4)\n"
+			"  --queue N             max pieces in flight (default: 4 x threads)\n"
+			"  --shard-tokens N      ids per shard (default: 268435456)\n"
+			"  --dtype u16|u32       id width (default: u16 if the vocab fits)\n"
+			"  --eod ID              id appended after every input file\n"
+			"  --lowercase           lowercase tokens\n"
+			"  --normalize FORM      Unicode normalization: nfc, nfd or nfkc\n"
+			"  --split-punctuation   split on punctuation\n"
+			"  --keep-punctuation    keep punctuation as tokens\n"
+			"  --quiet               no progress output\n";
+	}
+
+	bool parse_args(int argc, char** argv, Options& options) {
+		for (int i = 1; i < argc; ++i) {
+			std::string arg = argv[i];
+			auto value = [&]() -> const char* {
+				return i + 1 < argc ? argv[++i] : nullptr;
+			};
+
+			if (arg == "--vocab") {
+				const char* v = value();
+				if (!v) return false;
+				options.vocab_path = v;
+			}
+			else if (arg == "--output") {
+				const char* v = value();
+				if (!v) return false;
+				options.output_prefix = v;
+			}
+			else if (arg == "--threads") {
+				const char* v = value();
+				if (!v) return false;
+				options.threads = static_cast<unsigned>(std::stoul(v));
+			}
+			else if (arg == "--chunk-mb") {
+				const char* v = value();
+				if (!v) return false;
+				options.chunk_bytes = std::max<size_t>(1, std::stoul(v)) * 1024 * 1024;
+			}
+			else if (arg == "--queue") {
+				const char* v = value();
+				if (!v) return false;
+				options.queue_depth = std::stoul(v);
+			}
+			else if (arg == "--shard-tokens") {
+				const char* v = value();
+				if (!v) return false;
+				options.shard_tokens = std::stoull(v);
+			}
+			else if (arg == "--dtype") {
+				const char* v = value();
+				if (!v) return false;
+				std::string dtype = v;
+				if (dtype == "u16") options.dtype_bytes = 2;
+				else if (dtype == "u32") options.dtype_bytes = 4;
+				else return false;
+			}
+			else if (arg == "--eod") {
+				const char* v = value();
+				if (!v) return false;
+				options.eod_id = std::stoll(v);
+				if (options.eod_id > INT_MAX) {
+					std::cerr << "error: --eod " << v << " is larger than the largest token id" << std::endl;
+					return false;
+				}
+			}
+			else if (arg == "--normalize") {
+				const char* v = value();
+				if (!v || !parse_normalization_form(v, options.normalization)) return false;
+			}
+			else if (arg == "--lowercase") options.lowercase = true;
+			else if (arg == "--split-punctuation") options.split_on_punctuation = true;
+			else if (arg == "--keep-punctuation") options.keep_punctuation = true;
+			else if (arg == "--quiet") options.quiet = true;
+			else if (arg == "--help" || arg == "-h") return false;
+			else if (!arg.empty() && arg[0] == '-') {
+				std::cerr << "error: unknown option '" << arg << "'" << std::endl;
+				return false;
+			}
+			else options.inputs.push_back(arg);
+		}
+
+		return !options.vocab_path.empty() && !options.output_prefix.empty() && !options.inputs.empty();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	try {
+		if (!parse_args(argc, argv, options)) {
+			print_usage();
+			return 2;
+		}
+	}
+	catch (const std::exception&) {
+		std::cerr << "error: invalid numeric argument" << std::endl;
+		print_usage();
+		return 2;
+	}
+
+	TextTokenizer tokenizer;
+	if (!tokenizer.load_vocab(options.vocab_path)) {
+		std::cerr << "error: cannot load vocabulary '" << options.vocab_path << "'" << std::endl;
+		return 1;
+	}
+
+	tokenizer
+		.set_lowercase(options.lowercase)
+		.set_normalization(options.normalization)
+		.set_split_on_punctuation(options.split_on_punctuation)
+		.set_keep_punctuation(options.keep_punctuation);
+
+	if (options.dtype_bytes == 0) {
+		options.dtype_bytes = tokenizer.vocab_size() <= 0x10000 ? 2 : 4;
+	}
+	if (options.dtype_bytes == 2 && options.eod_id > 0xFFFF) {
+		std::cerr << "error: --eod " << options.eod_id << " does not fit u16 ids" << std::endl;
+		return 2;
+	}
+	if (options.threads == 0) {
+		options.threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	if (options.queue_depth == 0) {
+		options.queue_depth = 4 * options.threads;
+	}
+
+	// Lock-free bounded queues between the stages: one reader feeding many
+	// workers, many workers feeding the reorder loop
+	MpmcQueue<WorkItem> work_queue(options.queue_depth);
+	MpmcQueue<EncodedItem> result_queue(options.queue_depth);
+
+	// Caps the pieces between reader and writer, including ones parked in the
+	// writer's reorder buffer, so a slow piece cannot let the others pile up
+	std::mutex inflight_mutex;
+	std::condition_variable inflight_cv;
+	size_t inflight = 0;
+
+	std::atomic<bool> failed{ false };
+	auto start_time = std::chrono::steady_clock::now();
+
+	// Reader: map each file and cut it into boundary-aligned pieces
+	std::thread reader([&]() {
+		uint64_t seq = 0;
+		for (const auto& path : options.inputs) {
+			auto file = std::make_shared<MappedFile>();
+			if (!file->open(path)) {
+				std::cerr << "error: cannot open '" << path << "'" << std::endl;
+				failed = true;
+				break;
+			}
+
+			std::string_view text = file->view();
+			size_t pos = 0;
+			do {
+				size_t end = text.size();
+				if (text.size() - pos > options.chunk_bytes) {
+					end = tokenizer.find_next_token_boundary(text, pos + options.chunk_bytes);
+				}
+
+				{
+					std::unique_lock<std::mutex> lock(inflight_mutex);
+					inflight_cv.wait(lock, [&] { return inflight < options.queue_depth || failed; });
+					inflight++;
+				}
+				if (failed) break;
+
+				WorkItem item;
+				item.seq = seq++;
+				item.text = text.substr(pos, end - pos);
+				item.file = file;
+				item.end_of_document = end == text.size();
+				work_queue.push(std::move(item));
+				pos = end;
+			} while (pos < text.size());
+
+			if (failed) break;
+		}
+		work_queue.close();
+	});
+
+	// Workers: encode pieces in any order
+	std::vector<std::thread> workers;
+	std::atomic<unsigned> workers_left{ options.threads };
+	for (unsigned t = 0; t < options.threads; ++t) {
+		workers.emplace_back([&]() {
+			WorkItem item;
+			while (work_queue.pop(item)) {
+				EncodedItem result;
+				result.seq = item.seq;
+				result.bytes = item.text.size();
+				result.ids = tokenizer.encode(item.text);
+				result.end_of_document = item.end_of_document;
+				item.file.reset();
+				result_queue.push(std::move(result));
+			}
+			if (--workers_left == 0) {
+				result_queue.close();
+			}
+		});
+	}
+
+	// Writer: a dedicated thread does the file I/O, fed in input order by the
+	// reorder loop below through a single-producer/single-consumer ring, so a
+	// slow disk write never holds up draining the workers' results
+	SpscQueue<EncodedItem> ordered_queue(options.queue_depth);
+	ShardWriter writer(options.output_prefix, options.shard_tokens, options.dtype_bytes);
+	uint64_t bytes_done = 0;
+
+	std::thread writer_thread([&]() {
+		auto last_report = start_time;
+		EncodedItem ready;
+		while (ordered_queue.pop(ready)) {
+			if (!failed && options.eod_id >= 0 && ready.end_of_document) {
+				ready.ids.push_back(static_cast<int>(options.eod_id));
+			}
+			if (!failed && !writer.write(ready.ids, ready.end_of_document)) {
+				if (writer.id_out_of_range) {
+					std::cerr << "error: an id does not fit the id width (missing [UNK] in the vocabulary?)" << std::endl;
+				}
+				else {
+					std::cerr << "error: failed writing shards" << std::endl;
+				}
+				failed = true;
+			}
+			bytes_done += ready.bytes;
+
+			{
+				std::lock_guard<std::mutex> lock(inflight_mutex);
+				inflight--;
+			}
+			inflight_cv.notify_one();
+
+			auto now = std::chrono::steady_clock::now();
+			if (!options.quiet && now - last_report >= std::chrono::seconds(1)) {
+				double seconds = std::chrono::duration<double>(now - start_time).count();
+				std::cerr << "\r" << std::fixed << std::setprecision(1)
+					<< bytes_done / 1048576.0 << " MB, "
+					<< writer.tokens_written << " tokens, "
+					<< bytes_done / 1048576.0 / seconds << " MB/s, "
+					<< writer.tokens_written / seconds / 1e6 << " M tokens/s" << std::flush;
+				last_report = now;
+			}
+		}
+	});
+
+	// Restore input order
+	std::map<uint64_t, EncodedItem> pending;
+	uint64_t next_seq = 0;
+
+	EncodedItem result;
+	while (result_queue.pop(result)) {
+		pending.emplace(result.seq, std::move(result));
+
+		for (auto it = pending.find(next_seq); it != pending.end(); it = pending.find(next_seq)) {
+			ordered_queue.push(std::move(it->second));
+			pending.erase(it);
+			next_seq++;
+		}
+	}
+	ordered_queue.close();
+	writer_thread.join();
+
+	reader.join();
+	for (auto& worker : workers) {
+		worker.join();
+	}
+
+	if (!writer.close()) {
+		std::cerr << "error: failed closing shard" << std::endl;
+		failed = true;
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+	if (!options.quiet) {
+		std::cerr << "\r" << std::string(79, ' ') << "\r";
+	}
+	std::cout << std::fixed << std::setprecision(2)
+		<< "Inputs:     " << options.inputs.size() << " files, " << bytes_done / 1048576.0 << " MB" << std::endl
+		<< "Tokens:     " << writer.tokens_written << " in " << writer.shard_count() << " shards ("
+		<< (options.dtype_bytes == 2 ? "u16" : "u32") << ")" << std::endl
+		<< "Threads:    " << options.threads << " workers" << std::endl
+		<< "Time:       " << seconds << " s" << std::endl
+		<< "Throughput: " << bytes_done / 1048576.0 / seconds << " MB/s, "
+		<< writer.tokens_written / seconds / 1e6 << " M tokens/s" << std::endl;
+
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,705 @@
+﻿/*
+ * tokenizer-bench.cpp
+ * -------------------------------------
+ * Micro-benchmark suite for TextTokenizer.
+ *
+ * Every operation is run for a number of warmup passes, then timed over
+ * repeated passes; the report gives min / median / p90 / p99 / max pass
+ * time plus throughput and per-token cost at the median.
+ *
+ * Corpora are generated deterministically (ASCII prose, source code, CJK,
+ * emoji-heavy and mixed-script text), and real files can be added with
+ * --file.
+ *
+ * --scaling switches to a concurrency benchmark: 1, 2, 4 ... N threads each
+ * issue short requests (corpus lines) against one shared tokenizer, and
+ * every request's latency goes into a log-linear (HDR-style) histogram.
+ * The report shows throughput scaling and p50/p99/p999 per thread count.
+ *
+ * Usage:
+ *  tokenizer-bench [--vocab vocab.txt] [--corpus ascii,code,cjk,emoji,mixed]
+ *                  [--file corpus.txt ...] [--size-kb N] [--warmup N] [--reps N]
+ *                  [--ops tokenize,encode,decode,count,sequence,load_vocab]
+ *  tokenizer-bench --scaling [--max-threads N] [--requests N]
+ *                  [--scaling-op encode|sequence|tokenize|count] [--histogram]
+ */
+
+#include "Modern-Text-Tokenizer.hpp"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iomanip>
+#include <random>
+#include <thread>
+
+using namespace MecanikDev;
+
+namespace
+{
+	struct Options {
+		std::string vocab_path;
+		std::vector<std::string> corpora = { "ascii", "code", "cjk", "emoji", "mixed" };
+		std::vector<std::string> files;
+		std::vector<std::string> ops = { "tokenize", "encode", "decode", "count", "sequence", "load_vocab" };
+		size_t size_kb = 1024;
+		int warmup = 2;
+		int reps = 10;
+		int max_length = 128;
+		bool lowercase = false;
+		bool split_on_punctuation = false;
+		bool keep_punctuation = false;
+		bool csv = false;
+		bool scaling = false;
+		unsigned max_threads = 0;
+		size_t requests = 20000;	// per thread, per step
+		std::string scaling_op = "encode";
+		bool histogram = false;
+	};
+
+	struct Corpus {
+		std::string name;
+		std::string text;
+		std::vector<std::string_view> lines;	// request-sized pieces for encode_sequence
+	};
+
+	// Results are folded into this so the optimizer cannot drop the work
+	volatile size_t sink = 0;
+
+	std::vector<std::string> split_list(const std::string& list) {
+		std::vector<std::string> items;
+		std::stringstream in(list);
+		std::string item;
+		while (std::getline(in, item, ',')) {
+			if (!item.empty()) items.push_back(item);
+		}
+		return items;
+	}
+
+	// Deterministic text generators. Each appends one line to out.
+	class CorpusGenerator
+	{
+	private:
+		std::mt19937 rng_;
+
+		size_t pick(size_t n) { return rng_() % n; }
+		uint32_t range(uint32_t lo, uint32_t hi) { return lo + rng_() % (hi - lo + 1); }
+
+		const char* word() {
+			static const char* words[] = {
+				"the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "was", "with", "be", "by",
+				"on", "not", "he", "this", "are", "or", "his", "from", "at", "which", "but", "have", "an",
+				"they", "you", "were", "their", "one", "all", "we", "can", "her", "has", "there", "been",
+				"tokenizer", "performance", "vocabulary", "throughput", "latency", "benchmark", "sentence",
+				"international", "characteristics", "understanding", "representation", "approximately",
+				"Monday", "London", "Python", "NASA", "don't", "it's", "e-mail", "state-of-the-art"
+			};
+			return words[pick(sizeof(words) / sizeof(words[0]))];
+		}
+
+	public:
+		explicit CorpusGenerator(uint32_t seed) : rng_(seed) {}
+
+		void ascii_line(std::string& out) {
+			static const char* punctuation[] = { ".", ",", ";", ":", "!", "?", " -", "\"" };
+			size_t words = range(8, 30);
+			for (size_t i = 0; i < words; ++i) {
+				if (i > 0) out += ' ';
+				out += word();
+				if (pick(6) == 0) out += punctuation[pick(8)];
+				if (pick(25) == 0) out += " " + std::to_string(rng_() % 10000);
+			}
+			out += ".\n";
+		}
+
+		void code_line(std::string& out) {
+			static const char* identifiers[] = {
+				"value", "count", "items", "result", "buffer_size", "maxLength", "i", "j", "node->next",
+				"config.threads", "std::vector<int>", "self", "ctx", "token_ids", "offset", "HashMap"
+			};
+			static const char* operators[] = { " = ", " += ", " == ", " != ", " < ", " >= ", " && ", " || ", " << ", "->" };
+			static const char* keywords[] = { "if (", "for (", "while (", "return ", "auto ", "const ", "def ", "let " };
+
+			out.append(4 * pick(4), ' ');
+			out += keywords[pick(8)];
+			size_t terms = range(2, 6);
+			for (size_t i = 0; i < terms; ++i) {
+				out += identifiers[pick(16)];
+				if (pick(3) == 0) out += "(" + std::to_string(rng_() % 256) + ")";
+				if (i + 1 < terms) out += operators[pick(10)];
+			}
+			static const char* endings[] = { ") {", ");", ";", "):", "]", "} // TODO: check bounds" };
+			out += endings[pick(6)];
+			out += '\n';
+		}
+
+		void cjk_line(std::string& out) {
+			static const uint32_t punctuation[] = { 0x3001, 0x3002, 0xFF0C, 0xFF01, 0xFF1F, 0x300C, 0x300D };
+			size_t chars = range(20, 80);
+			for (size_t i = 0; i < chars; ++i) {
+				switch (pick(10)) {
+				case 0: detail::append_utf8(out, range(0x3041, 0x3096)); break;	// hiragana
+				case 1: detail::append_utf8(out, range(0x30A1, 0x30FA)); break;	// katakana
+				case 2: detail::append_utf8(out, range(0xAC00, 0xD7A3)); break;	// hangul
+				case 3: detail::append_utf8(out, punctuation[pick(7)]); break;
+				default: detail::append_utf8(out, range(0x4E00, 0x9FFF)); break;	// CJK ideographs
+				}
+				if (pick(24) == 0) out += ' ';
+			}
+			out += '\n';
+		}
+
+		void emoji_line(std::string& out) {
+			size_t items = range(6, 20);
+			for (size_t i = 0; i < items; ++i) {
+				if (i > 0) out += ' ';
+				switch (pick(6)) {
+				case 0:
+				case 1:
+					out += word();
+					break;
+				case 2:	// emoji with skin tone modifier
+					detail::append_utf8(out, range(0x1F466, 0x1F469));
+					detail::append_utf8(out, range(0x1F3FB, 0x1F3FF));
+					break;
+				case 3:	// ZWJ family sequence
+					detail::append_utf8(out, 0x1F468);
+					detail::append_utf8(out, 0x200D);
+					detail::append_utf8(out, 0x1F469);
+					detail::append_utf8(out, 0x200D);
+					detail::append_utf8(out, 0x1F467);
+					break;
+				case 4:	// flag (regional indicator pair)
+					detail::append_utf8(out, range(0x1F1E6, 0x1F1FF));
+					detail::append_utf8(out, range(0x1F1E6, 0x1F1FF));
+					break;
+				default: {
+					size_t run = range(1, 4);
+					for (size_t k = 0; k < run; ++k) {
+						detail::append_utf8(out, pick(2) ? range(0x1F600, 0x1F64F) : range(0x1F300, 0x1F5FF));
+					}
+					break;
+				}
+				}
+			}
+			out += '\n';
+		}
+
+		void mixed_line(std::string& out) {
+			size_t words = range(6, 20);
+			for (size_t i = 0; i < words; ++i) {
+				if (i > 0) out += ' ';
+				size_t letters = range(2, 9);
+				uint32_t lo, hi;
+				switch (pick(7)) {
+				case 0: lo = 0x430; hi = 0x44F; break;	// Cyrillic
+				case 1: lo = 0x3B1; hi = 0x3C9; break;	// Greek
+				case 2: lo = 0x627; hi = 0x64A; break;	// Arabic
+				case 3: lo = 0x915; hi = 0x939; break;	// Devanagari
+				case 4: lo = 0x4E00; hi = 0x9FFF; letters = range(1, 4); break;
+				case 5: lo = 0xE0; hi = 0xFF; break;	// Latin-1 accented
+				default: out += word(); continue;
+				}
+				for (size_t k = 0; k < letters; ++k) {
+					detail::append_utf8(out, range(lo, hi));
+				}
+				if (pick(8) == 0) out += ',';
+			}
+			out += '\n';
+		}
+	};
+
+	bool make_corpus(const std::string& name, size_t bytes, Corpus& corpus) {
+		CorpusGenerator generator(0x5EED);
+		void (CorpusGenerator::*line)(std::string&) = nullptr;
+		if (name == "ascii") line = &CorpusGenerator::ascii_line;
+		else if (name == "code") line = &CorpusGenerator::code_line;
+		else if (name == "cjk") line = &CorpusGenerator::cjk_line;
+		else if (name == "emoji") line = &CorpusGenerator::emoji_line;
+		else if (name == "mixed") line = &CorpusGenerator::mixed_line;
+		else return false;
+
+		corpus.name = name;
+		corpus.text.reserve(bytes + 1024);
+		while (corpus.text.size() < bytes) {
+			(generator.*line)(corpus.text);
+		}
+		return true;
+	}
+
+	void split_lines(Corpus& corpus) {
+		std::string_view text = corpus.text;
+		size_t start = 0;
+		while (start < text.size()) {
+			size_t end = text.find('\n', start);
+			if (end == std::string_view::npos) end = text.size();
+			if (end > start) corpus.lines.push_back(text.substr(start, end - start));
+			start = end + 1;
+		}
+	}
+
+	struct Summary {
+		double min_ns, median_ns, p90_ns, p99_ns, max_ns;
+	};
+
+	// Nearest-rank percentiles of the pass times
+	Summary summarize(std::vector<double> samples) {
+		std::sort(samples.begin(), samples.end());
+		auto at = [&](double q) {
+			size_t rank = static_cast<size_t>(q * static_cast<double>(samples.size()) + 0.999999);
+			return samples[std::min(samples.size(), std::max<size_t>(rank, 1)) - 1];
+		};
+		return { samples.front(), at(0.5), at(0.9), at(0.99), samples.back() };
+	}
+
+	// Run fn warmup times untimed, then reps times timed; fn returns a value
+	// folded into the sink
+	template<typename Fn>
+	std::vector<double> measure(const Options& options, Fn&& fn) {
+		for (int i = 0; i < options.warmup; ++i) {
+			sink = sink + fn();
+		}
+		std::vector<double> samples;
+		samples.reserve(options.reps);
+		for (int i = 0; i < options.reps; ++i) {
+			auto start = std::chrono::steady_clock::now();
+			sink = sink + fn();
+			auto end = std::chrono::steady_clock::now();
+			samples.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+		}
+		return samples;
+	}
+
+	void print_header(const Options& options) {
+		if (options.csv) {
+			std::cout << "corpus,op,bytes,tokens,min_ns,median_ns,p90_ns,p99_ns,max_ns,mb_per_s,ns_per_token" << std::endl;
+			return;
+		}
+		std::cout << std::left << std::setw(10) << "corpus" << std::setw(12) << "op"
+			<< std::right << std::setw(11) << "min ms" << std::setw(11) << "median ms"
+			<< std::setw(11) << "p90 ms" << std::setw(11) << "p99 ms" << std::setw(11) << "max ms"
+			<< std::setw(11) << "MB/s" << std::setw(11) << "ns/token" << std::endl;
+	}
+
+	void report(const Options& options, const std::string& corpus, const std::string& op,
+		size_t bytes, size_t tokens, const std::vector<double>& samples) {
+		Summary s = summarize(samples);
+		double mb_per_s = s.median_ns > 0 ? bytes / (s.median_ns / 1e9) / (1024.0 * 1024.0) : 0.0;
+		double ns_per_token = tokens > 0 ? s.median_ns / tokens : 0.0;
+
+		if (options.csv) {
+			std::cout << std::fixed << std::setprecision(1);
+			std::cout << corpus << ',' << op << ',' << bytes << ',' << tokens << ','
+				<< s.min_ns << ',' << s.median_ns << ',' << s.p90_ns << ',' << s.p99_ns << ',' << s.max_ns << ','
+				<< mb_per_s << ',' << ns_per_token << std::endl;
+			return;
+		}
+		std::cout << std::left << std::setw(10) << corpus << std::setw(12) << op << std::right
+			<< std::fixed << std::setprecision(3)
+			<< std::setw(11) << s.min_ns / 1e6 << std::setw(11) << s.median_ns / 1e6
+			<< std::setw(11) << s.p90_ns / 1e6 << std::setw(11) << s.p99_ns / 1e6 << std::setw(11) << s.max_ns / 1e6
+			<< std::setprecision(1) << std::setw(11) << mb_per_s << std::setw(11) << ns_per_token << std::endl;
+	}
+
+	bool wants(const Options& options, const std::string& op) {
+		return std::find(options.ops.begin(), options.ops.end(), op) != options.ops.end();
+	}
+
+	void bench_corpus(const Options& options, const TextTokenizer& tokenizer, const Corpus& corpus) {
+		const std::string& text = corpus.text;
+		std::vector<int> ids = tokenizer.encode(text);
+		size_t tokens = ids.size();
+
+		if (wants(options, "tokenize")) {
+			report(options, corpus.name, "tokenize", text.size(), tokens,
+				measure(options, [&] { return tokenizer.tokenize(text).size(); }));
+		}
+		if (wants(options, "encode")) {
+			report(options, corpus.name, "encode", text.size(), tokens,
+				measure(options, [&] { return tokenizer.encode(text).size(); }));
+		}
+		if (wants(options, "decode")) {
+			report(options, corpus.name, "decode", text.size(), tokens,
+				measure(options, [&] { return tokenizer.decode(ids).size(); }));
+		}
+		if (wants(options, "count")) {
+			report(options, corpus.name, "count", text.size(), tokens,
+				measure(options, [&] { return tokenizer.count_tokens(text); }));
+		}
+		if (wants(options, "sequence")) {
+			// One request per line, as a serving path would see it
+			report(options, corpus.name, "sequence", text.size(), tokens,
+				measure(options, [&] {
+					size_t total = 0;
+					for (std::string_view line : corpus.lines) {
+						total += tokenizer.encode_sequence(line, options.max_length).size();
+					}
+					return total;
+				}));
+		}
+	}
+
+	// Log-linear latency histogram in the style of HdrHistogram: values below
+	// 128 ns are exact, above that every power of two is split into 64
+	// sub-buckets, so any recorded value is off by less than 1.6%.
+	class LatencyHistogram
+	{
+	private:
+		static constexpr int sub_bucket_bits = 7;
+		static constexpr uint64_t sub_bucket_count = 1u << sub_bucket_bits;	// 128
+		static constexpr uint64_t half_count = sub_bucket_count / 2;	// 64
+		static constexpr int max_bucket = 40;	// up to ~2^47 ns
+
+		std::vector<uint64_t> counts_;
+		uint64_t total_ = 0;
+		uint64_t max_ = 0;
+
+		static int msb(uint64_t v) {
+			int bit = 0;
+			while (v >>= 1) bit++;
+			return bit;
+		}
+
+		static size_t index_of(uint64_t v) {
+			if (v < sub_bucket_count) return static_cast<size_t>(v);
+			int bucket = std::min(msb(v) - (sub_bucket_bits - 1), max_bucket);
+			uint64_t sub = std::min<uint64_t>(v >> bucket, sub_bucket_count - 1);
+			return static_cast<size_t>(bucket * half_count + sub);
+		}
+
+		// Highest value that maps to index
+		static uint64_t value_at(size_t index) {
+			if (index < sub_bucket_count) return index;
+			int bucket = static_cast<int>(index / half_count) - 1;
+			uint64_t sub = index - bucket * half_count;
+			return ((sub + 1) << bucket) - 1;
+		}
+
+	public:
+		LatencyHistogram() : counts_((max_bucket + 2) * half_count, 0) {}
+
+		void record(uint64_t ns) {
+			counts_[index_of(ns)]++;
+			total_++;
+			max_ = std::max(max_, ns);
+		}
+
+		void merge(const LatencyHistogram& other) {
+			for (size_t i = 0; i < counts_.size(); ++i) {
+				counts_[i] += other.counts_[i];
+			}
+			total_ += other.total_;
+			max_ = std::max(max_, other.max_);
+		}
+
+		uint64_t count() const { return total_; }
+		uint64_t max() const { return max_; }
+
+		// Value at percentile q (0..100)
+		uint64_t percentile(double q) const {
+			if (total_ == 0) return 0;
+			uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(q / 100.0 * static_cast<double>(total_) + 0.5));
+			uint64_t seen = 0;
+			for (size_t i = 0; i < counts_.size(); ++i) {
+				seen += counts_[i];
+				if (seen >= target) return std::min(value_at(i), max_);
+			}
+			return max_;
+		}
+	};
+
+	// One request as the scaling benchmark issues it; returns a value for the sink
+	size_t run_request(const Options& options, const TextTokenizer& tokenizer, std::string_view text) {
+		if (options.scaling_op == "sequence") return tokenizer.encode_sequence(text, options.max_length).size();
+		if (options.scaling_op == "tokenize") return tokenizer.tokenize(text).size();
+		if (options.scaling_op == "count") return tokenizer.count_tokens(text);
+		return tokenizer.encode(text).size();
+	}
+
+	// Per-thread state, padded so the harness itself does not false-share
+	struct alignas(64) ScalingWorker {
+		LatencyHistogram histogram;
+		size_t bytes = 0;
+		size_t result = 0;
+	};
+
+	void bench_scaling(const Options& options, const TextTokenizer& tokenizer, const std::vector<Corpus>& corpora) {
+		// Interleave the corpora so every thread sees the same request mix
+		std::vector<std::string_view> requests;
+		for (size_t i = 0; ; ++i) {
+			bool any = false;
+			for (const auto& corpus : corpora) {
+				if (i < corpus.lines.size()) {
+					requests.push_back(corpus.lines[i]);
+					any = true;
+				}
+			}
+			if (!any) break;
+		}
+		if (requests.empty()) {
+			std::cerr << "error: no requests to run" << std::endl;
+			return;
+		}
+
+		unsigned max_threads = options.max_threads ? options.max_threads : std::max(1u, std::thread::hardware_concurrency());
+		std::vector<unsigned> steps;
+		for (unsigned t = 1; t < max_threads; t *= 2) steps.push_back(t);
+		steps.push_back(max_threads);
+
+		if (options.csv) {
+			std::cout << "threads,requests,seconds,requests_per_s,mb_per_s,speedup,p50_ns,p99_ns,p999_ns,max_ns" << std::endl;
+		}
+		else {
+			std::cout << "scaling: " << options.scaling_op << ", " << requests.size() << " distinct requests, "
+				<< options.requests << " per thread" << std::endl;
+			std::cout << std::right << std::setw(8) << "threads" << std::setw(13) << "req/s" << std::setw(10) << "MB/s"
+				<< std::setw(9) << "speedup" << std::setw(11) << "p50 us" << std::setw(11) << "p99 us"
+				<< std::setw(11) << "p999 us" << std::setw(11) << "max us" << std::endl;
+		}
+
+		double base_rate = 0;
+		LatencyHistogram last;
+		for (unsigned threads : steps) {
+			std::vector<ScalingWorker> workers(threads);
+			std::atomic<unsigned> ready{ 0 };
+			std::atomic<bool> go{ false };
+			std::vector<std::thread> pool;
+
+			for (unsigned t = 0; t < threads; ++t) {
+				pool.emplace_back([&, t]() {
+					ScalingWorker& worker = workers[t];
+					size_t next = (requests.size() / threads) * t;
+					for (int i = 0; i < options.warmup; ++i) {
+						worker.result += run_request(options, tokenizer, requests[(next + i) % requests.size()]);
+					}
+
+					ready++;
+					while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+
+					for (size_t i = 0; i < options.requests; ++i) {
+						std::string_view text = requests[next];
+						next = next + 1 == requests.size() ? 0 : next + 1;
+
+						auto start = std::chrono::steady_clock::now();
+						worker.result += run_request(options, tokenizer, text);
+						auto end = std::chrono::steady_clock::now();
+
+						worker.histogram.record(static_cast<uint64_t>(
+							std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+						worker.bytes += text.size();
+					}
+				});
+			}
+
+			while (ready.load() < threads) std::this_thread::yield();
+			auto start = std::chrono::steady_clock::now();
+			go.store(true, std::memory_order_release);
+			for (auto& thread : pool) thread.join();
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			LatencyHistogram merged;
+			size_t bytes = 0;
+			for (const auto& worker : workers) {
+				merged.merge(worker.histogram);
+				bytes += worker.bytes;
+				sink = sink + worker.result;
+			}
+
+			double rate = merged.count() / seconds;
+			if (base_rate == 0) base_rate = rate;
+			double mb_per_s = bytes / seconds / (1024.0 * 1024.0);
+
+			if (options.csv) {
+				std::cout << std::fixed << std::setprecision(3) << threads << ',' << merged.count() << ',' << seconds << ','
+					<< rate << ',' << mb_per_s << ',' << rate / base_rate << ',' << merged.percentile(50) << ','
+					<< merged.percentile(99) << ',' << merged.percentile(99.9) << ',' << merged.max() << std::endl;
+			}
+			else {
+				std::cout << std::fixed << std::setw(8) << threads << std::setprecision(0) << std::setw(13) << rate
+					<< std::setprecision(1) << std::setw(10) << mb_per_s << std::setprecision(2) << std::setw(9) << rate / base_rate
+					<< std::setprecision(1) << std::setw(11) << merged.percentile(50) / 1e3
+					<< std::setw(11) << merged.percentile(99) / 1e3 << std::setw(11) << merged.percentile(99.9) / 1e3
+					<< std::setw(11) << merged.max() / 1e3 << std::endl;
+			}
+			last = merged;
+		}
+
+		// Full percentile distribution of the highest thread count, HdrHistogram-style
+		if (options.histogram && !options.csv) {
+			std::cout << std::endl << "latency distribution at " << steps.back() << " threads:" << std::endl;
+			std::cout << std::setw(12) << "percentile" << std::setw(14) << "latency us" << std::endl;
+			for (double q : { 0.0, 50.0, 75.0, 87.5, 93.75, 96.875, 99.0, 99.5, 99.9, 99.95, 99.99, 100.0 }) {
+				std::cout << std::setprecision(3) << std::setw(12) << q << std::setprecision(2) << std::setw(14)
+					<< (q == 100.0 ? last.max() : last.percentile(q)) / 1e3 << std::endl;
+			}
+		}
+	}
+
+	void print_usage() {
+		std::cerr <<
+			"Usage: tokenizer-bench [options]\n"
+			"\n"
+			"Options:\n"
+			"  --vocab FILE          vocabulary (default: built from the corpora)\n"
+			"  --corpus LIST         generated corpora: ascii,code,cjk,emoji,mixed (default: all)\n"
+			"  --file PATH           add a real-world corpus file; repeatable\n"
+			"  --size-kb N           size of each generated corpus (default: 1024)\n"
+			"  --warmup N            untimed passes per measurement (default: 2)\n"
+			"  --reps N              timed passes per measurement (default: 10)\n"
+			"  --ops LIST            tokenize,encode,decode,count,sequence,load_vocab (default: all)\n"
+			"  --max-length N        encode_sequence max_length (default: 128)\n"
+			"  --lowercase           lowercase tokens\n"
+			"  --split-punctuation   split on punctuation\n"
+			"  --keep-punctuation    keep punctuation as tokens\n"
+			"  --csv                 machine-readable output\n"
+			"\n"
+			"Scaling mode:\n"
+			"  --scaling             run 1, 2, 4 ... N threads against one shared tokenizer\n"
+			"  --max-threads N       highest thread count (default: all cores)\n"
+			"  --requests N          requests per thread per step (default: 20000)\n"
+			"  --scaling-op OP       encode, sequence, tokenize or count (default: encode)\n"
+			"  --histogram           print the latency distribution of the last step\n";
+	}
+
+	bool parse_args(int argc, char** argv, Options& options) {
+		bool corpus_given = false;
+		for (int i = 1; i < argc; ++i) {
+			std::string arg = argv[i];
+			const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+			if (arg == "--vocab" && value) { options.vocab_path = value; i++; }
+			else if (arg == "--corpus" && value) { options.corpora = split_list(value); corpus_given = true; i++; }
+			else if (arg == "--file" && value) { options.files.push_back(value); i++; }
+			else if (arg == "--size-kb" && value) { options.size_kb = std::stoul(value); i++; }
+			else if (arg == "--warmup" && value) { options.warmup = std::stoi(value); i++; }
+			else if (arg == "--reps" && value) { options.reps = std::stoi(value); i++; }
+			else if (arg == "--ops" && value) { options.ops = split_list(value); i++; }
+			else if (arg == "--max-length" && value) { options.max_length = std::stoi(value); i++; }
+			else if (arg == "--lowercase") options.lowercase = true;
+			else if (arg == "--split-punctuation") options.split_on_punctuation = true;
+			else if (arg == "--keep-punctuation") options.keep_punctuation = true;
+			else if (arg == "--csv") options.csv = true;
+			else if (arg == "--scaling") options.scaling = true;
+			else if (arg == "--max-threads" && value) { options.max_threads = static_cast<unsigned>(std::stoul(value)); i++; }
+			else if (arg == "--requests" && value) { options.requests = std::stoul(value); i++; }
+			else if (arg == "--scaling-op" && value) { options.scaling_op = value; i++; }
+			else if (arg == "--histogram") options.histogram = true;
+			else {
+				if (arg != "--help" && arg != "-h") {
+					std::cerr << "error: unknown or incomplete option '" << arg << "'" << std::endl;
+				}
+				return false;
+			}
+		}
+		// Real files alone replace the generated corpora unless --corpus was given too
+		if (!options.files.empty() && !corpus_given) {
+			options.corpora.clear();
+		}
+		if (options.scaling_op != "encode" && options.scaling_op != "sequence" &&
+			options.scaling_op != "tokenize" && options.scaling_op != "count") {
+			std::cerr << "error: unknown scaling op '" << options.scaling_op << "'" << std::endl;
+			return false;
+		}
+		return options.reps > 0 && options.warmup >= 0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	try {
+		if (!parse_args(argc, argv, options)) {
+			print_usage();
+			return 2;
+		}
+	}
+	catch (const std::exception&) {
+		std::cerr << "error: invalid numeric argument" << std::endl;
+		return 2;
+	}
+
+	std::vector<Corpus> corpora;
+	for (const auto& name : options.corpora) {
+		Corpus corpus;
+		if (!make_corpus(name, options.size_kb * 1024, corpus)) {
+			std::cerr << "error: unknown corpus '" << name << "'" << std::endl;
+			return 2;
+		}
+		corpora.push_back(std::move(corpus));
+	}
+	for (const auto& path : options.files) {
+		MappedFile file;
+		if (!file.open(path, true)) {
+			std::cerr << "error: cannot read '" << path << "'" << std::endl;
+			return 1;
+		}
+		Corpus corpus;
+		corpus.name = std::filesystem::path(path).filename().string();
+		corpus.text.assign(file.view());
+		corpora.push_back(std::move(corpus));
+	}
+	for (auto& corpus : corpora) {
+		split_lines(corpus);
+	}
+
+	TextTokenizer tokenizer;
+	tokenizer.set_lowercase(options.lowercase)
+		.set_split_on_punctuation(options.split_on_punctuation)
+		.set_keep_punctuation(options.keep_punctuation);
+
+	// Without --vocab, build one from the corpora and save it for load_vocab
+	std::string vocab_path = options.vocab_path;
+	bool temporary_vocab = false;
+	if (vocab_path.empty()) {
+		std::vector<std::string> texts;
+		for (const auto& corpus : corpora) {
+			texts.push_back(corpus.text);
+		}
+		tokenizer.build_vocab_from_text(texts, 2, 30000);
+		vocab_path = (std::filesystem::temp_directory_path() / "tokenizer-bench-vocab.txt").string();
+		temporary_vocab = tokenizer.save_vocab(vocab_path);
+	}
+	else if (!tokenizer.load_vocab(vocab_path)) {
+		std::cerr << "error: cannot load vocabulary '" << vocab_path << "'" << std::endl;
+		return 1;
+	}
+
+	if (!options.csv) {
+		std::cout << "vocabulary: " << tokenizer.vocab_size() << " tokens"
+			<< (options.vocab_path.empty() ? " (built from corpora)" : "")
+			<< ", warmup " << options.warmup << ", reps " << options.reps << std::endl;
+		for (const auto& corpus : corpora) {
+			std::cout << "corpus " << corpus.name << ": " << corpus.text.size() << " bytes, "
+				<< corpus.lines.size() << " lines" << std::endl;
+		}
+		std::cout << std::endl;
+	}
+
+	if (options.scaling) {
+		bench_scaling(options, tokenizer, corpora);
+		if (temporary_vocab) {
+			std::remove(vocab_path.c_str());
+		}
+		return 0;
+	}
+
+	print_header(options);
+	for (const auto& corpus : corpora) {
+		bench_corpus(options, tokenizer, corpus);
+	}
+
+	if (wants(options, "load_vocab") && (temporary_vocab || !options.vocab_path.empty())) {
+		std::error_code error;
+		size_t bytes = static_cast<size_t>(std::filesystem::file_size(vocab_path, error));
+		report(options, "vocab", "load_vocab", error ? 0 : bytes, tokenizer.vocab_size(),
+			measure(options, [&] {
+				TextTokenizer loaded;
+				loaded.load_vocab(vocab_path);
+				return loaded.vocab_size();
+			}));
+	}
+
+	if (temporary_vocab) {
+		std::remove(vocab_path.c_str());
+	}
+	return 0;
+}
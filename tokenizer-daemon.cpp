@@ -0,0 +1,689 @@
+﻿/*
+ * tokenizer-daemon.cpp
+ * -------------------------------------
+ * Local tokenization service over a Unix domain socket.
+ *
+ * Loads one or more vocabularies once and serves encode / encode_sequence /
+ * decode requests from any number of local processes, so each process no
+ * longer needs its own copy of the vocabulary. Requests arriving within a
+ * short latency window are coalesced into micro-batches and processed on a
+ * worker pool.
+ *
+ * Usage:
+ *  tokenizer-daemon --socket /tmp/tokenizer.sock --vocab vocab.txt [options]
+ *
+ * Clients use MecanikDev::TokenizerClient from Modern-Text-Tokenizer.hpp;
+ * the wire format is described by MecanikDev::DaemonProtocol.
+ */
+
+#include "Modern-Text-Tokenizer.hpp"
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+
+using namespace MecanikDev;
+
+namespace
+{
+	struct Options {
+		std::string socket_path;
+		std::string shm_name;
+		unsigned shm_slots = 16;
+		unsigned shm_ring = 8;
+		size_t shm_text_kb = 64;
+		size_t shm_max_ids = 16384;
+		std::vector<std::string> vocab_paths;
+		unsigned threads = 0;
+		size_t max_batch = 64;
+		long batch_window_us = 200;
+		bool lowercase = false;
+		NormalizationForm normalization = NormalizationForm::none;
+		bool split_on_punctuation = false;
+		bool keep_punctuation = false;
+		bool verbose = false;
+	};
+
+	struct Connection {
+		int fd;
+		std::mutex write_mutex;
+
+		explicit Connection(int socket_fd) : fd(socket_fd) {}
+		~Connection() { ::close(fd); }
+	};
+
+	struct Request {
+		std::shared_ptr<Connection> connection;
+		DaemonProtocol::Header header;
+		std::string payload;
+	};
+
+	// Collects requests until the batch is full or the latency window that
+	// started with the first request of the batch has expired
+	class MicroBatcher
+	{
+	private:
+		std::mutex mutex_;
+		std::condition_variable cv_;
+		std::vector<Request> pending_;
+		size_t max_batch_;
+		std::chrono::microseconds window_;
+		bool stopping_ = false;
+
+	public:
+		MicroBatcher(size_t max_batch, std::chrono::microseconds window)
+			: max_batch_(std::max<size_t>(max_batch, 1)), window_(window) {
+		}
+
+		void submit(Request request) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			pending_.push_back(std::move(request));
+			if (pending_.size() == 1 || pending_.size() >= max_batch_) {
+				cv_.notify_one();
+			}
+		}
+
+		void stop() {
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = true;
+			cv_.notify_all();
+		}
+
+		// Returns false when stopping
+		bool next_batch(std::vector<Request>& batch) {
+			std::unique_lock<std::mutex> lock(mutex_);
+			cv_.wait(lock, [&] { return stopping_ || !pending_.empty(); });
+			if (stopping_) return false;
+
+			auto deadline = std::chrono::steady_clock::now() + window_;
+			cv_.wait_until(lock, deadline, [&] { return stopping_ || pending_.size() >= max_batch_; });
+
+			batch.clear();
+			size_t n = std::min(pending_.size(), max_batch_);
+			std::move(pending_.begin(), pending_.begin() + n, std::back_inserter(batch));
+			pending_.erase(pending_.begin(), pending_.begin() + n);
+			return !stopping_;
+		}
+	};
+
+	// Live client connections, so shutdown can close them and wait for their
+	// reader threads before the batcher goes away
+	class ConnectionRegistry
+	{
+	private:
+		std::mutex mutex_;
+		std::condition_variable cv_;
+		std::vector<std::weak_ptr<Connection>> connections_;
+		size_t active_ = 0;
+
+	public:
+		void add(const std::shared_ptr<Connection>& connection) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			connections_.erase(std::remove_if(connections_.begin(), connections_.end(),
+				[](const std::weak_ptr<Connection>& c) { return c.expired(); }), connections_.end());
+			connections_.push_back(connection);
+			active_++;
+		}
+
+		void finished() {
+			std::lock_guard<std::mutex> lock(mutex_);
+			active_--;
+			cv_.notify_all();
+		}
+
+		void close_all_and_wait() {
+			std::unique_lock<std::mutex> lock(mutex_);
+			for (auto& weak : connections_) {
+				if (auto connection = weak.lock()) {
+					::shutdown(connection->fd, SHUT_RDWR);
+				}
+			}
+			cv_.wait(lock, [&] { return active_ == 0; });
+		}
+	};
+
+	std::atomic<bool> stop_requested{ false };
+	int listen_fd = -1;
+
+	void handle_signal(int) {
+		stop_requested = true;
+		if (listen_fd >= 0) {
+			::shutdown(listen_fd, SHUT_RDWR);
+		}
+	}
+
+	void process(const std::vector<std::unique_ptr<TextTokenizer>>& models, Request& request) {
+		const DaemonProtocol::Header& header = request.header;
+		DaemonProtocol::Header reply = {};
+		reply.op = header.op;
+		reply.request_id = header.request_id;
+		reply.status = DaemonProtocol::status_ok;
+
+		std::vector<int> ids;
+		std::string text;
+		const void* payload = nullptr;
+		size_t payload_bytes = 0;
+
+		try {
+			if (header.model >= models.size()) {
+				reply.status = DaemonProtocol::status_unknown_model;
+			}
+			else {
+				const TextTokenizer& tokenizer = *models[header.model];
+				switch (header.op) {
+				case DaemonProtocol::op_encode:
+					ids = tokenizer.encode(request.payload);
+					payload = ids.data();
+					payload_bytes = ids.size() * sizeof(int32_t);
+					break;
+				case DaemonProtocol::op_encode_sequence:
+					if (header.arg <= 0) {
+						reply.status = DaemonProtocol::status_bad_request;
+						break;
+					}
+					ids = tokenizer.encode_sequence(request.payload, header.arg,
+						(header.flags & DaemonProtocol::flag_add_special_tokens) != 0);
+					payload = ids.data();
+					payload_bytes = ids.size() * sizeof(int32_t);
+					break;
+				case DaemonProtocol::op_decode:
+					if (request.payload.size() % sizeof(int32_t) != 0) {
+						reply.status = DaemonProtocol::status_bad_request;
+						break;
+					}
+					ids.resize(request.payload.size() / sizeof(int32_t));
+					if (!ids.empty()) {
+						std::memcpy(ids.data(), request.payload.data(), request.payload.size());
+					}
+					text = tokenizer.decode(ids);
+					payload = text.data();
+					payload_bytes = text.size();
+					break;
+				case DaemonProtocol::op_vocab_size:
+					reply.arg = static_cast<int32_t>(tokenizer.vocab_size());
+					break;
+				default:
+					reply.status = DaemonProtocol::status_bad_request;
+					break;
+				}
+			}
+		}
+		catch (const std::exception&) {
+			// Fail this request only; the worker pool and other connections carry on
+			reply.status = DaemonProtocol::status_internal_error;
+			reply.arg = 0;
+			payload = nullptr;
+			payload_bytes = 0;
+		}
+
+		Connection& connection = *request.connection;
+		std::lock_guard<std::mutex> lock(connection.write_mutex);
+		if (!DaemonProtocol::send_message(connection.fd, reply, payload, payload_bytes)) {
+			// Client went away; wake its reader so the connection is dropped
+			::shutdown(connection.fd, SHUT_RDWR);
+		}
+	}
+
+	// One reader thread per client: frames requests and hands them to the batcher
+	void serve_connection(std::shared_ptr<Connection> connection, MicroBatcher& batcher, ConnectionRegistry& registry) {
+		for (;;) {
+			Request request;
+			if (!DaemonProtocol::read_all(connection->fd, &request.header, sizeof(request.header))) break;
+
+			const DaemonProtocol::Header& header = request.header;
+			if (header.magic != DaemonProtocol::magic || header.payload_bytes > DaemonProtocol::max_payload_bytes) {
+				DaemonProtocol::Header reply = {};
+				reply.op = header.op;
+				reply.request_id = header.request_id;
+				reply.status = header.magic != DaemonProtocol::magic ?
+					DaemonProtocol::status_bad_request : DaemonProtocol::status_too_large;
+				std::lock_guard<std::mutex> lock(connection->write_mutex);
+				DaemonProtocol::send_message(connection->fd, reply, nullptr, 0);
+				break;
+			}
+
+			request.payload.resize(header.payload_bytes);
+			if (header.payload_bytes > 0 &&
+				!DaemonProtocol::read_all(connection->fd, &request.payload[0], header.payload_bytes)) {
+				break;
+			}
+
+			request.connection = connection;
+			batcher.submit(std::move(request));
+		}
+		registry.finished();
+	}
+
+#ifdef MTT_LINUX
+	// Shared-memory transport: one thread per client slot. Each thread drains
+	// its slot's request ring in order, spinning briefly before sleeping on
+	// the slot's futex, and frees slots whose owning process has died.
+	class ShmServer
+	{
+	private:
+		const std::vector<std::unique_ptr<TextTokenizer>>& models_;
+		std::string name_;
+		void* segment_ = nullptr;
+		size_t segment_size_ = 0;
+		SharedMemoryProtocol::SegmentHeader* header_ = nullptr;
+		std::vector<std::thread> threads_;
+		std::atomic<bool> stopping_{ false };
+		std::atomic<uint64_t> requests_{ 0 };
+
+		static constexpr int spin_count_ = 256;
+
+		void handle(SharedMemoryProtocol::EntryHeader* entry) {
+			entry->status = DaemonProtocol::status_ok;
+			if (entry->model >= models_.size()) {
+				entry->status = DaemonProtocol::status_unknown_model;
+				return;
+			}
+
+			const TextTokenizer& tokenizer = *models_[entry->model];
+			char* text = SharedMemoryProtocol::entry_text(entry);
+			int32_t* ids_area = SharedMemoryProtocol::entry_ids(header_, entry);
+			std::vector<int> ids;
+
+			try {
+				switch (entry->op) {
+				case DaemonProtocol::op_encode:
+				case DaemonProtocol::op_encode_sequence: {
+					if (entry->text_bytes > header_->text_capacity ||
+						(entry->op == DaemonProtocol::op_encode_sequence && entry->arg <= 0)) {
+						entry->status = DaemonProtocol::status_bad_request;
+						break;
+					}
+					std::string_view view(text, entry->text_bytes);
+					ids = entry->op == DaemonProtocol::op_encode ? tokenizer.encode(view) :
+						tokenizer.encode_sequence(view, entry->arg, (entry->flags & DaemonProtocol::flag_add_special_tokens) != 0);
+					if (ids.size() > header_->ids_capacity) {
+						entry->status = DaemonProtocol::status_too_large;
+						entry->id_count = 0;
+						break;
+					}
+					if (!ids.empty()) std::memcpy(ids_area, ids.data(), ids.size() * sizeof(int32_t));
+					entry->id_count = static_cast<uint32_t>(ids.size());
+					break;
+				}
+				case DaemonProtocol::op_decode: {
+					if (entry->id_count > header_->ids_capacity) {
+						entry->status = DaemonProtocol::status_bad_request;
+						break;
+					}
+					ids.assign(ids_area, ids_area + entry->id_count);
+					std::string decoded = tokenizer.decode(ids);
+					if (decoded.size() > header_->text_capacity) {
+						entry->status = DaemonProtocol::status_too_large;
+						entry->text_bytes = 0;
+						break;
+					}
+					std::memcpy(text, decoded.data(), decoded.size());
+					entry->text_bytes = static_cast<uint32_t>(decoded.size());
+					break;
+				}
+				default:
+					entry->status = DaemonProtocol::status_bad_request;
+					break;
+				}
+			}
+			catch (const std::exception&) {
+				// Fail this entry only; the slot keeps serving its ring
+				entry->status = DaemonProtocol::status_internal_error;
+				entry->id_count = 0;
+				entry->text_bytes = 0;
+			}
+		}
+
+		void serve_slot(uint32_t index) {
+			SharedMemoryProtocol::SlotHeader* slot = SharedMemoryProtocol::slot_at(segment_, index);
+			uint32_t processed = slot->request_tail.load(std::memory_order_acquire);
+			int spin = 0;
+
+			while (!stopping_.load(std::memory_order_relaxed)) {
+				uint32_t tail = slot->request_tail.load(std::memory_order_acquire);
+				if (tail != processed) {
+					handle(SharedMemoryProtocol::entry_at(header_, slot, processed));
+					slot->response_tail.store(++processed, std::memory_order_seq_cst);
+					slot->response_signal.fetch_add(1, std::memory_order_seq_cst);
+					if (slot->client_waiting.load(std::memory_order_seq_cst)) {
+						SharedMemoryProtocol::futex_wake(&slot->response_signal);
+					}
+					requests_.fetch_add(1, std::memory_order_relaxed);
+					spin = 0;
+					continue;
+				}
+				if (spin++ < spin_count_) {
+					cpu_relax();
+					continue;
+				}
+
+				slot->server_waiting.store(1, std::memory_order_seq_cst);
+				uint32_t signal = slot->request_signal.load(std::memory_order_seq_cst);
+				bool woken = slot->request_tail.load(std::memory_order_seq_cst) != processed ||
+					SharedMemoryProtocol::futex_wait(&slot->request_signal, signal, 100);
+				slot->server_waiting.store(0, std::memory_order_relaxed);
+
+				// Idle for a while: reclaim the slot if its client crashed
+				uint32_t owner = slot->owner.load(std::memory_order_acquire);
+				if (!woken && owner != 0 && !SharedMemoryProtocol::process_alive(static_cast<int32_t>(owner))) {
+					processed = slot->request_tail.load(std::memory_order_acquire);
+					slot->response_tail.store(processed, std::memory_order_release);
+					slot->response_head.store(processed, std::memory_order_release);
+					slot->owner.compare_exchange_strong(owner, 0);
+				}
+			}
+		}
+
+		// True only for a segment left behind by a daemon that is no longer
+		// running; anything else using the name (a live daemon, a segment still
+		// being initialized, an unrelated object) is never reclaimed
+		bool existing_segment_stale() const {
+			int fd = ::shm_open(name_.c_str(), O_RDONLY, 0);
+			if (fd < 0) return false;
+			bool stale = false;
+			struct stat st;
+			if (::fstat(fd, &st) == 0 && st.st_size >= static_cast<off_t>(sizeof(SharedMemoryProtocol::SegmentHeader))) {
+				void* view = ::mmap(nullptr, sizeof(SharedMemoryProtocol::SegmentHeader), PROT_READ, MAP_SHARED, fd, 0);
+				if (view != MAP_FAILED) {
+					const auto* header = static_cast<const SharedMemoryProtocol::SegmentHeader*>(view);
+					stale = header->magic == SharedMemoryProtocol::magic &&
+						header->ready.load(std::memory_order_acquire) != 0 &&
+						!SharedMemoryProtocol::process_alive(header->server_pid);
+					::munmap(view, sizeof(SharedMemoryProtocol::SegmentHeader));
+				}
+			}
+			::close(fd);
+			return stale;
+		}
+
+	public:
+		explicit ShmServer(const std::vector<std::unique_ptr<TextTokenizer>>& models) : models_(models) {}
+
+		~ShmServer() {
+			stop();
+		}
+
+		bool start(const Options& options) {
+			name_ = options.shm_name;
+			uint32_t text_capacity = static_cast<uint32_t>(std::min<size_t>(options.shm_text_kb * 1024, UINT32_MAX / 2));
+			uint32_t ids_capacity = static_cast<uint32_t>(std::min<size_t>(options.shm_max_ids, UINT32_MAX / 8));
+			uint32_t slots = std::max(options.shm_slots, 1u);
+			uint32_t ring = std::max(options.shm_ring, 1u);
+			size_t entry_size = SharedMemoryProtocol::entry_bytes(text_capacity, ids_capacity);
+			size_t slot_size = SharedMemoryProtocol::slot_bytes(ring, entry_size);
+			segment_size_ = SharedMemoryProtocol::segment_bytes(slots, slot_size);
+
+			int fd = ::shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+			if (fd < 0 && errno == EEXIST) {
+				if (!existing_segment_stale()) {
+					errno = EEXIST;
+					return false;
+				}
+				::shm_unlink(name_.c_str());
+				fd = ::shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+			}
+			if (fd < 0) return false;
+			if (::ftruncate(fd, static_cast<off_t>(segment_size_)) != 0) {
+				::close(fd);
+				::shm_unlink(name_.c_str());
+				return false;
+			}
+			segment_ = ::mmap(nullptr, segment_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			::close(fd);
+			if (segment_ == MAP_FAILED) {
+				segment_ = nullptr;
+				::shm_unlink(name_.c_str());
+				return false;
+			}
+
+			// ftruncate zero-fills, so only the header and slot atomics need constructing
+			header_ = new (segment_) SharedMemoryProtocol::SegmentHeader();
+			header_->magic = SharedMemoryProtocol::magic;
+			header_->version = SharedMemoryProtocol::version;
+			header_->slot_count = slots;
+			header_->ring_entries = ring;
+			header_->text_capacity = text_capacity;
+			header_->ids_capacity = ids_capacity;
+			header_->slot_bytes = slot_size;
+			header_->entry_bytes = entry_size;
+			header_->server_pid = static_cast<int32_t>(::getpid());
+			for (uint32_t i = 0; i < slots; ++i) {
+				new (SharedMemoryProtocol::slot_at(segment_, i)) SharedMemoryProtocol::SlotHeader();
+			}
+			header_->ready.store(1, std::memory_order_release);
+
+			for (uint32_t i = 0; i < slots; ++i) {
+				threads_.emplace_back(&ShmServer::serve_slot, this, i);
+			}
+			return true;
+		}
+
+		void stop() {
+			stopping_ = true;
+			for (auto& thread : threads_) {
+				thread.join();
+			}
+			threads_.clear();
+			if (segment_) {
+				::munmap(segment_, segment_size_);
+				::shm_unlink(name_.c_str());
+				segment_ = nullptr;
+			}
+		}
+
+		uint64_t requests() const { return requests_.load(); }
+		size_t segment_size() const { return segment_size_; }
+	};
+#endif
+
+	void print_usage() {
+		std::cerr <<
+			"Usage: tokenizer-daemon {--socket PATH | --shm NAME} --vocab FILE [--vocab FILE ...] [options]\n"
+			"\n"
+			"Options:\n"
+			"  --socket PATH         Unix domain socket to listen on\n"
+			"  --shm NAME            also serve over shared memory segment NAME (Linux)\n"
+			"  --shm-slots N         concurrent shared-memory clients (default: 16)\n"
+			"  --shm-ring N          in-flight requests per client (default: 8)\n"
+			"  --shm-text-kb N       max request/response text per entry (default: 64)\n"
+			"  --shm-max-ids N       max ids per entry (default: 16384)\n"
+			"  --vocab FILE          vocabulary to serve; repeat for more models\n"
+			"                        (model index = order on the command line)\n"
+			"  --threads N           worker threads (default: all cores)\n"
+			"  --max-batch N         requests per micro-batch (default: 64)\n"
+			"  --batch-window-us N   latency window for coalescing (default: 200)\n"
+			"  --lowercase           lowercase tokens\n"
+			"  --normalize FORM      Unicode normalization: nfc, nfd or nfkc\n"
+			"  --split-punctuation   split on punctuation\n"
+			"  --keep-punctuation    keep punctuation as tokens\n"
+			"  --verbose             print batching statistics on exit\n";
+	}
+
+	bool parse_args(int argc, char** argv, Options& options) {
+		for (int i = 1; i < argc; ++i) {
+			std::string arg = argv[i];
+			const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+			if (arg == "--socket" && value) { options.socket_path = value; i++; }
+			else if (arg == "--shm" && value) { options.shm_name = value; i++; }
+			else if (arg == "--shm-slots" && value) { options.shm_slots = static_cast<unsigned>(std::stoul(value)); i++; }
+			else if (arg == "--shm-ring" && value) { options.shm_ring = static_cast<unsigned>(std::stoul(value)); i++; }
+			else if (arg == "--shm-text-kb" && value) { options.shm_text_kb = std::stoul(value); i++; }
+			else if (arg == "--shm-max-ids" && value) { options.shm_max_ids = std::stoul(value); i++; }
+			else if (arg == "--vocab" && value) { options.vocab_paths.push_back(value); i++; }
+			else if (arg == "--threads" && value) { options.threads = static_cast<unsigned>(std::stoul(value)); i++; }
+			else if (arg == "--max-batch" && value) { options.max_batch = std::stoul(value); i++; }
+			else if (arg == "--batch-window-us" && value) { options.batch_window_us = std::stol(value); i++; }
+			else if (arg == "--normalize" && value && parse_normalization_form(value, options.normalization)) i++;
+			else if (arg == "--lowercase") options.lowercase = true;
+			else if (arg == "--split-punctuation") options.split_on_punctuation = true;
+			else if (arg == "--keep-punctuation") options.keep_punctuation = true;
+			else if (arg == "--verbose") options.verbose = true;
+			else {
+				if (arg != "--help" && arg != "-h") {
+					std::cerr << "error: unknown or incomplete option '" << arg << "'" << std::endl;
+				}
+				return false;
+			}
+		}
+		return (!options.socket_path.empty() || !options.shm_name.empty()) && !options.vocab_paths.empty() && options.vocab_paths.size() <= 256;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	try {
+		if (!parse_args(argc, argv, options)) {
+			print_usage();
+			return 2;
+		}
+	}
+	catch (const std::exception&) {
+		std::cerr << "error: invalid numeric argument" << std::endl;
+		return 2;
+	}
+
+	std::vector<std::unique_ptr<TextTokenizer>> models;
+	for (const auto& path : options.vocab_paths) {
+		auto tokenizer = std::make_unique<TextTokenizer>();
+		if (!tokenizer->load_vocab(path)) {
+			std::cerr << "error: cannot load vocabulary '" << path << "'" << std::endl;
+			return 1;
+		}
+		tokenizer->set_lowercase(options.lowercase)
+			.set_normalization(options.normalization)
+			.set_split_on_punctuation(options.split_on_punctuation)
+			.set_keep_punctuation(options.keep_punctuation);
+		std::cerr << "model " << models.size() << ": " << path << " (" << tokenizer->vocab_size() << " tokens)" << std::endl;
+		models.push_back(std::move(tokenizer));
+	}
+
+	if (!options.socket_path.empty()) {
+		sockaddr_un addr;
+		std::memset(&addr, 0, sizeof(addr));
+		addr.sun_family = AF_UNIX;
+		if (options.socket_path.size() >= sizeof(addr.sun_path)) {
+			std::cerr << "error: socket path too long" << std::endl;
+			return 1;
+		}
+		std::memcpy(addr.sun_path, options.socket_path.c_str(), options.socket_path.size() + 1);
+
+		listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		::unlink(options.socket_path.c_str());
+		if (listen_fd < 0 ||
+			::bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+			::listen(listen_fd, 128) != 0) {
+			std::cerr << "error: cannot listen on '" << options.socket_path << "': " << std::strerror(errno) << std::endl;
+			return 1;
+		}
+	}
+
+#ifdef MTT_LINUX
+	ShmServer shm_server(models);
+	if (!options.shm_name.empty()) {
+		if (!shm_server.start(options)) {
+			if (errno == EEXIST) {
+				std::cerr << "error: shared memory segment '" << options.shm_name
+					<< "' is already in use by a running daemon or another program" << std::endl;
+			}
+			else {
+				std::cerr << "error: cannot create shared memory segment '" << options.shm_name << "': " << std::strerror(errno) << std::endl;
+			}
+			return 1;
+		}
+		std::cerr << "serving shared memory " << options.shm_name << " (" << options.shm_slots << " slots x "
+			<< options.shm_ring << " entries, " << shm_server.segment_size() / (1024 * 1024) << " MiB)" << std::endl;
+	}
+#else
+	if (!options.shm_name.empty()) {
+		std::cerr << "error: --shm is only supported on Linux" << std::endl;
+		return 1;
+	}
+#endif
+
+	struct sigaction action;
+	std::memset(&action, 0, sizeof(action));
+	action.sa_handler = handle_signal;
+	::sigaction(SIGINT, &action, nullptr);
+	::sigaction(SIGTERM, &action, nullptr);
+	::signal(SIGPIPE, SIG_IGN);
+
+	TokenizerThreadPool pool(options.threads);
+	MicroBatcher batcher(options.max_batch, std::chrono::microseconds(options.batch_window_us));
+	ConnectionRegistry registry;
+	std::atomic<uint64_t> batches{ 0 };
+	std::atomic<uint64_t> requests{ 0 };
+
+	// Batcher: spread each micro-batch over the pool and wait for it to finish
+	std::thread batch_thread([&]() {
+		std::vector<Request> batch;
+		std::mutex done_mutex;
+		std::condition_variable done_cv;
+
+		while (batcher.next_batch(batch)) {
+			batches++;
+			requests += batch.size();
+
+			std::atomic<size_t> next{ 0 };
+			size_t jobs = std::min(batch.size(), pool.size());
+			size_t remaining = jobs;
+
+			for (size_t j = 0; j < jobs; ++j) {
+				pool.submit([&]() {
+					for (size_t i = next++; i < batch.size(); i = next++) {
+						process(models, batch[i]);
+					}
+					std::lock_guard<std::mutex> lock(done_mutex);
+					if (--remaining == 0) done_cv.notify_one();
+				});
+			}
+
+			std::unique_lock<std::mutex> lock(done_mutex);
+			done_cv.wait(lock, [&] { return remaining == 0; });
+		}
+	});
+
+	if (listen_fd >= 0) {
+		std::cerr << "listening on " << options.socket_path << " (" << pool.size() << " workers, batch <= "
+			<< options.max_batch << ", window " << options.batch_window_us << " us)" << std::endl;
+	}
+
+	while (!stop_requested && listen_fd < 0) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+
+	while (!stop_requested) {
+		int client_fd = ::accept(listen_fd, nullptr, nullptr);
+		if (client_fd < 0) {
+			if (errno == EINTR || errno == ECONNABORTED) continue;
+			break;
+		}
+		auto connection = std::make_shared<Connection>(client_fd);
+		registry.add(connection);
+		std::thread(serve_connection, connection, std::ref(batcher), std::ref(registry)).detach();
+	}
+
+	registry.close_all_and_wait();
+	batcher.stop();
+	batch_thread.join();
+	if (listen_fd >= 0) {
+		::close(listen_fd);
+		::unlink(options.socket_path.c_str());
+	}
+#ifdef MTT_LINUX
+	shm_server.stop();
+#endif
+
+	if (options.verbose) {
+		uint64_t b = batches;
+		uint64_t r = requests;
+		std::cerr << "served " << r << " requests in " << b << " batches (avg "
+			<< (b ? static_cast<double>(r) / b : 0.0) << " per batch)" << std::endl;
+#ifdef MTT_LINUX
+		if (!options.shm_name.empty()) {
+			std::cerr << "served " << shm_server.requests() << " shared-memory requests" << std::endl;
+		}
+#endif
+	}
+	return 0;
+}
@@ -0,0 +1,379 @@
+#!/usr/bin/env python3
+"""Generates Modern-Text-Tokenizer-Unicode.hpp from Python's unicodedata.
+
+    python3 tools/gen_unicode_tables.py [output]
+
+The Unicode version of the tables is the one the running Python ships
+(unicodedata.unidata_version) and is recorded in the generated header.
+"""
+
+import sys
+import unicodedata
+from pathlib import Path
+
+MAX_CODE_POINT = 0x110000
+
+# Character classes for token boundaries; must match UnicodeTables::CharClass
+CLASS_OTHER = 0
+CLASS_WHITESPACE = 1
+CLASS_PUNCTUATION = 2
+
+
+def char_class(cp):
+    category = unicodedata.category(chr(cp))
+    # White_Space is Zs/Zl/Zp plus a few controls; of those only U+0085 is
+    # outside ASCII, and ASCII is classified by the tokenizer itself
+    if category in ("Zs", "Zl", "Zp") or cp == 0x85:
+        return CLASS_WHITESPACE
+    if category.startswith("P"):
+        return CLASS_PUNCTUATION
+    return CLASS_OTHER
+
+
+def simple_fold(cp):
+    """Simple (single code point) case folding, CaseFolding.txt status C and S.
+
+    str.casefold() is the full folding (status C and F); where that expands
+    to several code points the simple folding, if any, is the lowercase
+    mapping (U+1E9E -> U+00DF, U+1F88 -> U+1F80).
+    """
+    folded = chr(cp).casefold()
+    if len(folded) == 1:
+        return ord(folded)
+    lower = chr(cp).lower()
+    if len(lower) == 1:
+        return ord(lower)
+    return cp
+
+
+def format_array(name, values, ctype, comment, digits=2):
+    """digits=0 writes decimal numbers, for the big small-valued tables."""
+    width = {0: 24, 2: 16, 4: 8}.get(digits, 4)
+    lines = [f"\t\t// {comment}", f"\t\tinline constexpr {ctype} {name}[{len(values)}] = {{"]
+    for start in range(0, len(values), width):
+        row = ", ".join(str(v) if digits == 0 else f"0x{v:0{digits}X}" for v in values[start:start + width])
+        lines.append(f"\t\t\t{row},")
+    lines.append("\t\t};")
+    return "\n".join(lines)
+
+
+def bit_masks(values, wanted, block):
+    """64-bit mask of the code points in block whose value is wanted."""
+    mask = 0
+    for bit in range(64):
+        if values[(block << 6) + bit] == wanted:
+            mask |= 1 << bit
+    return mask
+
+
+def class_tables():
+    classes = [char_class(cp) if cp >= 0x80 else CLASS_OTHER for cp in range(MAX_CODE_POINT)]
+    limit = max(cp for cp, c in enumerate(classes) if c != CLASS_OTHER) + 1
+    limit = (limit + 63) >> 6 << 6
+
+    # One stage per block of 64 code points (the part of a code point all
+    # but the last UTF-8 byte determine), pointing at deduplicated pairs of
+    # whitespace and punctuation bit masks
+    pairs = {(0, 0): 0}
+    stage1 = []
+    for block in range(limit >> 6):
+        pair = (bit_masks(classes, CLASS_WHITESPACE, block), bit_masks(classes, CLASS_PUNCTUATION, block))
+        stage1.append(pairs.setdefault(pair, len(pairs)))
+    assert len(pairs) <= 256
+    ordered = sorted(pairs, key=pairs.get)
+
+    body = "\n\n".join([
+        f"\t\tinline constexpr uint32_t class_limit = 0x{limit:X};",
+        format_array("class_blocks", stage1, "uint8_t", "Mask index of each block of 64 code points below class_limit"),
+        format_array("whitespace_masks", [w for w, _ in ordered], "uint64_t", "Whitespace code points of a block, bit per code point", 16),
+        format_array("punctuation_masks", [p for _, p in ordered], "uint64_t", "Punctuation code points of a block, bit per code point", 16),
+    ])
+    return body, len(stage1) + 16 * len(ordered)
+
+
+def fold_tables():
+    folds = {}
+    for cp in range(0x80, MAX_CODE_POINT):
+        if not 0xD800 <= cp < 0xE000 and simple_fold(cp) != cp:
+            folds[cp] = simple_fold(cp)
+
+    # Two-byte UTF-8 up to Armenian (Latin-1, Latin Extended, IPA, Greek,
+    # Cyrillic) is indexed directly; nothing between there and U+0800 folds
+    direct_limit = max(cp for cp in folds if cp < 0x800) + 1
+    direct_limit = (direct_limit + 63) >> 6 << 6
+    direct = [folds.get(cp, cp) for cp in range(0x80, direct_limit)]
+    assert max(direct) <= 0xFFFF
+
+    # Everything above: runs of code points with the same offset, every code
+    # point or every other one (upper/lower pairs), found by binary search
+    ranges = []
+    for cp in sorted(cp for cp in folds if cp >= direct_limit):
+        delta = folds[cp] - cp
+        if ranges:
+            first, last, last_delta, stride = ranges[-1]
+            if last_delta == delta and (cp - last == stride or (first == last and cp - last in (1, 2))):
+                ranges[-1] = (first, cp, delta, cp - last)
+                continue
+        ranges.append((cp, cp, delta, 1))
+
+    # Blocks of 64 code points with any folding, so most text skips the search
+    block_count = (max(r[1] for r in ranges) >> 6) + 1
+    blocks = [0] * ((block_count + 63) >> 6)
+    for first, last, _, _ in ranges:
+        for block in range(first >> 6, (last >> 6) + 1):
+            blocks[block >> 6] |= 1 << (block & 63)
+
+    rows = [f"\t\t\t{{ 0x{first:05X}, 0x{last:05X}, {delta}, {stride} }}," for first, last, delta, stride in ranges]
+    body = "\n\n".join([
+        f"\t\tinline constexpr uint32_t fold_direct_limit = 0x{direct_limit:X};",
+        format_array("fold_direct", direct, "uint16_t", "Simple case folding of U+0080 up to fold_direct_limit", 4),
+        f"\t\tinline constexpr uint32_t fold_block_count = {block_count};",
+        format_array("fold_blocks", blocks, "uint64_t", "Bit per block of 64 code points holding a fold_ranges entry", 16),
+        "\t\t// Code points first..last (every stride-th) fold to cp + delta\n"
+        "\t\tstruct FoldRange { uint32_t first; uint32_t last; int32_t delta; uint32_t stride; };\n"
+        f"\t\tinline constexpr FoldRange fold_ranges[{len(ranges)}] = {{\n" + "\n".join(rows) + "\n\t\t};",
+    ])
+    return body, 2 * len(direct) + 8 * len(blocks) + 16 * len(ranges)
+
+
+# Normalization quick-check flags; must match UnicodeTables::NormalizationFlag
+NFD_NO = 1
+NFKD_NO = 2
+NFC_NO = 4
+NFC_MAYBE = 8
+NFKC_NO = 16
+NFKC_MAYBE = 32
+
+HANGUL_FIRST = 0xAC00
+HANGUL_COUNT = 11172
+
+
+def is_hangul_syllable(cp):
+    return HANGUL_FIRST <= cp < HANGUL_FIRST + HANGUL_COUNT
+
+
+def normalization_tables():
+    characters = [cp for cp in range(MAX_CODE_POINT) if not 0xD800 <= cp < 0xE000]
+
+    # Primary composites: canonical pairs that NFC recomposes (no singletons,
+    # no composition exclusions); Hangul is algorithmic
+    compositions = {}
+    for cp in characters:
+        mapping = unicodedata.decomposition(chr(cp))
+        if mapping and not mapping.startswith("<") and not is_hangul_syllable(cp):
+            parts = [int(part, 16) for part in mapping.split()]
+            if len(parts) == 2 and unicodedata.normalize("NFC", chr(cp)) == chr(cp):
+                compositions[tuple(parts)] = cp
+    # Quick check Maybe: anything that can combine with the character before
+    maybe = {second for _, second in compositions} | set(range(0x1161, 0x1176)) | set(range(0x11A8, 0x11C3))
+
+    canonical, compatibility = {}, {}
+    properties = [0] * MAX_CODE_POINT
+    for cp in characters:
+        char = chr(cp)
+        nfd = unicodedata.normalize("NFD", char)
+        nfkd = unicodedata.normalize("NFKD", char)
+        nfc_no = unicodedata.normalize("NFC", char) != char
+        nfkc_no = unicodedata.normalize("NFKC", char) != char
+        flags = ((NFD_NO if nfd != char else 0) | (NFKD_NO if nfkd != char else 0) |
+                 (NFC_NO if nfc_no else 0) | (NFC_MAYBE if cp in maybe and not nfc_no else 0) |
+                 (NFKC_NO if nfkc_no else 0) | (NFKC_MAYBE if cp in maybe and not nfkc_no else 0))
+        properties[cp] = unicodedata.combining(char) | flags << 8
+        if not is_hangul_syllable(cp):
+            if nfd != char:
+                canonical[cp] = [ord(c) for c in nfd]
+            if nfkd != nfd:
+                compatibility[cp] = [ord(c) for c in nfkd]
+
+    # Distinct (combining class, flags) pairs, then one stage per block of
+    # 64 code points over deduplicated blocks of pair indexes
+    distinct = sorted(set(properties))
+    assert distinct[0] == 0 and len(distinct) <= 256
+    pair_index = {value: index for index, value in enumerate(distinct)}
+    limit = max(cp for cp in characters if properties[cp]) + 1
+    limit = (limit + 63) >> 6 << 6
+    blocks, stage1 = {}, []
+    for block in range(limit >> 6):
+        key = tuple(pair_index[v] for v in properties[block << 6:(block + 1) << 6])
+        stage1.append(blocks.setdefault(key, len(blocks)))
+    assert len(blocks) <= 256
+    stage2 = [v for key in sorted(blocks, key=blocks.get) for v in key]
+
+    # First byte value that can start a character with quick check other than
+    # Yes or a nonzero combining class; every byte below it passes unchecked
+    def safe_byte(reject):
+        first = next(cp for cp in range(0x80, 0x800) if properties[cp] & 0xFF or (properties[cp] >> 8) & reject)
+        assert all(properties[cp] == 0 for cp in range(0x80))
+        return 0xC0 + (first >> 6)
+
+    def decomposition_arrays(name, mappings, comment):
+        entries, pool = [], []
+        for cp in sorted(mappings):
+            entries.append(cp << 32 | len(pool) << 8 | len(mappings[cp]))
+            pool.extend(mappings[cp])
+        assert len(pool) < 1 << 24 and max(map(len, mappings.values())) < 256
+        return [
+            format_array(f"{name}_decompositions", entries, "uint64_t", f"{comment}: code point << 32 | pool offset << 8 | length", 16),
+            format_array(f"{name}_pool", pool, "char32_t", f"Code points of the {name} decompositions", 0),
+        ], 8 * len(entries) + 4 * len(pool)
+
+    canonical_arrays, canonical_bytes = decomposition_arrays("canonical", canonical, "Full canonical decompositions (NFD) except Hangul")
+    compatibility_arrays, compatibility_bytes = decomposition_arrays(
+        "compatibility", compatibility, "Full compatibility decompositions (NFKD) where they differ from NFD")
+    packed = sorted(first << 42 | second << 21 | composite for (first, second), composite in compositions.items())
+
+    body = "\n\n".join([
+        f"\t\tinline constexpr unsigned char nfd_safe_byte = 0x{safe_byte(NFD_NO):02X};",
+        f"\t\tinline constexpr unsigned char nfc_safe_byte = 0x{safe_byte(NFC_NO | NFC_MAYBE):02X};",
+        f"\t\tinline constexpr unsigned char nfkc_safe_byte = 0x{safe_byte(NFKC_NO | NFKC_MAYBE):02X};",
+        format_array("normalization_properties", distinct, "uint16_t", "Canonical combining class | NormalizationFlag << 8", 4),
+        f"\t\tinline constexpr uint32_t normalization_limit = 0x{limit:X};",
+        format_array("normalization_blocks", stage1, "uint8_t", "Block of normalization_indexes for each 64 code points below normalization_limit", 0),
+        format_array("normalization_indexes", stage2, "uint8_t", "normalization_properties index per code point, 64 per block", 0),
+        *canonical_arrays,
+        *compatibility_arrays,
+        format_array("compositions", packed, "uint64_t", "Primary composites except Hangul: first << 42 | second << 21 | composite", 16),
+    ])
+    size = 2 * len(distinct) + len(stage1) + len(stage2) + canonical_bytes + compatibility_bytes + 8 * len(packed)
+    return body, size
+
+
+HEADER = """\
+/*
+ * Modern-Text-Tokenizer-Unicode.hpp
+ * -------------------------------------
+ * Unicode property tables for Modern-Text-Tokenizer.hpp: token boundary
+ * classes, simple case folding and normalization (NFC, NFD, NFKC).
+ *
+ * Generated by tools/gen_unicode_tables.py from Unicode {version}.
+ * Do not edit by hand; rerun the script instead.
+ * ---------------------------------------------------------------------------
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace MecanikDev
+{{
+	namespace UnicodeTables
+	{{
+		inline constexpr char unicode_version[] = "{version}";
+
+		// Token boundary class of a non-ASCII code point: White_Space, or
+		// any punctuation category (Pc, Pd, Ps, Pe, Pi, Pf, Po)
+		enum CharClass : uint8_t {{ other = 0, whitespace = 1, punctuation = 2 }};
+
+{classes}
+
+		// Mask index of the block of 64 code points holding cp >> 6 == block
+		inline uint8_t block_index(uint32_t block) {{
+			return block < (class_limit >> 6) ? class_blocks[block] : 0;
+		}}
+
+		inline CharClass char_class(char32_t cp) {{
+			uint8_t index = block_index(cp >> 6);
+			uint64_t bit = uint64_t(1) << (cp & 63);
+			if (whitespace_masks[index] & bit) return whitespace;
+			if (punctuation_masks[index] & bit) return punctuation;
+			return other;
+		}}
+
+{folds}
+
+		// Simple case folding (CaseFolding.txt status C and S) of cp
+		inline char32_t simple_fold(char32_t cp) {{
+			if (cp < 0x80) return cp >= 'A' && cp <= 'Z' ? cp + 32 : cp;
+			if (cp < fold_direct_limit) return fold_direct[cp - 0x80];
+
+			uint32_t block = cp >> 6;
+			if (block >= fold_block_count || ((fold_blocks[block >> 6] >> (block & 63)) & 1) == 0) return cp;
+
+			// Last range starting at or before cp
+			size_t low = 0, high = sizeof(fold_ranges) / sizeof(fold_ranges[0]);
+			while (high - low > 1) {{
+				size_t mid = (low + high) / 2;
+				if (fold_ranges[mid].first <= cp) low = mid;
+				else high = mid;
+			}}
+			const FoldRange& range = fold_ranges[low];
+			if (cp < range.first || cp > range.last || (cp - range.first) % range.stride != 0) return cp;
+			return static_cast<char32_t>(static_cast<int32_t>(cp) + range.delta);
+		}}
+
+		// Normalization quick-check properties (UAX #15): the character is not
+		// allowed (No) or may not be allowed (Maybe) in the form
+		enum NormalizationFlag : uint8_t {{
+			nfd_no = 1, nfkd_no = 2, nfc_no = 4, nfc_maybe = 8, nfkc_no = 16, nfkc_maybe = 32
+		}};
+
+{normalization}
+
+		// Canonical combining class | NormalizationFlag << 8 of cp
+		inline uint16_t normalization_info(char32_t cp) {{
+			if (cp >= normalization_limit) return 0;
+			return normalization_properties[normalization_indexes[normalization_blocks[cp >> 6] * 64 + (cp & 63)]];
+		}}
+
+		inline uint8_t combining_class(char32_t cp) {{
+			return static_cast<uint8_t>(normalization_info(cp));
+		}}
+
+		// Index of the first entry whose value >> shift is not below key
+		inline size_t lower_bound_packed(const uint64_t* entries, size_t count, uint64_t key, unsigned shift) {{
+			size_t low = 0, high = count;
+			while (low < high) {{
+				size_t mid = (low + high) / 2;
+				if ((entries[mid] >> shift) < key) low = mid + 1;
+				else high = mid;
+			}}
+			return low;
+		}}
+
+		// Full decomposition of cp (canonical, or compatibility if compat)
+		// in out, or 0 if it has none. Hangul syllables are left to the caller.
+		inline size_t decomposition(char32_t cp, bool compat, const char32_t*& out) {{
+			if (compat) {{
+				const size_t count = sizeof(compatibility_decompositions) / sizeof(compatibility_decompositions[0]);
+				size_t i = lower_bound_packed(compatibility_decompositions, count, cp, 32);
+				if (i < count && (compatibility_decompositions[i] >> 32) == cp) {{
+					out = compatibility_pool + ((compatibility_decompositions[i] >> 8) & 0xFFFFFF);
+					return compatibility_decompositions[i] & 0xFF;
+				}}
+			}}
+			const size_t count = sizeof(canonical_decompositions) / sizeof(canonical_decompositions[0]);
+			size_t i = lower_bound_packed(canonical_decompositions, count, cp, 32);
+			if (i < count && (canonical_decompositions[i] >> 32) == cp) {{
+				out = canonical_pool + ((canonical_decompositions[i] >> 8) & 0xFFFFFF);
+				return canonical_decompositions[i] & 0xFF;
+			}}
+			return 0;
+		}}
+
+		// Primary composite of first followed by second, or 0. No Hangul.
+		inline char32_t composition(char32_t first, char32_t second) {{
+			const size_t count = sizeof(compositions) / sizeof(compositions[0]);
+			uint64_t key = static_cast<uint64_t>(first) << 21 | second;
+			size_t i = lower_bound_packed(compositions, count, key, 21);
+			if (i < count && (compositions[i] >> 21) == key) return static_cast<char32_t>(compositions[i] & 0x1FFFFF);
+			return 0;
+		}}
+	}}
+}}
+"""
+
+
+def main():
+    root = Path(__file__).resolve().parent.parent
+    output = Path(sys.argv[1]) if len(sys.argv) > 1 else root / "Modern-Text-Tokenizer-Unicode.hpp"
+    classes, class_bytes = class_tables()
+    folds, fold_bytes = fold_tables()
+    normalization, normalization_bytes = normalization_tables()
+    text = HEADER.format(version=unicodedata.unidata_version, classes=classes, folds=folds, normalization=normalization)
+    output.write_text(text, encoding="utf-8", newline="\n")
+    print(f"{output}: Unicode {unicodedata.unidata_version}, class tables {class_bytes} bytes, "
+          f"case folding {fold_bytes} bytes, normalization {normalization_bytes} bytes")
+
+
+if __name__ == "__main__":
+    main()